@@ -0,0 +1,115 @@
+/******************************************************************************
+Copyright (c) 2023-2026 Valerio Orlandini
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Times the three AddOsc evaluations at a few partial counts and measures
+// how far the spectral one strays from the direct sum.
+// Build and run with: g++ -std=c++17 -O3 -I../include addosc_benchmark.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "soutel/addosc.h"
+
+using namespace soutel;
+
+const unsigned int warmup = 4096;
+const unsigned int samples = 1 << 18;
+
+AddOsc<float> make_oscillator(const int &partials, const AddEvaluation &evaluation)
+{
+    AddOsc<float> oscillator(44100.0f, 40.0f, partials, true, evaluation);
+
+    std::vector<float> gains(partials);
+    for (int h = 0; h < partials; h++)
+    {
+        gains[h] = 1.0f / (float)(h + 1);
+    }
+    oscillator.set_harmonics_gain(gains);
+
+    return oscillator;
+}
+
+double nanoseconds_per_sample(const int &partials, const AddEvaluation &evaluation)
+{
+    AddOsc<float> oscillator = make_oscillator(partials, evaluation);
+    volatile float sink = 0.0f;
+
+    for (unsigned int s = 0; s < warmup; s++)
+    {
+        sink = sink + oscillator.run();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int s = 0; s < samples; s++)
+    {
+        sink = sink + oscillator.run();
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (double)samples;
+}
+
+// Peak difference from the direct sum, in dB relative to the peak of the
+// direct output.
+double spectral_error_db(const int &partials)
+{
+    AddOsc<float> direct = make_oscillator(partials, AddEvaluation::direct);
+    AddOsc<float> spectral = make_oscillator(partials, AddEvaluation::spectral);
+    double peak = 0.0;
+    double error = 0.0;
+
+    for (unsigned int s = 0; s < warmup + samples / 8; s++)
+    {
+        float reference = direct.run();
+        float output = spectral.run();
+
+        if (s >= warmup)
+        {
+            peak = std::max(peak, (double)std::abs(reference));
+            error = std::max(error, (double)std::abs(output - reference));
+        }
+    }
+
+    return 20.0 * std::log10(error / peak);
+}
+
+int main()
+{
+    const int partial_counts[] = {4, 32, 128, 256};
+
+    std::printf("AddOsc<float> at 40 Hz, ns/sample\n");
+    std::printf("partials    direct   rotator  spectral  spectral error\n");
+    for (const auto &partials : partial_counts)
+    {
+        std::printf("%8d  %8.1f  %8.1f  %8.1f  %9.1f dB\n", partials,
+                    nanoseconds_per_sample(partials, AddEvaluation::direct),
+                    nanoseconds_per_sample(partials, AddEvaluation::rotator),
+                    nanoseconds_per_sample(partials, AddEvaluation::spectral),
+                    spectral_error_db(partials));
+    }
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/******************************************************************************
+Copyright (c) 2023-2026 Valerio Orlandini
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Checks that the sin/cos rotation used by the additive BLOsc and by the
+// Pulsar saw, square and triangle stays within a fixed bound of the direct
+// per-harmonic std::sin/std::cos sums it replaced.
+// Build and run with: g++ -std=c++17 -O2 -I../include harmonic_drift.cpp
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "soutel/blosc.h"
+#include "soutel/pulsar.h"
+
+using namespace soutel;
+
+template <typename TSample>
+TSample harmonics_below_nyquist(const TSample &sample_rate, const TSample &frequency)
+{
+    return std::min((TSample)30.0, std::floor(sample_rate * (TSample)0.5 / std::abs(frequency)));
+}
+
+template <typename TSample>
+TSample blosc_drift(const TSample &sample_rate, const TSample &frequency, const unsigned int &samples)
+{
+    BLOsc<TSample> oscillator(sample_rate, frequency);
+
+    const TSample step = frequency * ((TSample)1.0 / sample_rate);
+    const TSample harmonics = harmonics_below_nyquist(sample_rate, frequency);
+    double ramp = 0.0;
+    TSample drift = (TSample)0.0;
+
+    for (unsigned int s = 0; s < samples; s++)
+    {
+        oscillator.run();
+
+        ramp += step;
+        while (ramp > 1.0)
+        {
+            ramp -= 1.0;
+        }
+
+        TSample ramp_double_pi = (TSample)(ramp * M_PI * 2.0);
+        TSample saw = (TSample)0.0;
+        TSample square = (TSample)0.0;
+        TSample triangle = (TSample)0.0;
+        for (TSample harmonic = (TSample)1.0; harmonic <= harmonics; harmonic++)
+        {
+            saw += std::sin(-ramp_double_pi * harmonic) / harmonic;
+            if ((unsigned int)harmonic % 2)
+            {
+                square += std::sin(ramp_double_pi * harmonic) / harmonic;
+                triangle += std::cos(ramp_double_pi * harmonic) / (harmonic * harmonic);
+            }
+        }
+
+        drift = std::max(drift, std::abs(oscillator.get_saw() - saw * (TSample)0.55));
+        drift = std::max(drift, std::abs(oscillator.get_square() - square * (TSample)1.07));
+        drift = std::max(drift, std::abs(oscillator.get_triangle() - triangle * (TSample)0.82));
+    }
+
+    return drift;
+}
+
+// A phasor pulsar with the same settings outputs the wave ramp the
+// harmonic waveforms are evaluated at.
+template <typename TSample>
+TSample pulsar_drift(const TSample &sample_rate, const TSample &frequency, const PulsarWaveforms &waveform,
+                     const unsigned int &samples)
+{
+    Pulsar<TSample> oscillator(sample_rate, frequency, (TSample)0.5, waveform);
+    Pulsar<TSample> phasor(sample_rate, frequency, (TSample)0.5, PulsarWaveforms::phasor);
+
+    const TSample double_pi = (TSample)(M_PI * 2.0);
+    const TSample harmonics = harmonics_below_nyquist(sample_rate, frequency);
+    TSample drift = (TSample)0.0;
+
+    for (unsigned int s = 0; s < samples; s++)
+    {
+        TSample output = oscillator.run();
+        TSample wave_ramp = phasor.run();
+
+        if (wave_ramp == (TSample)0.0)
+        {
+            continue;
+        }
+
+        TSample expected = (TSample)0.0;
+        switch (waveform)
+        {
+        case PulsarWaveforms::saw:
+            for (TSample harmonic = (TSample)1.0; harmonic <= harmonics; harmonic++)
+            {
+                expected += std::sin((-wave_ramp + (TSample)0.5) * double_pi * harmonic) / harmonic;
+            }
+            expected *= (TSample)0.55;
+            break;
+        case PulsarWaveforms::square:
+            for (TSample harmonic = (TSample)1.0; harmonic <= harmonics; harmonic += (TSample)2.0)
+            {
+                expected += std::sin(wave_ramp * double_pi * harmonic) / harmonic;
+            }
+            expected *= (TSample)1.07;
+            break;
+        case PulsarWaveforms::triangle:
+            for (TSample harmonic = (TSample)1.0; harmonic <= harmonics; harmonic += (TSample)2.0)
+            {
+                expected += std::cos((wave_ramp + (TSample)0.75) * double_pi * harmonic) / (harmonic * harmonic);
+            }
+            expected *= (TSample)0.82;
+            break;
+        default:
+            break;
+        }
+
+        drift = std::max(drift, std::abs(output - expected));
+    }
+
+    return drift;
+}
+
+template <typename TSample>
+bool check(const char *name, const TSample &bound)
+{
+    const TSample frequencies[] = {(TSample)20.0, (TSample)110.0, (TSample)440.0, (TSample)1234.5, (TSample)3000.0};
+    const PulsarWaveforms waveforms[] = {PulsarWaveforms::saw, PulsarWaveforms::square, PulsarWaveforms::triangle};
+    const unsigned int samples = 200000;
+
+    TSample blosc = (TSample)0.0;
+    TSample pulsar = (TSample)0.0;
+    for (const auto &frequency : frequencies)
+    {
+        blosc = std::max(blosc, blosc_drift((TSample)44100.0, frequency, samples));
+        for (const auto &waveform : waveforms)
+        {
+            pulsar = std::max(pulsar, pulsar_drift((TSample)44100.0, frequency, waveform, samples));
+        }
+    }
+
+    bool passed = blosc <= bound && pulsar <= bound;
+    std::printf("%-6s BLOsc %.3g  Pulsar %.3g  bound %.3g  %s\n", name, (double)blosc, (double)pulsar,
+                (double)bound, passed ? "ok" : "FAILED");
+
+    return passed;
+}
+
+int main()
+{
+    bool passed = check<double>("double", 1e-12);
+    passed = check<float>("float", 1e-5f) && passed;
+
+    return passed ? 0 : 1;
+}
@@ -1,465 +1,1018 @@
-/******************************************************************************
-Copyright (c) 2023-2026 Valerio Orlandini
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-******************************************************************************/
-
-
-#ifndef ADDOSC_H_
-#define ADDOSC_H_
-
-#include <array>
-
-#include "interp.h"
-
-#if __cplusplus >= 202002L
-#include<concepts>
-#endif
-
-namespace soutel
-{
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-struct harmonic_state
-{
-    TSample gain;
-    TSample phase;
-};
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-class AddOsc
-{
-public:
-    AddOsc(const TSample &sample_rate = (TSample)44100.0,
-           const TSample &frequency = (TSample)0.0,
-           const int &harmonics = 16,
-           const bool &normalize = true);
-
-    void set_sample_rate(const TSample &sample_rate);
-    void set_frequency(const TSample &frequency);
-    void set_normalize(const bool &normalize);
-    void set_harmonics(const int &harmonics);
-    void set_harmonics_gain(const std::vector<TSample> &harmonics_gain);
-    void set_harmonics_phase(const std::vector<TSample> &harmonics_phase);
-    bool set_harmonic_state(const int &index, const TSample &gain, const TSample &phase);
-    bool set_harmonic_gain(const int &index, const TSample &gain);
-    bool set_harmonic_phase(const int &index, const TSample &phase);
-    void reset();
-
-    TSample get_sample_rate();
-    TSample get_frequency();
-    bool get_normalize();
-    int get_harmonics();
-    std::vector<TSample> get_harmonics_gain();
-    std::vector<TSample> get_harmonics_phase();
-    std::array<TSample, 2> get_harmonic_state(const int &index);
-
-    inline TSample run();
-
-    inline TSample get_last_sample();
-
-private:
-    TSample sample_rate_;
-    TSample inv_sample_rate_;
-    TSample half_sample_rate_;
-
-    TSample frequency_;
-
-    TSample step_;
-    TSample ramp_;
-
-    int harmonics_;
-
-    bool normalize_;
-    TSample norm_factor_ = (TSample)1.0;
-    TSample past_norm_factor_;
-    TSample interp_;
-
-    TSample output_;
-
-    std::vector<harmonic_state<TSample>> harmonics_state_;
-
-    const TSample double_pi_ = (TSample)(M_PI * 2.0);
-
-    inline void normalize_gains();
-};
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-AddOsc<TSample>::AddOsc(const TSample &sample_rate, const TSample &frequency, const int &harmonics, const bool &normalize)
-{
-    frequency_ = frequency;
-
-    set_sample_rate(sample_rate);
-
-    if (harmonics > 0 && harmonics <= 256)
-    {
-        set_harmonics(harmonics);
-    }
-    else
-    {
-        set_harmonics(16);
-    }
-
-    if (!harmonics_state_.empty())
-    {
-        for (int h = harmonics_state_.size() - 1; h >= 0; h--)
-        {
-            harmonics_state_[h].gain = h ? (TSample)0.0 : (TSample)1.0;
-            harmonics_state_[h].phase = (TSample)0.0;
-        }
-    }
-
-    set_normalize(normalize);
-
-    reset();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void AddOsc<TSample>::set_sample_rate(const TSample &sample_rate)
-{
-    sample_rate_ = std::max((TSample)1.0, sample_rate);
-    half_sample_rate_ = sample_rate_ * (TSample)0.5;
-    inv_sample_rate_ = (TSample)1.0 / sample_rate_;
-
-    set_frequency(frequency_);
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void AddOsc<TSample>::set_harmonics(const int &harmonics)
-{
-    harmonic_state<TSample> def_value;
-    def_value.gain = (TSample)0.0;
-    def_value.phase = (TSample)0.0;
-
-    if (harmonics > 0 && harmonics <= 256)
-    {
-        harmonics_state_.resize(harmonics, def_value);
-    }
-    else
-    {
-        harmonics_state_.resize(16, def_value);
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void AddOsc<TSample>::set_normalize(const bool &normalize)
-{
-    normalize_ = normalize;
-
-    if (normalize_)
-    {
-        normalize_gains();
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void AddOsc<TSample>::set_frequency(const TSample &frequency)
-{
-    frequency_ = std::clamp(frequency, half_sample_rate_ * (TSample)-0.999, half_sample_rate_ * (TSample)0.999);
-
-    step_ = frequency_ * inv_sample_rate_;
-
-    if (frequency != (TSample)0.0)
-    {
-        harmonics_ = std::min(int(harmonics_state_.size()), int(std::floor(half_sample_rate_ / std::abs(frequency_))));
-    }
-    else
-    {
-        harmonics_ = 0;
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void AddOsc<TSample>::set_harmonics_gain(const std::vector<TSample> &harmonics_gain)
-{
-    auto harmonics_gain_size = harmonics_gain.size();
-    for (auto h = 0; h < harmonics_gain_size; h++)
-    {
-        if (h < harmonics_state_.size())
-        {
-            harmonics_state_[h].gain = harmonics_gain.at(h);
-        }
-    }
-
-    if (normalize_)
-    {
-        normalize_gains();
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void AddOsc<TSample>::set_harmonics_phase(const std::vector<TSample> &harmonics_phase)
-{
-    auto harmonics_phase_size = harmonics_phase.size();
-    for (auto h = 0; h < harmonics_phase_size; h++)
-    {
-        if (h < harmonics_state_.size())
-        {
-            harmonics_state_[h].phase = harmonics_phase.at(h);
-        }
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-bool AddOsc<TSample>::set_harmonic_state(const int &index, const TSample &gain, const TSample &phase)
-{
-    if (index < harmonics_state_.size())
-    {
-        set_harmonic_gain(index, gain);
-        set_harmonic_phase(index, phase);
-
-        return true;
-    }
-
-    return false;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-bool AddOsc<TSample>::set_harmonic_gain(const int &index, const TSample &gain)
-{
-    if (index < harmonics_state_.size())
-    {
-        harmonics_state_[index].gain = gain;
-
-        if (normalize_)
-        {
-            normalize_gains();
-        }
-
-        return true;
-    }
-
-    return false;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-bool AddOsc<TSample>::set_harmonic_phase(const int &index, const TSample &phase)
-{
-    if (index < harmonics_state_.size())
-    {
-        harmonics_state_[index].phase = phase;
-
-        return true;
-    }
-
-    return false;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void AddOsc<TSample>::reset()
-{
-    ramp_ = (TSample)0.0;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-TSample AddOsc<TSample>::get_sample_rate()
-{
-    return sample_rate_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-TSample AddOsc<TSample>::get_frequency()
-{
-    return frequency_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-bool AddOsc<TSample>::get_normalize()
-{
-    return normalize_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-int AddOsc<TSample>::get_harmonics()
-{
-    return harmonics_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::vector<TSample> AddOsc<TSample>::get_harmonics_gain()
-{
-    std::vector<TSample> gains;
-
-    for (auto const &s : harmonics_state_)
-    {
-        gains.push_back(s.gain);
-    }
-    return gains;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::vector<TSample> AddOsc<TSample>::get_harmonics_phase()
-{
-    std::vector<TSample> phases;
-
-    for (auto const &s : harmonics_state_)
-    {
-        phases.push_back(s.phase);
-    }
-    return phases;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::array<TSample, 2> AddOsc<TSample>::get_harmonic_state(const int &index)
-{
-    std::array<TSample, 2> state{(TSample)0.0, (TSample)0.0};
-
-    if (index >= 0 && index < harmonics_state_.size())
-    {
-        state[0] = harmonics_state_[index].gain;
-        state[1] = harmonics_state_[index].phase;
-    }
-
-    return state;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline TSample AddOsc<TSample>::run()
-{
-    ramp_ += step_;
-    if (ramp_ > (TSample)1.0)
-    {
-        while (ramp_ > (TSample)1.0)
-        {
-            ramp_ -=  (TSample)1.0;
-        }
-    }
-
-    output_ = (TSample)0.0;
-
-    for (auto h = 0; h < harmonics_; h++)
-    {
-        TSample harmonic = (TSample)(h + 1);
-        output_ += harmonics_state_[h].gain * std::cos(ramp_ * double_pi_ * harmonic + (harmonics_state_[h].phase * double_pi_));
-    }
-
-    if (normalize_)
-    {
-        interp_ = interp_ < (TSample)1.0 ? (interp_ + (TSample)0.01) : (TSample)1.0;
-        output_ *= linip(past_norm_factor_, norm_factor_, interp_);
-    }
-
-    return output_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline TSample AddOsc<TSample>::get_last_sample()
-{
-    return output_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline void AddOsc<TSample>::normalize_gains()
-{
-    past_norm_factor_ = norm_factor_;
-    norm_factor_ = (TSample)1.0;
-    TSample total_gain_ = (TSample)0.0;
-
-    if (harmonics_state_.size() > 0)
-    {
-        for (auto h = 0; h < harmonics_state_.size(); h++)
-        {
-            total_gain_ += harmonics_state_[h].gain;
-        }
-    }
-
-    if (std::abs(total_gain_) > (TSample)1.0)
-    {
-        norm_factor_ = (TSample)1.0 / total_gain_;
-    }
-
-    interp_ = 0.0;
-}
-
-}
-
-#endif // ADDOSC_H_
+/******************************************************************************
+Copyright (c) 2023-2026 Valerio Orlandini
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ADDOSC_H_
+#define ADDOSC_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "fft.h"
+#include "interp.h"
+
+#if __cplusplus >= 202002L
+#include<concepts>
+#endif
+
+namespace soutel
+{
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+enum class AddEvaluation
+{
+    direct,
+    rotator,
+    spectral
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+struct harmonic_state
+{
+    TSample gain;
+    TSample phase;
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class AddOsc
+{
+public:
+    AddOsc(const TSample &sample_rate = (TSample)44100.0,
+           const TSample &frequency = (TSample)0.0,
+           const int &harmonics = 16,
+           const bool &normalize = true,
+           const AddEvaluation &evaluation = AddEvaluation::direct);
+
+    void set_sample_rate(const TSample &sample_rate);
+    void set_frequency(const TSample &frequency);
+    void set_normalize(const bool &normalize);
+    void set_evaluation(const AddEvaluation &evaluation);
+    void set_harmonics(const int &harmonics);
+    void set_harmonics_gain(const std::vector<TSample> &harmonics_gain);
+    void set_harmonics_phase(const std::vector<TSample> &harmonics_phase);
+    void set_harmonics_ratio(const std::vector<TSample> &harmonics_ratio);
+    bool set_harmonic_state(const int &index, const TSample &gain, const TSample &phase);
+    bool set_harmonic_gain(const int &index, const TSample &gain);
+    bool set_harmonic_phase(const int &index, const TSample &phase);
+    bool set_harmonic_ratio(const int &index, const TSample &ratio);
+    void reset();
+
+    TSample get_sample_rate();
+    TSample get_frequency();
+    bool get_normalize();
+    AddEvaluation get_evaluation();
+    int get_harmonics();
+    std::vector<TSample> get_harmonics_gain();
+    std::vector<TSample> get_harmonics_phase();
+    std::vector<TSample> get_harmonics_ratio();
+    std::array<TSample, 2> get_harmonic_state(const int &index);
+
+    inline TSample run();
+    void run_block(std::vector<TSample> &output);
+
+    inline TSample get_last_sample();
+
+private:
+    TSample sample_rate_;
+    TSample inv_sample_rate_;
+    TSample half_sample_rate_;
+
+    TSample frequency_;
+
+    TSample step_;
+
+    int harmonics_ = 0;
+
+    bool normalize_;
+    TSample total_gain_ = (TSample)0.0;
+    TSample norm_factor_ = (TSample)1.0;
+    TSample past_norm_factor_;
+    TSample interp_;
+
+    TSample output_;
+
+    std::vector<harmonic_state<TSample>> harmonics_state_;
+
+    AddEvaluation evaluation_ = AddEvaluation::direct;
+    std::vector<TSample> gains_;
+    std::vector<TSample> ratios_;
+    std::vector<TSample> partial_steps_;
+    std::vector<TSample> partial_bases_;
+    unsigned int partial_clock_ = 0;
+    bool harmonic_ratios_ = true;
+    std::vector<int> active_;
+    std::vector<int> slots_;
+    std::vector<TSample> active_gains_;
+    bool active_synced_ = false;
+    std::vector<TSample> rotator_cos_;
+    std::vector<TSample> rotator_sin_;
+    std::vector<TSample> rotator_step_cos_;
+    std::vector<TSample> rotator_step_sin_;
+    bool rotators_synced_ = false;
+    unsigned int rotator_countdown_ = 0;
+
+    std::vector<std::complex<double>> spectrum_;
+    std::vector<TSample> spectral_tail_;
+    std::vector<TSample> spectral_out_;
+    unsigned int spectral_pos_ = 0;
+    bool spectral_synced_ = false;
+
+    const TSample double_pi_ = (TSample)(M_PI * 2.0);
+    static constexpr unsigned int partial_rebase_ = 256;
+    static constexpr unsigned int rotator_resync_ = 1024;
+    static constexpr unsigned int spectral_size_ = 1024;
+    static constexpr unsigned int spectral_hop_ = spectral_size_ / 2;
+    static constexpr int spectral_bins_ = 8;
+
+    inline void normalize_gains();
+    inline void update_partials_();
+    inline void rebase_partials_();
+    inline void update_active_();
+    inline void update_rotator_steps_();
+    inline void sync_rotators_();
+    inline void synthesize_frame_(const int &offset);
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+AddOsc<TSample>::AddOsc(const TSample &sample_rate, const TSample &frequency, const int &harmonics, const bool &normalize,
+                        const AddEvaluation &evaluation)
+{
+    frequency_ = frequency;
+
+    set_sample_rate(sample_rate);
+
+    if (harmonics > 0 && harmonics <= 256)
+    {
+        set_harmonics(harmonics);
+    }
+    else
+    {
+        set_harmonics(16);
+    }
+
+    if (!harmonics_state_.empty())
+    {
+        for (int h = harmonics_state_.size() - 1; h >= 0; h--)
+        {
+            harmonics_state_[h].gain = h ? (TSample)0.0 : (TSample)1.0;
+            harmonics_state_[h].phase = (TSample)0.0;
+        }
+    }
+
+    update_partials_();
+    update_active_();
+
+    set_normalize(normalize);
+
+    spectrum_.resize(spectral_size_);
+    spectral_tail_.resize(spectral_hop_, (TSample)0.0);
+    spectral_out_.resize(spectral_hop_, (TSample)0.0);
+
+    set_evaluation(evaluation);
+
+    reset();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::set_sample_rate(const TSample &sample_rate)
+{
+    sample_rate_ = std::max((TSample)1.0, sample_rate);
+    half_sample_rate_ = sample_rate_ * (TSample)0.5;
+    inv_sample_rate_ = (TSample)1.0 / sample_rate_;
+
+    set_frequency(frequency_);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::set_harmonics(const int &harmonics)
+{
+    harmonic_state<TSample> def_value;
+    def_value.gain = (TSample)0.0;
+    def_value.phase = (TSample)0.0;
+
+    rebase_partials_();
+
+    if (harmonics > 0 && harmonics <= 256)
+    {
+        harmonics_state_.resize(harmonics, def_value);
+    }
+    else
+    {
+        harmonics_state_.resize(16, def_value);
+    }
+
+    auto size = harmonics_state_.size();
+    auto ratios_size = ratios_.size();
+    ratios_.resize(size);
+    for (auto h = ratios_size; h < size; h++)
+    {
+        ratios_[h] = (TSample)(h + 1);
+    }
+    gains_.resize(size, (TSample)0.0);
+    partial_steps_.resize(size, (TSample)0.0);
+    partial_bases_.resize(size, (TSample)0.0);
+    slots_.resize(size, -1);
+    active_.reserve(size);
+    active_gains_.reserve(size);
+    active_synced_ = false;
+
+    total_gain_ = (TSample)0.0;
+    for (auto const &s : harmonics_state_)
+    {
+        total_gain_ += s.gain;
+    }
+    rotator_cos_.resize(size, (TSample)1.0);
+    rotator_sin_.resize(size, (TSample)0.0);
+    rotator_step_cos_.resize(size, (TSample)1.0);
+    rotator_step_sin_.resize(size, (TSample)0.0);
+
+    set_frequency(frequency_);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::set_normalize(const bool &normalize)
+{
+    normalize_ = normalize;
+
+    if (normalize_)
+    {
+        normalize_gains();
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::set_frequency(const TSample &frequency)
+{
+    rebase_partials_();
+
+    frequency_ = std::clamp(frequency, half_sample_rate_ * (TSample)-0.999, half_sample_rate_ * (TSample)0.999);
+
+    step_ = frequency_ * inv_sample_rate_;
+
+    update_partials_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::set_evaluation(const AddEvaluation &evaluation)
+{
+    evaluation_ = evaluation;
+
+    active_synced_ = false;
+    spectral_synced_ = false;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::set_harmonics_gain(const std::vector<TSample> &harmonics_gain)
+{
+    auto harmonics_gain_size = harmonics_gain.size();
+    for (auto h = 0; h < harmonics_gain_size; h++)
+    {
+        if (h < harmonics_state_.size())
+        {
+            total_gain_ += harmonics_gain.at(h) - harmonics_state_[h].gain;
+            harmonics_state_[h].gain = harmonics_gain.at(h);
+        }
+    }
+
+    update_partials_();
+    active_synced_ = false;
+
+    if (normalize_)
+    {
+        normalize_gains();
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::set_harmonics_phase(const std::vector<TSample> &harmonics_phase)
+{
+    auto harmonics_phase_size = harmonics_phase.size();
+    for (auto h = 0; h < harmonics_phase_size; h++)
+    {
+        if (h < harmonics_state_.size())
+        {
+            partial_bases_[h] += harmonics_phase.at(h) - harmonics_state_[h].phase;
+            partial_bases_[h] -= std::floor(partial_bases_[h]);
+            harmonics_state_[h].phase = harmonics_phase.at(h);
+        }
+    }
+
+    rotators_synced_ = false;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::set_harmonics_ratio(const std::vector<TSample> &harmonics_ratio)
+{
+    rebase_partials_();
+
+    auto harmonics_ratio_size = harmonics_ratio.size();
+    for (std::size_t h = 0; h < harmonics_ratio_size; h++)
+    {
+        if (h < ratios_.size())
+        {
+            ratios_[h] = harmonics_ratio.at(h);
+        }
+    }
+
+    update_partials_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool AddOsc<TSample>::set_harmonic_state(const int &index, const TSample &gain, const TSample &phase)
+{
+    if (index < harmonics_state_.size())
+    {
+        set_harmonic_gain(index, gain);
+        set_harmonic_phase(index, phase);
+
+        return true;
+    }
+
+    return false;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool AddOsc<TSample>::set_harmonic_gain(const int &index, const TSample &gain)
+{
+    if (index < harmonics_state_.size())
+    {
+        total_gain_ += gain - harmonics_state_[index].gain;
+        harmonics_state_[index].gain = gain;
+        gains_[index] = index < harmonics_ && std::abs(partial_steps_[index]) <= (TSample)0.5 ? gain : (TSample)0.0;
+
+        if (active_synced_ && slots_[index] >= 0 && gains_[index] != (TSample)0.0)
+        {
+            active_gains_[slots_[index]] = gains_[index];
+        }
+        else if (slots_[index] >= 0 || gains_[index] != (TSample)0.0)
+        {
+            active_synced_ = false;
+        }
+
+        if (normalize_)
+        {
+            normalize_gains();
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool AddOsc<TSample>::set_harmonic_phase(const int &index, const TSample &phase)
+{
+    if (index < harmonics_state_.size())
+    {
+        partial_bases_[index] += phase - harmonics_state_[index].phase;
+        partial_bases_[index] -= std::floor(partial_bases_[index]);
+        harmonics_state_[index].phase = phase;
+        rotators_synced_ = false;
+
+        return true;
+    }
+
+    return false;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool AddOsc<TSample>::set_harmonic_ratio(const int &index, const TSample &ratio)
+{
+    if (index >= 0 && index < (int)ratios_.size())
+    {
+        rebase_partials_();
+        ratios_[index] = ratio;
+        update_partials_();
+
+        return true;
+    }
+
+    return false;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::reset()
+{
+    for (std::size_t h = 0; h < harmonics_state_.size(); h++)
+    {
+        partial_bases_[h] = harmonics_state_[h].phase - std::floor(harmonics_state_[h].phase);
+    }
+    partial_clock_ = 0;
+    rotators_synced_ = false;
+    spectral_synced_ = false;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample AddOsc<TSample>::get_sample_rate()
+{
+    return sample_rate_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample AddOsc<TSample>::get_frequency()
+{
+    return frequency_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool AddOsc<TSample>::get_normalize()
+{
+    return normalize_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+AddEvaluation AddOsc<TSample>::get_evaluation()
+{
+    return evaluation_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+int AddOsc<TSample>::get_harmonics()
+{
+    return harmonics_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> AddOsc<TSample>::get_harmonics_gain()
+{
+    std::vector<TSample> gains;
+
+    for (auto const &s : harmonics_state_)
+    {
+        gains.push_back(s.gain);
+    }
+    return gains;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> AddOsc<TSample>::get_harmonics_phase()
+{
+    std::vector<TSample> phases;
+
+    for (auto const &s : harmonics_state_)
+    {
+        phases.push_back(s.phase);
+    }
+    return phases;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> AddOsc<TSample>::get_harmonics_ratio()
+{
+    return ratios_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::array<TSample, 2> AddOsc<TSample>::get_harmonic_state(const int &index)
+{
+    std::array<TSample, 2> state{(TSample)0.0, (TSample)0.0};
+
+    if (index >= 0 && index < harmonics_state_.size())
+    {
+        state[0] = harmonics_state_[index].gain;
+        state[1] = harmonics_state_[index].phase;
+    }
+
+    return state;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample AddOsc<TSample>::run()
+{
+    if (!active_synced_)
+    {
+        update_active_();
+    }
+
+    partial_clock_++;
+    if (partial_clock_ >= partial_rebase_)
+    {
+        rebase_partials_();
+    }
+
+    output_ = (TSample)0.0;
+
+    if (evaluation_ == AddEvaluation::rotator)
+    {
+        if (!rotators_synced_ || rotator_countdown_ == 0)
+        {
+            sync_rotators_();
+        }
+        else
+        {
+            TSample *rotator_cos = rotator_cos_.data();
+            TSample *rotator_sin = rotator_sin_.data();
+            const TSample *step_cos = rotator_step_cos_.data();
+            const TSample *step_sin = rotator_step_sin_.data();
+
+            for (std::size_t a = 0; a < active_.size(); a++)
+            {
+                TSample cos_next = rotator_cos[a] * step_cos[a] - rotator_sin[a] * step_sin[a];
+                rotator_sin[a] = rotator_sin[a] * step_cos[a] + rotator_cos[a] * step_sin[a];
+                rotator_cos[a] = cos_next;
+            }
+        }
+        rotator_countdown_--;
+
+        const TSample *gains = active_gains_.data();
+        const TSample *rotator_cos = rotator_cos_.data();
+
+        for (std::size_t a = 0; a < active_.size(); a++)
+        {
+            output_ += gains[a] * rotator_cos[a];
+        }
+    }
+    else if (evaluation_ == AddEvaluation::spectral)
+    {
+        if (!spectral_synced_)
+        {
+            synthesize_frame_(-(int)spectral_hop_);
+            spectral_pos_ = spectral_hop_;
+            spectral_synced_ = true;
+        }
+
+        if (spectral_pos_ == spectral_hop_)
+        {
+            synthesize_frame_(0);
+            spectral_pos_ = 0;
+        }
+
+        output_ = spectral_out_[spectral_pos_++];
+    }
+    else
+    {
+        const TSample clock = (TSample)partial_clock_;
+        const TSample *gains = active_gains_.data();
+        const TSample *bases = partial_bases_.data();
+        const TSample *steps = partial_steps_.data();
+
+        for (std::size_t a = 0; a < active_.size(); a++)
+        {
+            const int h = active_[a];
+            output_ += gains[a] * std::cos((bases[h] + steps[h] * clock) * double_pi_);
+        }
+    }
+
+    if (normalize_)
+    {
+        interp_ = interp_ < (TSample)1.0 ? (interp_ + (TSample)0.01) : (TSample)1.0;
+        output_ *= linip(past_norm_factor_, norm_factor_, interp_);
+    }
+
+    return output_;
+}
+
+// In direct mode a block is rendered in chunks that end on the rebase points
+// of the phase accumulators: each chunk starts every partial from its exact
+// phase and then advances it with a rotation, so that the inner loop runs
+// over the partial arrays with no trigonometric calls.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void AddOsc<TSample>::run_block(std::vector<TSample> &output)
+{
+    if (output.empty())
+    {
+        return;
+    }
+
+    if (evaluation_ != AddEvaluation::direct)
+    {
+        for (auto &sample : output)
+        {
+            sample = run();
+        }
+
+        return;
+    }
+
+    if (!active_synced_)
+    {
+        update_active_();
+    }
+
+    const TSample *gains = active_gains_.data();
+    TSample *rotator_cos = rotator_cos_.data();
+    TSample *rotator_sin = rotator_sin_.data();
+    TSample *step_cos = rotator_step_cos_.data();
+    TSample *step_sin = rotator_step_sin_.data();
+    std::size_t start = 0;
+
+    while (start < output.size())
+    {
+        std::size_t chunk = std::min(output.size() - start, (std::size_t)(partial_rebase_ - partial_clock_));
+        const TSample clock = (TSample)(partial_clock_ + 1);
+
+        for (std::size_t a = 0; a < active_.size(); a++)
+        {
+            const int h = active_[a];
+            TSample cycles = partial_bases_[h] + partial_steps_[h] * clock;
+            TSample angle = (cycles - std::floor(cycles)) * double_pi_;
+            rotator_cos[a] = std::cos(angle);
+            rotator_sin[a] = std::sin(angle);
+            step_cos[a] = std::cos(partial_steps_[h] * double_pi_);
+            step_sin[a] = std::sin(partial_steps_[h] * double_pi_);
+        }
+
+        for (std::size_t n = start; n < start + chunk; n++)
+        {
+            TSample sample = (TSample)0.0;
+
+            for (std::size_t a = 0; a < active_.size(); a++)
+            {
+                sample += gains[a] * rotator_cos[a];
+
+                TSample cos_next = rotator_cos[a] * step_cos[a] - rotator_sin[a] * step_sin[a];
+                rotator_sin[a] = rotator_sin[a] * step_cos[a] + rotator_cos[a] * step_sin[a];
+                rotator_cos[a] = cos_next;
+            }
+
+            output[n] = sample;
+        }
+
+        partial_clock_ += chunk;
+        if (partial_clock_ >= partial_rebase_)
+        {
+            rebase_partials_();
+        }
+
+        start += chunk;
+    }
+
+    rotators_synced_ = false;
+
+    if (normalize_)
+    {
+        for (auto &sample : output)
+        {
+            interp_ = interp_ < (TSample)1.0 ? (interp_ + (TSample)0.01) : (TSample)1.0;
+            sample *= linip(past_norm_factor_, norm_factor_, interp_);
+        }
+    }
+
+    output_ = output.back();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample AddOsc<TSample>::get_last_sample()
+{
+    return output_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void AddOsc<TSample>::normalize_gains()
+{
+    past_norm_factor_ = norm_factor_;
+    norm_factor_ = (TSample)1.0;
+
+    if (std::abs(total_gain_) > (TSample)1.0)
+    {
+        norm_factor_ = (TSample)1.0 / total_gain_;
+    }
+
+    interp_ = 0.0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void AddOsc<TSample>::update_rotator_steps_()
+{
+    if (!harmonic_ratios_)
+    {
+        for (std::size_t a = 0; a < active_.size(); a++)
+        {
+            rotator_step_cos_[a] = std::cos(partial_steps_[active_[a]] * double_pi_);
+            rotator_step_sin_[a] = std::sin(partial_steps_[active_[a]] * double_pi_);
+        }
+
+        return;
+    }
+
+    TSample step_double_pi = step_ * double_pi_;
+    TSample base_cos = std::cos(step_double_pi);
+    TSample base_sin = std::sin(step_double_pi);
+    TSample step_cos = base_cos;
+    TSample step_sin = base_sin;
+
+    for (auto h = 0; h < harmonics_; h++)
+    {
+        if (slots_[h] >= 0)
+        {
+            rotator_step_cos_[slots_[h]] = step_cos;
+            rotator_step_sin_[slots_[h]] = step_sin;
+        }
+
+        TSample cos_next = step_cos * base_cos - step_sin * base_sin;
+        step_sin = step_sin * base_cos + step_cos * base_sin;
+        step_cos = cos_next;
+    }
+}
+
+// Each partial has its own phase accumulator, stored as the phase (in
+// cycles, phase offset included) reached partial_clock_ samples ago, so that
+// advancing all of them costs nothing until the clock is folded back in by
+// rebase_partials_(), every partial_rebase_ samples and before any step
+// changes.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void AddOsc<TSample>::rebase_partials_()
+{
+    const TSample clock = (TSample)partial_clock_;
+
+    for (std::size_t h = 0; h < partial_bases_.size(); h++)
+    {
+        TSample cycles = partial_bases_[h] + partial_steps_[h] * clock;
+        partial_bases_[h] = cycles - std::floor(cycles);
+    }
+
+    partial_clock_ = 0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void AddOsc<TSample>::update_partials_()
+{
+    harmonics_ = 0;
+    harmonic_ratios_ = true;
+
+    for (std::size_t h = 0; h < ratios_.size(); h++)
+    {
+        partial_steps_[h] = ratios_[h] * step_;
+        harmonic_ratios_ = harmonic_ratios_ && ratios_[h] == (TSample)(h + 1);
+
+        TSample gain = (TSample)0.0;
+        if (step_ != (TSample)0.0 && std::abs(partial_steps_[h]) <= (TSample)0.5)
+        {
+            gain = harmonics_state_[h].gain;
+            harmonics_ = h + 1;
+        }
+
+        if ((gain != (TSample)0.0) != (gains_[h] != (TSample)0.0))
+        {
+            active_synced_ = false;
+        }
+        gains_[h] = gain;
+    }
+
+    if (evaluation_ == AddEvaluation::rotator && active_synced_)
+    {
+        update_rotator_steps_();
+    }
+}
+
+// The partials that are both audible and non-silent are gathered, together
+// with their gains, in active_ whenever the set changes, so that the audio
+// loops never visit a zero gain. Rotators are stored by position in this
+// list. The running sum of the gains is also recomputed here, to discard
+// the rounding errors accumulated by the gain setters.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void AddOsc<TSample>::update_active_()
+{
+    active_.clear();
+    active_gains_.clear();
+    total_gain_ = (TSample)0.0;
+
+    for (std::size_t h = 0; h < harmonics_state_.size(); h++)
+    {
+        total_gain_ += harmonics_state_[h].gain;
+        slots_[h] = -1;
+
+        if (gains_[h] != (TSample)0.0)
+        {
+            slots_[h] = active_.size();
+            active_.push_back(h);
+            active_gains_.push_back(gains_[h]);
+        }
+    }
+
+    active_synced_ = true;
+    rotators_synced_ = false;
+
+    if (evaluation_ == AddEvaluation::rotator)
+    {
+        update_rotator_steps_();
+    }
+}
+
+// Each partial is a complex phasor exp(i theta), advanced once per sample by
+// exp(i delta). Every rotator_resync_ samples (and whenever phases or the
+// active partials change) the phasors are rebuilt from the phase
+// accumulators, which removes both the amplitude and the phase drift of the
+// recursion.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void AddOsc<TSample>::sync_rotators_()
+{
+    const TSample clock = (TSample)partial_clock_;
+
+    for (std::size_t a = 0; a < active_.size(); a++)
+    {
+        const int h = active_[a];
+        TSample cycles = partial_bases_[h] + partial_steps_[h] * clock;
+        TSample angle = (cycles - std::floor(cycles)) * double_pi_;
+        rotator_cos_[a] = std::cos(angle);
+        rotator_sin_[a] = std::sin(angle);
+    }
+
+    rotators_synced_ = true;
+    rotator_countdown_ = rotator_resync_;
+}
+
+// Frames of spectral_size_ samples, windowed with a periodic Hann window
+// and overlapped by half, are built in the frequency domain: every partial
+// adds the closed-form Hann window transform, truncated to spectral_bins_
+// bins around its centre, to the spectrum of the analytic signal, whose
+// real part is the frame. The kernel is evaluated in double precision
+// because of the removable 0/0 points at the window's zero crossings.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void AddOsc<TSample>::synthesize_frame_(const int &offset)
+{
+    const double size = (double)spectral_size_;
+    const double bin_angle = M_PI / size;
+    const std::complex<double> bin_step = -std::polar(1.0, bin_angle);
+    const std::complex<double> lower_shift = std::polar(0.25, -bin_angle);
+    const std::complex<double> upper_shift = std::polar(0.25, bin_angle);
+    const double bin_cos = std::cos(bin_angle);
+    const double bin_sin = std::sin(bin_angle);
+
+    std::fill(spectrum_.begin(), spectrum_.end(), std::complex<double>(0.0, 0.0));
+
+    for (std::size_t a = 0; a < active_.size(); a++)
+    {
+        const int h = active_[a];
+        const double omega = 2.0 * M_PI * (double)partial_steps_[h];
+        const double cycles = (double)partial_bases_[h] + (double)partial_steps_[h] * (double)((int)partial_clock_ + offset);
+        const std::complex<double> amplitude = std::polar((double)active_gains_[a], 2.0 * M_PI * (cycles - std::floor(cycles)));
+
+        const int first_bin = (int)std::lround(omega * size / (2.0 * M_PI)) - spectral_bins_;
+        const double first_half_angle = bin_angle * (double)first_bin - omega * 0.5;
+        const double numerator = std::sin(size * omega * 0.5);
+
+        double half_sin = std::sin(first_half_angle);
+        double half_cos = std::cos(first_half_angle);
+        double kernel_sin = first_bin % 2 ? numerator : -numerator;
+        std::complex<double> kernel_phase = std::polar(1.0, -first_half_angle * (size - 1.0));
+
+        for (auto b = 0; b <= 2 * spectral_bins_; b++)
+        {
+            const double lower_sin = half_sin * bin_cos - half_cos * bin_sin;
+            const double upper_sin = half_sin * bin_cos + half_cos * bin_sin;
+
+            const double centre = std::abs(half_sin) < 1e-9 ? size : kernel_sin / half_sin;
+            const double lower = std::abs(lower_sin) < 1e-9 ? -size : kernel_sin / lower_sin;
+            const double upper = std::abs(upper_sin) < 1e-9 ? -size : kernel_sin / upper_sin;
+
+            const std::complex<double> kernel = kernel_phase * (0.5 * centre - lower_shift * lower - upper_shift * upper);
+
+            int bin = (first_bin + b) % (int)spectral_size_;
+            if (bin < 0)
+            {
+                bin += spectral_size_;
+            }
+            spectrum_[bin] += amplitude * kernel;
+
+            const double half_sin_next = half_sin * bin_cos + half_cos * bin_sin;
+            half_cos = half_cos * bin_cos - half_sin * bin_sin;
+            half_sin = half_sin_next;
+            kernel_sin = -kernel_sin;
+            kernel_phase *= bin_step;
+        }
+    }
+
+    ifft(spectrum_);
+
+    for (unsigned int n = 0; n < spectral_hop_; n++)
+    {
+        spectral_out_[n] = spectral_tail_[n] + (TSample)spectrum_[n].real();
+        spectral_tail_[n] = (TSample)spectrum_[n + spectral_hop_].real();
+    }
+}
+
+}
+
+#endif // ADDOSC_H_
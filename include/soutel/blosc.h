@@ -1,261 +1,996 @@
-/******************************************************************************
-Copyright (c) 2023-2026 Valerio Orlandini
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-******************************************************************************/
-
-
-#ifndef BLOSC_H_
-#define BLOSC_H_
-
-#include <algorithm>
-#include <cmath>
-
-#if __cplusplus >= 202002L
-#include<concepts>
-#endif
-
-namespace soutel
-{
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
-
-enum class BLWaveforms
-{
-    sine,
-    triangle,
-    saw,
-    square
-};
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-class BLOsc
-{
-public:
-    BLOsc(const TSample &sample_rate = (TSample)44100.0,
-          const TSample &frequency = (TSample)0.0);
-
-    void set_sample_rate(const TSample &sample_rate);
-    void set_frequency(const TSample &frequency);
-    void reset();
-
-    TSample get_sample_rate();
-    TSample get_frequency();
-
-    inline bool run();
-    inline bool run(TSample &sine_out, TSample &triangle_out, TSample &saw_out,
-                    TSample &square_out);
-
-    inline void get_last_sample(TSample &sine_out, TSample &triangle_out,
-                                TSample &saw_out, TSample &square_out);
-
-    inline TSample get_sine()
-    {
-        return sine_out_;
-    }
-
-    inline TSample get_triangle()
-    {
-        return triangle_out_;
-    }
-
-    inline TSample get_saw()
-    {
-        return saw_out_;
-    }
-
-    inline TSample get_square()
-    {
-        return square_out_;
-    }
-
-private:
-    TSample sample_rate_;
-    TSample inv_sample_rate_;
-    TSample half_sample_rate_;
-
-    TSample frequency_;
-
-    TSample step_;
-    TSample ramp_;
-
-    TSample harmonics_;
-
-    TSample saw_out_;
-    TSample sine_out_;
-    TSample triangle_out_;
-    TSample square_out_;
-
-    static constexpr TSample double_pi_ = (TSample)(M_PI * 2.0);
-};
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-BLOsc<TSample>::BLOsc(const TSample &sample_rate, const TSample &frequency)
-{
-    frequency_ = frequency;
-
-    set_sample_rate(sample_rate);
-
-    reset();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void BLOsc<TSample>::set_sample_rate(const TSample &sample_rate)
-{
-    sample_rate_ = std::max((TSample)1.0, sample_rate);
-    half_sample_rate_ = sample_rate_ * (TSample)0.5;
-    inv_sample_rate_ = (TSample)1.0 / sample_rate_;
-
-    set_frequency(frequency_);
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void BLOsc<TSample>::set_frequency(const TSample &frequency)
-{
-    frequency_ = std::clamp(frequency, half_sample_rate_ * (TSample)-0.999, half_sample_rate_ * (TSample)0.999);
-
-    step_ = frequency_ * inv_sample_rate_;
-
-    if (frequency != (TSample)0.0)
-    {
-        harmonics_ = std::min((TSample)30.0, std::floor(half_sample_rate_ / std::abs(frequency_)));
-    }
-    else
-    {
-        harmonics_ = (TSample)0.0;
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void BLOsc<TSample>::reset()
-{
-    ramp_ = (TSample)0.0;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-TSample BLOsc<TSample>::get_sample_rate()
-{
-    return sample_rate_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-TSample BLOsc<TSample>::get_frequency()
-{
-    return frequency_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline bool BLOsc<TSample>::run()
-{
-    bool new_cycle = false;
-
-    ramp_ += step_;
-    if (ramp_ > (TSample)1.0)
-    {
-        while (ramp_ > (TSample)1.0)
-        {
-            ramp_ -=  (TSample)1.0;
-        }
-
-        new_cycle = true;
-    }
-
-    sine_out_ = std::sin(ramp_ * double_pi_);
-
-    saw_out_ = (TSample)0.0;
-    square_out_ = (TSample)0.0;
-    triangle_out_ = (TSample)0.0;
-
-    TSample ramp_double_pi = ramp_ * double_pi_;
-    for (TSample harmonic = (TSample)1.0; harmonic <= harmonics_; harmonic++)
-    {
-        saw_out_ += std::sin(-ramp_double_pi * harmonic) / harmonic;
-        if (static_cast<unsigned int>(harmonic) % 2)
-            if ((unsigned int)harmonic % 2)
-            {
-                square_out_ += std::sin(ramp_double_pi * harmonic) / harmonic;
-                triangle_out_ += std::cos(ramp_double_pi * harmonic) / (harmonic * harmonic);
-            }
-    }
-
-    saw_out_ *= (TSample)0.55;
-    square_out_ *= (TSample)1.07;
-    triangle_out_ *= (TSample)0.82;
-
-    return new_cycle;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline bool BLOsc<TSample>::run(TSample &sine_out, TSample &triangle_out,
-                                TSample &saw_out, TSample &square_out)
-{
-    bool new_cycle = run();
-
-    get_last_sample(sine_out, triangle_out, saw_out, square_out);
-
-    return new_cycle;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline void BLOsc<TSample>::get_last_sample(TSample &sine_out,
-        TSample &triangle_out,
-        TSample &saw_out,
-        TSample &square_out)
-{
-    saw_out = saw_out_;
-    sine_out = sine_out_;
-    triangle_out = triangle_out_;
-    square_out = square_out_;
-}
-
-}
-
+/******************************************************************************
+Copyright (c) 2023-2026 Valerio Orlandini
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef BLOSC_H_
+#define BLOSC_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#if __cplusplus >= 202002L
+#include<concepts>
+#endif
+
+namespace soutel
+{
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+enum class BLWaveforms
+{
+    sine,
+    triangle,
+    saw,
+    square
+};
+
+// additive sums the harmonics one by one. closedform integrates a band
+// limited impulse train and costs the same whatever the number of
+// harmonics, but it does not match the additive output exactly: the saw and
+// square stay within about 0.013 and 0.017 of it and the triangle within
+// about 0.05 (1 to 5% of full scale), and harmonic h leads by about
+// 0.01 / h radians because of the integrator leak.
+enum class BLEvaluation
+{
+    additive,
+    closedform
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class BLOsc
+{
+public:
+    BLOsc(const TSample &sample_rate = (TSample)44100.0,
+          const TSample &frequency = (TSample)0.0,
+          const BLEvaluation &evaluation = BLEvaluation::additive);
+
+    void set_sample_rate(const TSample &sample_rate);
+    void set_frequency(const TSample &frequency);
+    void set_evaluation(const BLEvaluation &evaluation);
+    void reset();
+
+    TSample get_sample_rate();
+    TSample get_frequency();
+    BLEvaluation get_evaluation();
+
+    inline bool run();
+    inline bool run(TSample &sine_out, TSample &triangle_out, TSample &saw_out,
+                    TSample &square_out);
+
+    inline void get_last_sample(TSample &sine_out, TSample &triangle_out,
+                                TSample &saw_out, TSample &square_out);
+
+    inline TSample get_sine()
+    {
+        return sine_out_;
+    }
+
+    inline TSample get_triangle()
+    {
+        return triangle_out_;
+    }
+
+    inline TSample get_saw()
+    {
+        return saw_out_;
+    }
+
+    inline TSample get_square()
+    {
+        return square_out_;
+    }
+
+private:
+    TSample sample_rate_;
+    TSample inv_sample_rate_;
+    TSample half_sample_rate_;
+
+    TSample frequency_;
+
+    TSample step_;
+    double ramp_;
+
+    TSample harmonics_;
+
+    BLEvaluation evaluation_ = BLEvaluation::additive;
+    bool integrators_synced_ = false;
+    int closed_form_harmonics_ = -1;
+    int integrated_harmonics_ = 0;
+    int even_harmonics_;
+    double leak_;
+    TSample saw_curvature_;
+    TSample even_curvature_;
+    double saw_sum_;
+    double even_sum_;
+    double triangle_sum_;
+    double square_sum_;
+    TSample saw_kernel_;
+    TSample even_kernel_;
+
+    std::array<TSample, 3> rotator_multiplier_;
+    std::array<double, 3> rotator_sin_;
+    std::array<double, 3> rotator_cos_;
+    std::array<double, 3> rotator_step_sin_;
+    std::array<double, 3> rotator_step_cos_;
+    std::array<double, 3> rotator_half_sin_;
+    std::array<double, 3> rotator_half_cos_;
+    unsigned int rotator_countdown_ = 0;
+
+    TSample saw_out_;
+    TSample sine_out_;
+    TSample triangle_out_;
+    TSample square_out_;
+
+    static constexpr TSample double_pi_ = (TSample)(M_PI * 2.0);
+    static constexpr TSample mid_weight_ = (TSample)(2.0 / M_PI);
+    static constexpr TSample leak_rate_ = (TSample)0.01;
+    static constexpr unsigned int rotator_resync_ = 64;
+
+    inline void update_closed_form_();
+    inline void run_additive_();
+    inline void run_closed_form_();
+    inline void sync_integrators_(const TSample &ramp);
+    inline void integrate_harmonics_(const TSample &ramp, const int &first, const int &last, const double &sign);
+    inline TSample dirichlet_(const TSample &numerator, const TSample &denominator,
+                              const TSample &angle, const int &harmonics, const TSample &curvature);
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+BLOsc<TSample>::BLOsc(const TSample &sample_rate, const TSample &frequency, const BLEvaluation &evaluation)
+{
+    frequency_ = frequency;
+
+    set_sample_rate(sample_rate);
+
+    set_evaluation(evaluation);
+
+    reset();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOsc<TSample>::set_sample_rate(const TSample &sample_rate)
+{
+    sample_rate_ = std::max((TSample)1.0, sample_rate);
+    half_sample_rate_ = sample_rate_ * (TSample)0.5;
+    inv_sample_rate_ = (TSample)1.0 / sample_rate_;
+
+    set_frequency(frequency_);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOsc<TSample>::set_frequency(const TSample &frequency)
+{
+    frequency_ = std::clamp(frequency, half_sample_rate_ * (TSample)-0.999, half_sample_rate_ * (TSample)0.999);
+
+    step_ = frequency_ * inv_sample_rate_;
+
+    if (frequency != (TSample)0.0)
+    {
+        harmonics_ = std::min((TSample)30.0, std::floor(half_sample_rate_ / std::abs(frequency_)));
+    }
+    else
+    {
+        harmonics_ = (TSample)0.0;
+    }
+
+    if (evaluation_ == BLEvaluation::closedform)
+    {
+        update_closed_form_();
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOsc<TSample>::update_closed_form_()
+{
+    int harmonics = (int)harmonics_;
+
+    if (harmonics != closed_form_harmonics_)
+    {
+        closed_form_harmonics_ = harmonics;
+        even_harmonics_ = harmonics / 2;
+        saw_curvature_ = (TSample)(harmonics * (harmonics + 1) * (2 * harmonics + 1)) / (TSample)12.0;
+        even_curvature_ = (TSample)(even_harmonics_ * (even_harmonics_ + 1) * (2 * even_harmonics_ + 1)) / (TSample)12.0;
+    }
+
+    leak_ = 1.0 - (double)(leak_rate_ * std::abs(step_) * double_pi_);
+
+    rotator_multiplier_ = {(TSample)0.5, harmonics_ + (TSample)0.5, (TSample)(2 * even_harmonics_ + 1)};
+    for (auto r = 0; r < 3; r++)
+    {
+        double rotation = (double)rotator_multiplier_[r] * (double)step_ * M_PI * 2.0;
+        rotator_step_sin_[r] = std::sin(rotation);
+        rotator_step_cos_[r] = std::cos(rotation);
+        rotator_half_sin_[r] = std::sin(rotation * 0.5);
+        rotator_half_cos_[r] = std::cos(rotation * 0.5);
+    }
+
+    rotator_countdown_ = 0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOsc<TSample>::set_evaluation(const BLEvaluation &evaluation)
+{
+    evaluation_ = evaluation;
+
+    if (evaluation_ == BLEvaluation::closedform)
+    {
+        update_closed_form_();
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOsc<TSample>::reset()
+{
+    ramp_ = (TSample)0.0;
+    integrators_synced_ = false;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample BLOsc<TSample>::get_sample_rate()
+{
+    return sample_rate_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample BLOsc<TSample>::get_frequency()
+{
+    return frequency_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+BLEvaluation BLOsc<TSample>::get_evaluation()
+{
+    return evaluation_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline bool BLOsc<TSample>::run()
+{
+    bool new_cycle = false;
+
+    TSample last_ramp = (TSample)ramp_;
+    ramp_ += step_;
+    if (ramp_ > (TSample)1.0)
+    {
+        while (ramp_ > (TSample)1.0)
+        {
+            ramp_ -=  (TSample)1.0;
+        }
+
+        new_cycle = true;
+    }
+    else if (ramp_ < (TSample)0.0)
+    {
+        while (ramp_ < (TSample)0.0)
+        {
+            ramp_ +=  (TSample)1.0;
+        }
+
+        new_cycle = true;
+    }
+
+    if (evaluation_ == BLEvaluation::closedform)
+    {
+        if (!integrators_synced_ || integrated_harmonics_ != closed_form_harmonics_)
+        {
+            sync_integrators_(last_ramp);
+        }
+
+        run_closed_form_();
+    }
+    else
+    {
+        run_additive_();
+        integrators_synced_ = false;
+    }
+
+    saw_out_ *= (TSample)0.55;
+    square_out_ *= (TSample)1.07;
+    triangle_out_ *= (TSample)0.82;
+
+    return new_cycle;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOsc<TSample>::run_additive_()
+{
+    TSample ramp_double_pi = (TSample)(ramp_ * M_PI * 2.0);
+    TSample sin_1 = std::sin(ramp_double_pi);
+    TSample cos_1 = std::cos(ramp_double_pi);
+
+    sine_out_ = sin_1;
+
+    saw_out_ = (TSample)0.0;
+    square_out_ = (TSample)0.0;
+    triangle_out_ = (TSample)0.0;
+
+    TSample sin_h = sin_1;
+    TSample cos_h = cos_1;
+    for (TSample harmonic = (TSample)1.0; harmonic <= harmonics_; harmonic++)
+    {
+        saw_out_ -= sin_h / harmonic;
+        if ((unsigned int)harmonic % 2)
+        {
+            square_out_ += sin_h / harmonic;
+            triangle_out_ += cos_h / (harmonic * harmonic);
+        }
+
+        TSample sin_next = sin_h * cos_1 + cos_h * sin_1;
+        cos_h = cos_h * cos_1 - sin_h * sin_1;
+        sin_h = sin_next;
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample BLOsc<TSample>::dirichlet_(const TSample &numerator, const TSample &denominator,
+        const TSample &angle, const int &harmonics, const TSample &curvature)
+{
+    if (std::abs(denominator) < (TSample)0.001)
+    {
+        TSample distance = std::remainder(angle, double_pi_);
+        return (TSample)harmonics - distance * distance * curvature;
+    }
+
+    return numerator / ((TSample)2.0 * denominator) - (TSample)0.5;
+}
+
+// The integrators start from their own steady state, harmonic by harmonic,
+// rather than from the exact sums: a leaky integrator started anywhere else
+// carries an offset that only fades with the leak, and the triangle would
+// integrate the one in the square. When the number of harmonics changes,
+// only the harmonics that enter or leave are added to or removed from the
+// sums, so a sweep costs one or two harmonics per change whatever their
+// count; a full sync happens on reset and when switching evaluation.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOsc<TSample>::sync_integrators_(const TSample &ramp)
+{
+    TSample ramp_double_pi = ramp * double_pi_;
+
+    if (!integrators_synced_)
+    {
+        saw_sum_ = 0.0;
+        even_sum_ = 0.0;
+        triangle_sum_ = 0.0;
+        integrated_harmonics_ = 0;
+    }
+
+    if (closed_form_harmonics_ > integrated_harmonics_)
+    {
+        integrate_harmonics_(ramp, integrated_harmonics_ + 1, closed_form_harmonics_, 1.0);
+    }
+    else
+    {
+        integrate_harmonics_(ramp, closed_form_harmonics_ + 1, integrated_harmonics_, -1.0);
+    }
+    integrated_harmonics_ = closed_form_harmonics_;
+
+    square_sum_ = saw_sum_ - 0.5 * even_sum_;
+    saw_kernel_ = dirichlet_(std::sin((harmonics_ + (TSample)0.5) * ramp_double_pi), std::sin(ramp_double_pi * (TSample)0.5),
+                             ramp_double_pi, (int)harmonics_, saw_curvature_);
+    even_kernel_ = dirichlet_(std::sin((TSample)(2 * even_harmonics_ + 1) * ramp_double_pi), std::sin(ramp_double_pi),
+                              (TSample)2.0 * ramp_double_pi, even_harmonics_, even_curvature_);
+
+    integrators_synced_ = true;
+}
+
+// Steady state of harmonics first to last, added to the sums with the given
+// sign. With x = h theta_step / 2, harmonic h of the kernel enters the saw
+// integrator as theta_step (2 / pi + (1 - 2 / pi) cos x) cos(h theta - x)
+// per sample.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOsc<TSample>::integrate_harmonics_(const TSample &ramp, const int &first, const int &last, const double &sign)
+{
+    TSample ramp_double_pi = ramp * double_pi_;
+    TSample delta = step_ * double_pi_;
+    TSample delta_pi = delta / (TSample)M_PI;
+
+    for (int h = first; h <= last; h++)
+    {
+        TSample harmonic = (TSample)h;
+        TSample x = harmonic * delta * (TSample)0.5;
+        std::complex<TSample> phase = std::polar((TSample)1.0, harmonic * ramp_double_pi);
+        std::complex<TSample> back = std::polar((TSample)1.0, (TSample)-2.0 * x);
+        std::complex<TSample> response = (TSample)1.0 / ((TSample)1.0 - (TSample)leak_ * back);
+
+        TSample input = delta * (mid_weight_ + ((TSample)1.0 - mid_weight_) * std::cos(x));
+        std::complex<TSample> sum = input * std::polar((TSample)1.0, -x) * response;
+
+        saw_sum_ += sign * std::real(sum * phase);
+
+        if (h % 2)
+        {
+            std::complex<TSample> slope = -delta * (TSample)0.5 * sum * ((TSample)1.0 + back) +
+                                          delta_pi * delta_pi * ((TSample)1.0 - back);
+            triangle_sum_ += sign * std::real(slope * response * phase);
+        }
+        else
+        {
+            even_sum_ += sign * 2.0 * std::real(sum * phase);
+        }
+    }
+}
+
+// A leaky integrated BLIT. The saw is the integral of the Dirichlet kernel
+// D_N(theta) = sin((N + 1/2) theta) / (2 sin(theta / 2)) - 1/2, a closed
+// form band limited impulse train, and the square is the saw minus half of
+// its own even harmonics, i.e. a second kernel D_N/2 running at 2 theta.
+// Each step blends the kernel at the midpoint and at both ends with weight
+// 2 / pi, which keeps every harmonic up to Nyquist within about 1% of its
+// additive amplitude (exact at Nyquist). The triangle is the integral of
+// the square, trapezoidal plus an end point derivative term that is exact
+// at Nyquist, within about 4%. The integrators leak by leak_rate_ of the
+// phase increment per sample, so offsets left by frequency changes or
+// rounding fade out within a few tens of cycles, at any frequency, at the
+// cost of a phase lead of about leak_rate_ / h radians on harmonic h.
+// The kernel sines (theta / 2, (N + 1/2) theta, (2 N/2 + 1) theta) are
+// advanced by rotation and recomputed every rotator_resync_ samples. The
+// phase, the rotators and the sums are kept in double precision whatever
+// TSample is: any bias in what the integrators receive comes out divided by
+// the leak, and the triangle divides the one of the square once more.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOsc<TSample>::run_closed_form_()
+{
+    TSample ramp_double_pi = (TSample)(ramp_ * M_PI * 2.0);
+    TSample delta = step_ * double_pi_;
+    TSample mid_ramp_double_pi = ramp_double_pi - delta * (TSample)0.5;
+
+    std::array<double, 3> mid_sin;
+    std::array<double, 3> mid_cos;
+
+    if (rotator_countdown_ == 0)
+    {
+        for (auto r = 0; r < 3; r++)
+        {
+            rotator_sin_[r] = std::sin((double)rotator_multiplier_[r] * (double)ramp_double_pi);
+            rotator_cos_[r] = std::cos((double)rotator_multiplier_[r] * (double)ramp_double_pi);
+        }
+
+        rotator_countdown_ = rotator_resync_;
+    }
+    else
+    {
+        for (auto r = 0; r < 3; r++)
+        {
+            double sin_next = rotator_sin_[r] * rotator_step_cos_[r] + rotator_cos_[r] * rotator_step_sin_[r];
+            rotator_cos_[r] = rotator_cos_[r] * rotator_step_cos_[r] - rotator_sin_[r] * rotator_step_sin_[r];
+            rotator_sin_[r] = sin_next;
+        }
+    }
+    rotator_countdown_--;
+
+    for (auto r = 0; r < 3; r++)
+    {
+        mid_sin[r] = rotator_sin_[r] * rotator_half_cos_[r] - rotator_cos_[r] * rotator_half_sin_[r];
+        mid_cos[r] = rotator_cos_[r] * rotator_half_cos_[r] + rotator_sin_[r] * rotator_half_sin_[r];
+    }
+
+    TSample sine = (TSample)(2.0 * rotator_sin_[0] * rotator_cos_[0]);
+    TSample mid_sine = (TSample)(2.0 * mid_sin[0] * mid_cos[0]);
+
+    int harmonics = (int)harmonics_;
+    TSample saw_kernel = dirichlet_((TSample)rotator_sin_[1], (TSample)rotator_sin_[0], ramp_double_pi, harmonics, saw_curvature_);
+    TSample saw_mid_kernel = dirichlet_((TSample)mid_sin[1], (TSample)mid_sin[0], mid_ramp_double_pi, harmonics, saw_curvature_);
+    TSample even_kernel = dirichlet_((TSample)rotator_sin_[2], sine, (TSample)2.0 * ramp_double_pi, even_harmonics_, even_curvature_);
+    TSample even_mid_kernel = dirichlet_((TSample)mid_sin[2], mid_sine, (TSample)2.0 * mid_ramp_double_pi, even_harmonics_, even_curvature_);
+
+    const TSample end_weight = ((TSample)1.0 - mid_weight_) * (TSample)0.5;
+
+    saw_sum_ = leak_ * saw_sum_ + (double)((mid_weight_ * saw_mid_kernel + end_weight * (saw_kernel_ + saw_kernel)) * delta);
+    even_sum_ = leak_ * even_sum_ + (double)((mid_weight_ * even_mid_kernel + end_weight * (even_kernel_ + even_kernel)) * (TSample)2.0 * delta);
+
+    double square_sum = saw_sum_ - 0.5 * even_sum_;
+    TSample square_slope = (saw_kernel - even_kernel) - (saw_kernel_ - even_kernel_);
+    TSample delta_pi = delta / (TSample)M_PI;
+
+    triangle_sum_ = leak_ * triangle_sum_ - (square_sum_ + square_sum) * 0.5 * (double)delta + (double)(delta_pi * delta_pi * square_slope);
+
+    square_sum_ = square_sum;
+    saw_kernel_ = saw_kernel;
+    even_kernel_ = even_kernel;
+
+    sine_out_ = sine;
+    saw_out_ = (TSample)-saw_sum_;
+    square_out_ = (TSample)square_sum_;
+    triangle_out_ = (TSample)triangle_sum_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline bool BLOsc<TSample>::run(TSample &sine_out, TSample &triangle_out,
+                                TSample &saw_out, TSample &square_out)
+{
+    bool new_cycle = run();
+
+    get_last_sample(sine_out, triangle_out, saw_out, square_out);
+
+    return new_cycle;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOsc<TSample>::get_last_sample(TSample &sine_out,
+        TSample &triangle_out,
+        TSample &saw_out,
+        TSample &square_out)
+{
+    saw_out = saw_out_;
+    sine_out = sine_out_;
+    triangle_out = triangle_out_;
+    square_out = square_out_;
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class BLOscBank
+{
+    static_assert(Voices > 0, "a BLOscBank needs at least one voice");
+
+public:
+    BLOscBank(const TSample &sample_rate = (TSample)44100.0,
+              const BLWaveforms &waveform = BLWaveforms::saw);
+
+    void set_sample_rate(const TSample &sample_rate);
+    void set_frequency(const unsigned int &voice, const TSample &frequency);
+    void set_waveform(const BLWaveforms &waveform);
+    void reset();
+    void reset(const unsigned int &voice);
+
+    TSample get_sample_rate();
+    TSample get_frequency(const unsigned int &voice);
+    BLWaveforms get_waveform();
+
+    inline TSample run();
+    inline void run(std::array<TSample, Voices> &outputs);
+    inline void run_block(std::vector<TSample> &output);
+    inline void run_block(std::array<std::vector<TSample>, Voices> &outputs);
+
+    inline std::array<TSample, Voices> get_last_sample()
+    {
+        return outputs_;
+    }
+
+private:
+    TSample sample_rate_;
+    TSample inv_sample_rate_;
+    TSample half_sample_rate_;
+
+    BLWaveforms waveform_;
+
+    std::array<TSample, Voices> frequency_;
+    std::array<TSample, Voices> step_;
+    std::array<TSample, Voices> ramp_;
+    std::array<int, Voices> harmonics_;
+
+    std::array<unsigned int, Voices> order_;
+    std::array<unsigned int, 31> active_;
+    bool sort_voices_ = true;
+
+    std::array<TSample, Voices> sin_1_;
+    std::array<TSample, Voices> cos_1_;
+    std::array<TSample, Voices> sin_step_;
+    std::array<TSample, Voices> cos_step_;
+    std::array<TSample, Voices> sin_h_;
+    std::array<TSample, Voices> cos_h_;
+    std::array<TSample, Voices> sorted_out_;
+    std::array<TSample, Voices> outputs_;
+
+    static constexpr TSample double_pi_ = (TSample)(M_PI * 2.0);
+
+    inline void sort_voices_by_harmonics_();
+    inline void render_();
+};
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+BLOscBank<TSample, Voices>::BLOscBank(const TSample &sample_rate, const BLWaveforms &waveform)
+{
+    frequency_.fill((TSample)0.0);
+    harmonics_.fill(0);
+    outputs_.fill((TSample)0.0);
+
+    set_sample_rate(sample_rate);
+    set_waveform(waveform);
+
+    reset();
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOscBank<TSample, Voices>::set_sample_rate(const TSample &sample_rate)
+{
+    sample_rate_ = std::max((TSample)1.0, sample_rate);
+    half_sample_rate_ = sample_rate_ * (TSample)0.5;
+    inv_sample_rate_ = (TSample)1.0 / sample_rate_;
+
+    for (unsigned int v = 0; v < Voices; v++)
+    {
+        set_frequency(v, frequency_[v]);
+    }
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOscBank<TSample, Voices>::set_frequency(const unsigned int &voice, const TSample &frequency)
+{
+    if (voice >= Voices)
+    {
+        return;
+    }
+
+    frequency_[voice] = std::clamp(frequency, half_sample_rate_ * (TSample)-0.999, half_sample_rate_ * (TSample)0.999);
+
+    step_[voice] = frequency_[voice] * inv_sample_rate_;
+
+    int harmonics = 0;
+    if (frequency != (TSample)0.0)
+    {
+        harmonics = (int)std::min((TSample)30.0, std::floor(half_sample_rate_ / std::abs(frequency_[voice])));
+    }
+
+    if (harmonics != harmonics_[voice])
+    {
+        harmonics_[voice] = harmonics;
+        sort_voices_ = true;
+    }
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOscBank<TSample, Voices>::set_waveform(const BLWaveforms &waveform)
+{
+    waveform_ = waveform;
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOscBank<TSample, Voices>::reset()
+{
+    ramp_.fill((TSample)0.0);
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void BLOscBank<TSample, Voices>::reset(const unsigned int &voice)
+{
+    if (voice < Voices)
+    {
+        ramp_[voice] = (TSample)0.0;
+    }
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample BLOscBank<TSample, Voices>::get_sample_rate()
+{
+    return sample_rate_;
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample BLOscBank<TSample, Voices>::get_frequency(const unsigned int &voice)
+{
+    if (voice < Voices)
+    {
+        return frequency_[voice];
+    }
+
+    return (TSample)0.0;
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+BLWaveforms BLOscBank<TSample, Voices>::get_waveform()
+{
+    return waveform_;
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOscBank<TSample, Voices>::sort_voices_by_harmonics_()
+{
+    std::array<unsigned int, 31> first;
+    first.fill(0u);
+
+    for (unsigned int v = 0; v < Voices; v++)
+    {
+        first[harmonics_[v]]++;
+    }
+
+    unsigned int voices = 0;
+    for (int h = 30; h >= 0; h--)
+    {
+        unsigned int count = first[h];
+        first[h] = voices;
+        voices += count;
+        active_[h] = voices;
+    }
+
+    for (unsigned int v = 0; v < Voices; v++)
+    {
+        order_[first[harmonics_[v]]++] = v;
+    }
+
+    sort_voices_ = false;
+}
+
+// Voices are kept sorted by descending harmonic count, so that for every
+// harmonic the voices still contributing to it are the first active_[h]
+// lanes and the inner loops run without gaps. The sort is a counting sort
+// on the harmonic count (0 to 30), in place and without allocations, and
+// active_[h] is the number of voices with at least h harmonics.
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOscBank<TSample, Voices>::render_()
+{
+    if (sort_voices_)
+    {
+        sort_voices_by_harmonics_();
+    }
+
+    for (unsigned int v = 0; v < Voices; v++)
+    {
+        ramp_[v] += step_[v];
+        if (ramp_[v] > (TSample)1.0 || ramp_[v] < (TSample)0.0)
+        {
+            ramp_[v] -= std::floor(ramp_[v]);
+        }
+    }
+
+    for (unsigned int i = 0; i < Voices; i++)
+    {
+        TSample ramp_double_pi = ramp_[order_[i]] * double_pi_;
+        sin_1_[i] = std::sin(ramp_double_pi);
+        cos_1_[i] = std::cos(ramp_double_pi);
+    }
+
+    if (waveform_ == BLWaveforms::sine)
+    {
+        for (unsigned int i = 0; i < Voices; i++)
+        {
+            outputs_[order_[i]] = sin_1_[i];
+        }
+
+        return;
+    }
+
+    int harmonic_step = waveform_ == BLWaveforms::saw ? 1 : 2;
+
+    for (unsigned int i = 0; i < Voices; i++)
+    {
+        if (harmonic_step == 1)
+        {
+            sin_step_[i] = sin_1_[i];
+            cos_step_[i] = cos_1_[i];
+        }
+        else
+        {
+            sin_step_[i] = (TSample)2.0 * sin_1_[i] * cos_1_[i];
+            cos_step_[i] = cos_1_[i] * cos_1_[i] - sin_1_[i] * sin_1_[i];
+        }
+
+        sin_h_[i] = sin_1_[i];
+        cos_h_[i] = cos_1_[i];
+        sorted_out_[i] = (TSample)0.0;
+    }
+
+    for (int h = 1; h <= 30 && active_[h] > 0; h += harmonic_step)
+    {
+        const unsigned int lanes = active_[h];
+        const TSample inv_harmonic = (TSample)1.0 / (TSample)h;
+        const TSample inv_harmonic_squared = inv_harmonic * inv_harmonic;
+
+        switch (waveform_)
+        {
+        case BLWaveforms::saw:
+            for (unsigned int i = 0; i < lanes; i++)
+            {
+                sorted_out_[i] -= sin_h_[i] * inv_harmonic;
+            }
+            break;
+        case BLWaveforms::square:
+            for (unsigned int i = 0; i < lanes; i++)
+            {
+                sorted_out_[i] += sin_h_[i] * inv_harmonic;
+            }
+            break;
+        case BLWaveforms::triangle:
+            for (unsigned int i = 0; i < lanes; i++)
+            {
+                sorted_out_[i] += cos_h_[i] * inv_harmonic_squared;
+            }
+            break;
+        default:
+            break;
+        }
+
+        for (unsigned int i = 0; i < lanes; i++)
+        {
+            TSample sin_next = sin_h_[i] * cos_step_[i] + cos_h_[i] * sin_step_[i];
+            cos_h_[i] = cos_h_[i] * cos_step_[i] - sin_h_[i] * sin_step_[i];
+            sin_h_[i] = sin_next;
+        }
+    }
+
+    TSample gain = (TSample)0.55;
+    if (waveform_ == BLWaveforms::square)
+    {
+        gain = (TSample)1.07;
+    }
+    else if (waveform_ == BLWaveforms::triangle)
+    {
+        gain = (TSample)0.82;
+    }
+
+    for (unsigned int i = 0; i < Voices; i++)
+    {
+        outputs_[order_[i]] = sorted_out_[i] * gain;
+    }
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample BLOscBank<TSample, Voices>::run()
+{
+    render_();
+
+    TSample output = (TSample)0.0;
+    for (unsigned int v = 0; v < Voices; v++)
+    {
+        output += outputs_[v];
+    }
+
+    return output;
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOscBank<TSample, Voices>::run(std::array<TSample, Voices> &outputs)
+{
+    render_();
+
+    outputs = outputs_;
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOscBank<TSample, Voices>::run_block(std::vector<TSample> &output)
+{
+    for (auto &sample : output)
+    {
+        sample = run();
+    }
+}
+
+template <typename TSample, unsigned int Voices>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void BLOscBank<TSample, Voices>::run_block(std::array<std::vector<TSample>, Voices> &outputs)
+{
+    std::size_t block_size = outputs[0].size();
+    for (const auto &output : outputs)
+    {
+        block_size = std::min(block_size, output.size());
+    }
+
+    for (std::size_t s = 0; s < block_size; s++)
+    {
+        render_();
+
+        for (unsigned int v = 0; v < Voices; v++)
+        {
+            outputs[v][s] = outputs_[v];
+        }
+    }
+}
+
+}
+
 #endif // BLOSC_H_
\ No newline at end of file
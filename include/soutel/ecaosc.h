@@ -1,402 +1,1352 @@
-/******************************************************************************
-Copyright (c) 2023-2026 Valerio Orlandini
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-******************************************************************************/
-
-#ifndef ECAOSC_H_
-#define ECAOSC_H_
-
-#include <algorithm>
-#include <array>
-#include <climits>
-#include <random>
-#include <vector>
-
-#if __cplusplus >= 202002L
-#include<concepts>
-#endif
-
-namespace soutel
-{
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-class ECAOsc
-{
-public:
-    ECAOsc(const TSample &sample_rate = (TSample)44100.0,
-           const TSample &frequency = (TSample)1.0,
-           const unsigned int &cells = 32u,
-           const std::array<bool, 8> &rules = {false, true, true, false, true, true, true, false},
-           const bool &randomize_cells = false);
-
-    ECAOsc(const TSample &sample_rate = (TSample)44100.0,
-           const TSample &frequency = (TSample)1.0,
-           const unsigned int &cells = 32u,
-           const uint8_t &rule_number = 110,
-           const bool &randomize_cells = false);
-
-    void set_sample_rate(const TSample &sample_rate);
-    void set_frequency(const TSample &frequency);
-    void set_cells_number(const unsigned int &cells_number, const bool &clear = true);
-    void set_cells_status(const std::vector<bool> &status);
-    void set_cell_status(const bool &status, const unsigned int &cell);
-    void set_rules(const std::array<bool, 8> &rules);
-    void set_rule_number(const uint8_t &rule_number);
-
-    void randomize_status(const TSample &alive_chance = (TSample)0.5);
-
-    std::array<bool, 8> get_rules();
-    uint8_t get_rule_number();
-    std::vector<bool> get_cells();
-
-    TSample get_sample_rate();
-    TSample get_frequency();
-
-    void reset();
-
-    inline TSample run();
-
-    inline TSample get_last_sample();
-
-    inline void step();
-
-    inline TSample cells_to_float();
-
-private:
-    TSample sample_rate_;
-    TSample half_sample_rate_;
-
-    TSample frequency_;
-
-    TSample sample_count_;
-    TSample steps_;
-
-    std::array<bool, 8> rules_;
-    std::vector<bool> cell_status_;
-
-    bool big_endian_;
-
-    std::random_device rd_;
-    std::mt19937 gen_;
-    std::uniform_real_distribution<TSample> rand_dist_;
-
-    TSample current_;
-    TSample next_;
-    TSample output_;
-};
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-ECAOsc<TSample>::ECAOsc(const TSample &sample_rate, const TSample &frequency,
-                        const unsigned int &cells, const std::array<bool, 8> &rules,
-                        const bool &randomize_cells)
-{
-    frequency_ = frequency;
-
-    set_sample_rate(sample_rate);
-
-    set_rules(rules);
-
-    set_cells_number(cells, true);
-
-    gen_.seed(rd_());
-
-    reset();
-
-    if (randomize_cells)
-    {
-        randomize_status();
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-ECAOsc<TSample>::ECAOsc(const TSample &sample_rate, const TSample &frequency,
-                        const unsigned int &cells, const uint8_t &rule_number,
-                        const bool &randomize_cells)
-{
-    frequency_ = frequency;
-
-    set_sample_rate(sample_rate);
-
-    set_rule_number(rule_number);
-
-    set_cells_number(cells, true);
-
-    gen_.seed(rd_());
-
-    reset();
-
-    if (randomize_cells)
-    {
-        randomize_status();
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void ECAOsc<TSample>::set_sample_rate(const TSample &sample_rate)
-{
-    sample_rate_ = std::max((TSample)1.0, sample_rate);
-    half_sample_rate_ = sample_rate_ * (TSample)0.5;
-
-    set_frequency(frequency_);
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void ECAOsc<TSample>::set_frequency(const TSample &frequency)
-{
-    frequency_ = std::clamp(frequency, (TSample)0.001, half_sample_rate_);
-
-    steps_ = ceil(sample_rate_ / frequency_);
-    sample_count_ = (TSample)0.0;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void ECAOsc<TSample>::set_cells_number(const unsigned int &cells_number, const bool &clear)
-{
-    if (clear)
-    {
-        cell_status_.assign(std::max(1u, cells_number), false);
-    }
-    else
-    {
-        cell_status_.resize(std::max(1u, cells_number), false);
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void ECAOsc<TSample>::set_rules(const std::array<bool, 8> &rules)
-{
-    for (int r = 0; r < 8; r++)
-    {
-        rules_[r] = rules[r];
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void ECAOsc<TSample>::set_rule_number(const uint8_t &rule_number)
-{
-    for (int b = 0; b < 8; b++)
-    {
-        rules_[b] = ((rule_number >> b) & 1);
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void ECAOsc<TSample>::set_cells_status(const std::vector<bool> &status)
-{
-    for (int s = 0; s < std::min(status.size(), cell_status_.size()); s++)
-    {
-        set_cell_status(status.at(s), s);
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void ECAOsc<TSample>::set_cell_status(const bool &status, const unsigned int &cell)
-{
-    if (cell < cell_status_.size())
-    {
-        cell_status_.at(cell) = status;
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void ECAOsc<TSample>::randomize_status(const TSample &alive_chance)
-{
-    for (int s = 0; s < cell_status_.size(); s++)
-    {
-        cell_status_.at(s) = (rand_dist_(gen_) <= alive_chance);
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-TSample ECAOsc<TSample>::get_sample_rate()
-{
-    return sample_rate_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-TSample ECAOsc<TSample>::get_frequency()
-{
-    return frequency_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::array<bool, 8> ECAOsc<TSample>::get_rules()
-{
-    return rules_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-uint8_t ECAOsc<TSample>::get_rule_number()
-{
-    char rule_number = 0;
-    for (int r = 0; r < 8; r++)
-    {
-        rule_number += pow(2, rules_[7 - r]);
-    }
-
-    return (uint8_t)rule_number;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::vector<bool> ECAOsc<TSample>::get_cells()
-{
-    return cell_status_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void ECAOsc<TSample>::reset()
-{
-    output_ = (TSample)0.0;
-    current_ = (TSample)0.0;
-    step();
-    next_ = cells_to_float();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline TSample ECAOsc<TSample>::run()
-{
-    ++sample_count_;
-
-    if (sample_count_ > steps_)
-    {
-        current_ = next_;
-        step();
-        next_ = cells_to_float();
-        sample_count_ = (TSample)0.0;
-    }
-
-    TSample ratio = sample_count_ / steps_;
-
-    output_ = current_ * ((TSample)1.0 - ratio) + next_ * ratio;
-
-    return output_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline TSample ECAOsc<TSample>::get_last_sample()
-{
-    return output_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline void ECAOsc<TSample>::step()
-{
-    std::vector<bool> next_gen;
-
-    for (int c = 0; c < cell_status_.size(); c++)
-    {
-        unsigned int value = 0;
-        value += (unsigned int)cell_status_.at(std::max(0, c - 1)) * 4;
-        value += (unsigned int)cell_status_.at(c) * 2;
-        value += (unsigned int)cell_status_.at((c + 1) % cell_status_.size());
-
-        next_gen.push_back(rules_[value]);
-    }
-
-    for (int c = 0; c < cell_status_.size(); c++)
-    {
-        cell_status_.at(c) = next_gen.at(c);
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline TSample ECAOsc<TSample>::cells_to_float()
-{
-    TSample output = (TSample)0.0;
-    int bits_TSample = sizeof(TSample) * CHAR_BIT;
-
-    int last_cell = std::min(bits_TSample, (int)cell_status_.size());
-    for (int b = 0; b < last_cell; b++)
-    {
-        if (cell_status_.at(b))
-        {
-            output += pow((TSample)2.0, (TSample)(last_cell - b - 1));
-        }
-    }
-
-    return ((TSample)2.0 * output / (TSample)((1 << last_cell) - 1)) - (TSample)1.0;
-}
-
-}
-
-#endif // ECAOSC_H_
+/******************************************************************************
+Copyright (c) 2023-2026 Valerio Orlandini
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ECAOSC_H_
+#define ECAOSC_H_
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "addosc.h"
+#include "wtosc.h"
+
+#if __cplusplus >= 202002L
+#include <bit>
+#include<concepts>
+#endif
+
+namespace soutel
+{
+
+enum class ECAOutputs
+{
+    number,
+    wavetable,
+    spectrum
+};
+
+// Bitwise form of the 256 elementary rules: entry n of rule r is a word of
+// ones if the neighbourhood n, read as (left, centre, right), gives a live
+// cell, and a word of zeros otherwise.
+constexpr std::array<std::array<uint64_t, 8>, 256> expand_rules()
+{
+    std::array<std::array<uint64_t, 8>, 256> masks{};
+
+    for (std::size_t r = 0; r < 256; r++)
+    {
+        for (std::size_t n = 0; n < 8; n++)
+        {
+            masks[r][n] = ((r >> n) & 1) ? ~(uint64_t)0 : 0;
+        }
+    }
+
+    return masks;
+}
+
+class ECARules
+{
+public:
+    static constexpr std::array<std::array<uint64_t, 8>, 256> masks = expand_rules();
+
+    static inline uint64_t step(const uint8_t &rule_number, const uint64_t *cells, uint64_t *next_cells,
+                                const std::size_t &words, const unsigned int &cells_number);
+    static inline uint64_t apply(const std::array<uint64_t, 8> &rule, const uint64_t &left, const uint64_t &centre, const uint64_t &right);
+    static inline uint64_t reverse_bits(uint64_t word);
+    static inline unsigned int popcount(const uint64_t &word);
+};
+
+// Cells are packed 64 to a word, cell c at bit c % 64 of word c / 64, and a
+// whole word of the next generation is computed at once. The first cell is
+// its own left neighbour and the last one has the first one on its right.
+// A hash of the new generation is returned, computed along the way.
+inline uint64_t ECARules::step(const uint8_t &rule_number, const uint64_t *cells, uint64_t *next_cells,
+                               const std::size_t &words, const unsigned int &cells_number)
+{
+    const std::array<uint64_t, 8> &rule = masks[rule_number];
+    const uint64_t first_cell = cells[0] & 1;
+    const unsigned int last_bit = (cells_number - 1) % 64;
+    const uint64_t last_word_mask = last_bit == 63 ? ~(uint64_t)0 : ((uint64_t)1 << (last_bit + 1)) - 1;
+    uint64_t hash = cells_number;
+
+    for (std::size_t w = 0; w < words; w++)
+    {
+        const uint64_t centre = cells[w];
+        uint64_t left = centre << 1;
+        uint64_t right = centre >> 1;
+
+        left |= w > 0 ? cells[w - 1] >> 63 : first_cell;
+        right |= w + 1 < words ? cells[w + 1] << 63 : first_cell << last_bit;
+
+        uint64_t next = apply(rule, left, centre, right);
+        if (w + 1 == words)
+        {
+            next &= last_word_mask;
+        }
+
+        next_cells[w] = next;
+        hash += (next ^ (next >> 29)) * (0x9E3779B97F4A7C15ULL + 2 * w);
+    }
+
+    return hash;
+}
+
+// The rule is applied as a tree of bitwise multiplexers selecting, for every
+// bit, the output for its neighbourhood.
+inline uint64_t ECARules::apply(const std::array<uint64_t, 8> &rule, const uint64_t &left, const uint64_t &centre, const uint64_t &right)
+{
+    const uint64_t high_high = (right & rule[7]) | (~right & rule[6]);
+    const uint64_t high_low = (right & rule[5]) | (~right & rule[4]);
+    const uint64_t low_high = (right & rule[3]) | (~right & rule[2]);
+    const uint64_t low_low = (right & rule[1]) | (~right & rule[0]);
+
+    const uint64_t high = (centre & high_high) | (~centre & high_low);
+    const uint64_t low = (centre & low_high) | (~centre & low_low);
+
+    return (left & high) | (~left & low);
+}
+
+inline uint64_t ECARules::reverse_bits(uint64_t word)
+{
+    word = ((word >> 1) & 0x5555555555555555ULL) | ((word & 0x5555555555555555ULL) << 1);
+    word = ((word >> 2) & 0x3333333333333333ULL) | ((word & 0x3333333333333333ULL) << 2);
+    word = ((word >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((word & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    word = ((word >> 8) & 0x00FF00FF00FF00FFULL) | ((word & 0x00FF00FF00FF00FFULL) << 8);
+    word = ((word >> 16) & 0x0000FFFF0000FFFFULL) | ((word & 0x0000FFFF0000FFFFULL) << 16);
+
+    return (word >> 32) | (word << 32);
+}
+
+inline unsigned int ECARules::popcount(const uint64_t &word)
+{
+#if __cplusplus >= 202002L
+    return std::popcount(word);
+#else
+    uint64_t count = word - ((word >> 1) & 0x5555555555555555ULL);
+    count = (count & 0x3333333333333333ULL) + ((count >> 2) & 0x3333333333333333ULL);
+    count = (count + (count >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return (unsigned int)((count * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class ECAOsc
+{
+public:
+    ECAOsc(const TSample &sample_rate = (TSample)44100.0,
+           const TSample &frequency = (TSample)1.0,
+           const unsigned int &cells = 32u,
+           const std::array<bool, 8> &rules = {false, true, true, false, true, true, true, false},
+           const bool &randomize_cells = false);
+
+    ECAOsc(const TSample &sample_rate = (TSample)44100.0,
+           const TSample &frequency = (TSample)1.0,
+           const unsigned int &cells = 32u,
+           const uint8_t &rule_number = 110,
+           const bool &randomize_cells = false);
+
+    void set_sample_rate(const TSample &sample_rate);
+    void set_frequency(const TSample &frequency);
+    void set_cells_number(const unsigned int &cells_number, const bool &clear = true);
+    void set_cells_status(const std::vector<bool> &status);
+    void set_cell_status(const bool &status, const unsigned int &cell);
+    void set_rules(const std::array<bool, 8> &rules);
+    void set_rule_number(const uint8_t &rule_number);
+    void set_output(const ECAOutputs &output);
+    void set_pitch(const TSample &pitch);
+    void set_bands(const unsigned int &bands);
+    void set_max_period(const unsigned int &max_period);
+
+    void randomize_status(const TSample &alive_chance = (TSample)0.5);
+
+    std::array<bool, 8> get_rules();
+    uint8_t get_rule_number();
+    std::vector<bool> get_cells();
+
+    TSample get_sample_rate();
+    TSample get_frequency();
+    ECAOutputs get_output();
+    TSample get_pitch();
+    unsigned int get_bands();
+    unsigned int get_max_period();
+    unsigned int get_period();
+
+    void reset();
+
+    inline TSample run();
+
+    inline TSample get_last_sample();
+
+    inline void step();
+
+    inline TSample cells_to_float();
+
+private:
+    TSample sample_rate_;
+    TSample half_sample_rate_;
+
+    TSample frequency_;
+
+    TSample sample_count_;
+    TSample steps_;
+
+    std::array<bool, 8> rules_;
+    uint8_t rule_number_ = 0;
+
+    unsigned int cells_number_ = 0;
+    std::vector<uint64_t> cells_;
+    std::vector<uint64_t> next_cells_;
+    uint64_t last_word_mask_ = 0;
+
+    bool big_endian_;
+
+    std::random_device rd_;
+    std::mt19937 gen_;
+    std::uniform_real_distribution<TSample> rand_dist_;
+
+    TSample current_;
+    TSample next_;
+    TSample output_;
+
+    ECAOutputs output_mode_ = ECAOutputs::number;
+    TSample pitch_ = (TSample)110.0;
+    unsigned int bands_ = 64;
+    std::vector<TSample> frames_;
+    std::vector<TSample> band_gains_;
+    // Built the first time their output is selected, so that the
+    // number output does not carry the reader and the spectral buffers
+    std::unique_ptr<WTScanOsc<TSample>> reader_;
+    std::unique_ptr<AddOsc<TSample>> partials_;
+
+    uint64_t hash_ = 0;
+    std::vector<uint64_t> checkpoint_;
+    uint64_t checkpoint_hash_ = 0;
+    std::vector<TSample> cycle_values_;
+    static constexpr unsigned int max_period_limit_ = 65536;
+    unsigned int max_period_ = 0;
+    unsigned int cycle_power_ = 1;
+    unsigned int period_ = 0;
+    unsigned int cycle_position_ = 0;
+    unsigned int cycle_origin_ = 0;
+
+    inline void step_cells_();
+    inline void advance_();
+    inline void detect_cycle_();
+    inline void sync_cells_();
+    inline void forget_cycle_();
+
+    inline unsigned int count_cells_(unsigned int first, const unsigned int &last);
+    inline void cells_to_bands_(TSample *bands, const unsigned int &count, const bool &bipolar);
+    inline void update_bands_(const bool &restart = false);
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+ECAOsc<TSample>::ECAOsc(const TSample &sample_rate, const TSample &frequency,
+                        const unsigned int &cells, const std::array<bool, 8> &rules,
+                        const bool &randomize_cells)
+{
+    frequency_ = frequency;
+
+    set_sample_rate(sample_rate);
+
+    set_pitch(pitch_);
+
+    set_rules(rules);
+
+    set_cells_number(cells, true);
+
+    set_max_period(1024u);
+
+    gen_.seed(rd_());
+
+    reset();
+
+    if (randomize_cells)
+    {
+        randomize_status();
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+ECAOsc<TSample>::ECAOsc(const TSample &sample_rate, const TSample &frequency,
+                        const unsigned int &cells, const uint8_t &rule_number,
+                        const bool &randomize_cells)
+{
+    frequency_ = frequency;
+
+    set_sample_rate(sample_rate);
+
+    set_pitch(pitch_);
+
+    set_rule_number(rule_number);
+
+    set_cells_number(cells, true);
+
+    set_max_period(1024u);
+
+    gen_.seed(rd_());
+
+    reset();
+
+    if (randomize_cells)
+    {
+        randomize_status();
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_sample_rate(const TSample &sample_rate)
+{
+    sample_rate_ = std::max((TSample)1.0, sample_rate);
+    half_sample_rate_ = sample_rate_ * (TSample)0.5;
+
+    if (reader_)
+    {
+        reader_->set_sample_rate(sample_rate_);
+    }
+    if (partials_)
+    {
+        partials_->set_sample_rate(sample_rate_);
+    }
+
+    set_frequency(frequency_);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_frequency(const TSample &frequency)
+{
+    frequency_ = std::clamp(frequency, (TSample)0.001, half_sample_rate_);
+
+    steps_ = ceil(sample_rate_ / frequency_);
+    sample_count_ = (TSample)0.0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_cells_number(const unsigned int &cells_number, const bool &clear)
+{
+    forget_cycle_();
+
+    cells_number_ = std::max(1u, cells_number);
+    const std::size_t words = (cells_number_ + 63) / 64;
+
+    if (clear)
+    {
+        cells_.assign(words, 0);
+    }
+    else
+    {
+        cells_.resize(words, 0);
+    }
+    next_cells_.assign(words, 0);
+
+    last_word_mask_ = cells_number_ % 64 == 0 ? ~(uint64_t)0 : ((uint64_t)1 << (cells_number_ % 64)) - 1;
+    cells_.back() &= last_word_mask_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_rules(const std::array<bool, 8> &rules)
+{
+    forget_cycle_();
+
+    for (int r = 0; r < 8; r++)
+    {
+        rules_[r] = rules[r];
+    }
+
+    rule_number_ = get_rule_number();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_rule_number(const uint8_t &rule_number)
+{
+    forget_cycle_();
+
+    for (int b = 0; b < 8; b++)
+    {
+        rules_[b] = ((rule_number >> b) & 1);
+    }
+
+    rule_number_ = rule_number;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_output(const ECAOutputs &output)
+{
+    forget_cycle_();
+
+    output_mode_ = output;
+
+    if (output_mode_ == ECAOutputs::wavetable && !reader_)
+    {
+        reader_ = std::make_unique<WTScanOsc<TSample>>(sample_rate_, pitch_);
+    }
+    else if (output_mode_ == ECAOutputs::spectrum && !partials_)
+    {
+        partials_ = std::make_unique<AddOsc<TSample>>(sample_rate_, pitch_, (int)std::min(bands_, 256u), true,
+                                                      AddEvaluation::rotator);
+    }
+
+    update_bands_(true);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_pitch(const TSample &pitch)
+{
+    pitch_ = std::clamp(pitch, (TSample)0.0, half_sample_rate_);
+
+    if (reader_)
+    {
+        reader_->set_frequency(pitch_);
+    }
+    if (partials_)
+    {
+        partials_->set_frequency(pitch_);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_bands(const unsigned int &bands)
+{
+    forget_cycle_();
+
+    bands_ = std::clamp(bands, 1u, 4096u);
+
+    if (partials_)
+    {
+        partials_->set_harmonics(std::min(bands_, 256u));
+    }
+
+    update_bands_(true);
+}
+
+// The longest cycle that is looked for, at most 65536 generations, with 0
+// turning the detection off. Cycles are only replayed for the number
+// output: the wavetable and spectrum outputs keep stepping the cells.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_max_period(const unsigned int &max_period)
+{
+    forget_cycle_();
+
+    max_period_ = std::min(max_period, max_period_limit_);
+    cycle_values_.reserve(max_period_);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_cells_status(const std::vector<bool> &status)
+{
+    for (std::size_t s = 0; s < std::min(status.size(), (std::size_t)cells_number_); s++)
+    {
+        set_cell_status(status.at(s), s);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::set_cell_status(const bool &status, const unsigned int &cell)
+{
+    forget_cycle_();
+
+    if (cell < cells_number_)
+    {
+        const uint64_t bit = (uint64_t)1 << (cell % 64);
+        cells_[cell / 64] = status ? cells_[cell / 64] | bit : cells_[cell / 64] & ~bit;
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::randomize_status(const TSample &alive_chance)
+{
+    for (unsigned int s = 0; s < cells_number_; s++)
+    {
+        set_cell_status(rand_dist_(gen_) <= alive_chance, s);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample ECAOsc<TSample>::get_sample_rate()
+{
+    return sample_rate_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample ECAOsc<TSample>::get_frequency()
+{
+    return frequency_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+ECAOutputs ECAOsc<TSample>::get_output()
+{
+    return output_mode_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample ECAOsc<TSample>::get_pitch()
+{
+    return pitch_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+unsigned int ECAOsc<TSample>::get_bands()
+{
+    return bands_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+unsigned int ECAOsc<TSample>::get_max_period()
+{
+    return max_period_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+unsigned int ECAOsc<TSample>::get_period()
+{
+    return period_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::array<bool, 8> ECAOsc<TSample>::get_rules()
+{
+    return rules_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+uint8_t ECAOsc<TSample>::get_rule_number()
+{
+    uint8_t rule_number = 0;
+    for (int r = 0; r < 8; r++)
+    {
+        rule_number |= (uint8_t)rules_[r] << r;
+    }
+
+    return rule_number;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<bool> ECAOsc<TSample>::get_cells()
+{
+    sync_cells_();
+
+    std::vector<bool> cells(cells_number_);
+    for (unsigned int c = 0; c < cells_number_; c++)
+    {
+        cells[c] = (cells_[c / 64] >> (c % 64)) & 1;
+    }
+
+    return cells;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOsc<TSample>::reset()
+{
+    output_ = (TSample)0.0;
+    current_ = (TSample)0.0;
+    step();
+    next_ = cells_to_float();
+    update_bands_(true);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample ECAOsc<TSample>::run()
+{
+    ++sample_count_;
+
+    if (sample_count_ > steps_)
+    {
+        current_ = next_;
+        advance_();
+        sample_count_ = (TSample)0.0;
+    }
+
+    TSample ratio = sample_count_ / steps_;
+
+    switch (output_mode_)
+    {
+    case ECAOutputs::number:
+        output_ = current_ * ((TSample)1.0 - ratio) + next_ * ratio;
+        break;
+    case ECAOutputs::wavetable:
+        output_ = reader_->run(ratio);
+        break;
+    case ECAOutputs::spectrum:
+        output_ = partials_->run();
+        break;
+    }
+
+    return output_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample ECAOsc<TSample>::get_last_sample()
+{
+    return output_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOsc<TSample>::step()
+{
+    forget_cycle_();
+
+    step_cells_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOsc<TSample>::step_cells_()
+{
+    hash_ = ECARules::step(rule_number_, cells_.data(), next_cells_.data(), cells_.size(), cells_number_);
+
+    std::swap(cells_, next_cells_);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample ECAOsc<TSample>::cells_to_float()
+{
+    sync_cells_();
+
+    const int bits_TSample = sizeof(TSample) * CHAR_BIT;
+    const int last_cell = std::min(bits_TSample, (int)cells_number_);
+
+    const uint64_t value = ECARules::reverse_bits(cells_[0]) >> (64 - last_cell);
+    const TSample range = std::ldexp((TSample)1.0, last_cell) - (TSample)1.0;
+
+    return ((TSample)2.0 * (TSample)value / range) - (TSample)1.0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline unsigned int ECAOsc<TSample>::count_cells_(unsigned int first, const unsigned int &last)
+{
+    unsigned int count = 0;
+
+    while (first < last)
+    {
+        const unsigned int offset = first % 64;
+        const unsigned int span = std::min(64u - offset, last - first);
+        const uint64_t mask = span == 64 ? ~(uint64_t)0 : ((uint64_t)1 << span) - 1;
+
+        count += ECARules::popcount((cells_[first / 64] >> offset) & mask);
+        first += span;
+    }
+
+    return count;
+}
+
+// Each band is the density of alive cells in an equal slice of the row,
+// counted a word at a time, so even rows of thousands of cells reduce to
+// a few popcounts per band.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOsc<TSample>::cells_to_bands_(TSample *bands, const unsigned int &count, const bool &bipolar)
+{
+    for (unsigned int b = 0; b < count; b++)
+    {
+        const unsigned int first = (unsigned int)(((uint64_t)b * cells_number_) / count);
+        const unsigned int last = std::max(first + 1, (unsigned int)(((uint64_t)(b + 1) * cells_number_) / count));
+        const TSample density = (TSample)count_cells_(first, last) / (TSample)(last - first);
+
+        bands[b] = bipolar ? (TSample)2.0 * density - (TSample)1.0 : density;
+    }
+}
+
+// In wavetable mode the reader holds two frames, the previous generation
+// and the current one, and scans between them as the next step approaches.
+// In spectrum mode the bands drive the gains of the additive partials.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOsc<TSample>::update_bands_(const bool &restart)
+{
+    switch (output_mode_)
+    {
+    case ECAOutputs::number:
+        break;
+    case ECAOutputs::wavetable:
+        if (restart || frames_.size() != bands_ * 2)
+        {
+            frames_.resize(bands_ * 2);
+            cells_to_bands_(frames_.data(), bands_, true);
+            std::copy(frames_.begin(), frames_.begin() + bands_, frames_.begin() + bands_);
+        }
+        else
+        {
+            std::copy(frames_.begin() + bands_, frames_.end(), frames_.begin());
+            cells_to_bands_(frames_.data() + bands_, bands_, true);
+        }
+        reader_->set_frames(frames_, bands_);
+        break;
+    case ECAOutputs::spectrum:
+        band_gains_.resize(partials_->get_harmonics());
+        cells_to_bands_(band_gains_.data(), band_gains_.size(), false);
+        partials_->set_harmonics_gain(band_gains_);
+        break;
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOsc<TSample>::advance_()
+{
+    if (period_ > 0)
+    {
+        next_ = cycle_values_[cycle_position_];
+        cycle_position_ = (cycle_position_ + 1) % period_;
+        return;
+    }
+
+    step_cells_();
+    next_ = cells_to_float();
+    update_bands_();
+
+    if (max_period_ > 0 && output_mode_ == ECAOutputs::number)
+    {
+        detect_cycle_();
+    }
+}
+
+// Cycles are found with Brent's algorithm: a checkpoint generation is kept
+// and every following state is compared against it, first by hash and then
+// word by word, while the checkpoint moves forward at power of two
+// distances, capped at the maximum period. Only the checkpoint and the
+// outputs generated since then are stored. Once the automaton comes back to
+// the checkpoint, those outputs are one full period and are replayed
+// without stepping the cells any more.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOsc<TSample>::detect_cycle_()
+{
+    if (checkpoint_.empty())
+    {
+        checkpoint_ = cells_;
+        checkpoint_hash_ = hash_;
+        return;
+    }
+
+    cycle_values_.push_back(next_);
+
+    if (hash_ == checkpoint_hash_ && cells_ == checkpoint_)
+    {
+        period_ = cycle_values_.size();
+        cycle_position_ = 0;
+        cycle_origin_ = 0;
+        return;
+    }
+
+    if (cycle_values_.size() >= cycle_power_)
+    {
+        cycle_power_ = std::min(cycle_power_ * 2, max_period_);
+        checkpoint_ = cells_;
+        checkpoint_hash_ = hash_;
+        cycle_values_.clear();
+    }
+}
+
+// While a cycle is replayed the cells stay at the generation they had when
+// they were last synced, so they are stepped forward to the replayed
+// position before being read or changed.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOsc<TSample>::sync_cells_()
+{
+    if (period_ == 0)
+    {
+        return;
+    }
+
+    const unsigned int steps = (cycle_position_ + period_ - cycle_origin_) % period_;
+    for (unsigned int s = 0; s < steps; s++)
+    {
+        step_cells_();
+    }
+
+    cycle_origin_ = cycle_position_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOsc<TSample>::forget_cycle_()
+{
+    sync_cells_();
+
+    period_ = 0;
+    cycle_power_ = 1;
+    cycle_values_.clear();
+    checkpoint_.clear();
+}
+
+// Many automata sharing the row length and stepped with the same packed
+// engine, each with its own rule, rate and output. All the rows live in a
+// single buffer and all the random states come from one generator, seeded
+// once per bank.
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class ECAOscBank
+{
+    static_assert(Automata > 0, "an ECAOscBank needs at least one automaton");
+
+public:
+    ECAOscBank(const TSample &sample_rate = (TSample)44100.0,
+               const unsigned int &cells = 32u,
+               const uint8_t &rule_number = 110,
+               const bool &randomize_cells = false);
+
+    void set_sample_rate(const TSample &sample_rate);
+    void set_frequency(const unsigned int &automaton, const TSample &frequency);
+    void set_cells_number(const unsigned int &cells_number, const bool &clear = true);
+    void set_cells_status(const unsigned int &automaton, const std::vector<bool> &status);
+    void set_cell_status(const unsigned int &automaton, const bool &status, const unsigned int &cell);
+    void set_rule_number(const uint8_t &rule_number);
+    void set_rule_number(const unsigned int &automaton, const uint8_t &rule_number);
+    void set_seed(const uint64_t &seed);
+
+    void randomize_status(const TSample &alive_chance = (TSample)0.5);
+    void randomize_status(const unsigned int &automaton, const TSample &alive_chance);
+
+    TSample get_sample_rate();
+    TSample get_frequency(const unsigned int &automaton);
+    unsigned int get_cells_number();
+    uint8_t get_rule_number(const unsigned int &automaton);
+    std::vector<bool> get_cells(const unsigned int &automaton);
+
+    void reset();
+
+    inline void step();
+    inline void run(std::array<TSample, Automata> &outputs);
+    inline void run_block(std::array<std::vector<TSample>, Automata> &outputs);
+
+    inline std::array<TSample, Automata> get_last_sample();
+
+private:
+    TSample sample_rate_;
+    TSample half_sample_rate_;
+
+    std::array<TSample, Automata> frequency_;
+    std::array<TSample, Automata> sample_count_;
+    std::array<TSample, Automata> steps_;
+    std::array<uint8_t, Automata> rule_numbers_;
+
+    unsigned int cells_number_ = 0;
+    std::size_t words_ = 0;
+    std::vector<uint64_t> cells_;
+    std::vector<uint64_t> next_cells_;
+    uint64_t last_word_mask_ = 0;
+    int last_cell_ = 0;
+    TSample range_ = (TSample)1.0;
+
+    std::mt19937_64 gen_;
+
+    std::array<TSample, Automata> current_;
+    std::array<TSample, Automata> next_;
+    std::array<TSample, Automata> outputs_;
+
+    inline void step_(const unsigned int &automaton);
+    inline TSample cells_to_float_(const unsigned int &automaton);
+};
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+ECAOscBank<TSample, Automata>::ECAOscBank(const TSample &sample_rate, const unsigned int &cells,
+                                          const uint8_t &rule_number, const bool &randomize_cells)
+{
+    frequency_.fill((TSample)1.0);
+    outputs_.fill((TSample)0.0);
+
+    set_sample_rate(sample_rate);
+
+    set_rule_number(rule_number);
+
+    set_cells_number(cells, true);
+
+    std::random_device rd;
+    set_seed(((uint64_t)rd() << 32) | (uint64_t)rd());
+
+    reset();
+
+    if (randomize_cells)
+    {
+        randomize_status();
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::set_sample_rate(const TSample &sample_rate)
+{
+    sample_rate_ = std::max((TSample)1.0, sample_rate);
+    half_sample_rate_ = sample_rate_ * (TSample)0.5;
+
+    for (unsigned int a = 0; a < Automata; a++)
+    {
+        set_frequency(a, frequency_[a]);
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::set_frequency(const unsigned int &automaton, const TSample &frequency)
+{
+    if (automaton >= Automata)
+    {
+        return;
+    }
+
+    frequency_[automaton] = std::clamp(frequency, (TSample)0.001, half_sample_rate_);
+
+    steps_[automaton] = ceil(sample_rate_ / frequency_[automaton]);
+    sample_count_[automaton] = (TSample)0.0;
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::set_cells_number(const unsigned int &cells_number, const bool &clear)
+{
+    const unsigned int old_cells_number = cells_number_;
+    const std::size_t old_words = words_;
+    const std::vector<uint64_t> old_cells = clear ? std::vector<uint64_t>() : cells_;
+
+    cells_number_ = std::max(1u, cells_number);
+    words_ = (cells_number_ + 63) / 64;
+    cells_.assign(Automata * words_, 0);
+    next_cells_.assign(words_, 0);
+
+    last_word_mask_ = cells_number_ % 64 == 0 ? ~(uint64_t)0 : ((uint64_t)1 << (cells_number_ % 64)) - 1;
+    last_cell_ = std::min((int)(sizeof(TSample) * CHAR_BIT), (int)cells_number_);
+    range_ = std::ldexp((TSample)1.0, last_cell_) - (TSample)1.0;
+
+    if (!clear && old_cells_number > 0)
+    {
+        const std::size_t words = std::min(words_, old_words);
+        for (unsigned int a = 0; a < Automata; a++)
+        {
+            std::copy(old_cells.begin() + a * old_words, old_cells.begin() + a * old_words + words, cells_.begin() + a * words_);
+            cells_[a * words_ + words_ - 1] &= last_word_mask_;
+        }
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::set_cells_status(const unsigned int &automaton, const std::vector<bool> &status)
+{
+    for (std::size_t s = 0; s < std::min(status.size(), (std::size_t)cells_number_); s++)
+    {
+        set_cell_status(automaton, status.at(s), s);
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::set_cell_status(const unsigned int &automaton, const bool &status, const unsigned int &cell)
+{
+    if (automaton < Automata && cell < cells_number_)
+    {
+        uint64_t &word = cells_[automaton * words_ + cell / 64];
+        const uint64_t bit = (uint64_t)1 << (cell % 64);
+        word = status ? word | bit : word & ~bit;
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::set_rule_number(const uint8_t &rule_number)
+{
+    rule_numbers_.fill(rule_number);
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::set_rule_number(const unsigned int &automaton, const uint8_t &rule_number)
+{
+    if (automaton < Automata)
+    {
+        rule_numbers_[automaton] = rule_number;
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::set_seed(const uint64_t &seed)
+{
+    gen_.seed(seed);
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::randomize_status(const TSample &alive_chance)
+{
+    for (unsigned int a = 0; a < Automata; a++)
+    {
+        randomize_status(a, alive_chance);
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::randomize_status(const unsigned int &automaton, const TSample &alive_chance)
+{
+    if (automaton >= Automata)
+    {
+        return;
+    }
+
+    const uint64_t threshold = (uint64_t)(std::clamp(alive_chance, (TSample)0.0, (TSample)1.0) * (TSample)9007199254740992.0);
+
+    for (std::size_t w = 0; w < words_; w++)
+    {
+        uint64_t word = 0;
+        for (unsigned int b = 0; b < 64; b++)
+        {
+            word |= (uint64_t)((gen_() >> 11) < threshold) << b;
+        }
+
+        cells_[automaton * words_ + w] = w + 1 == words_ ? word & last_word_mask_ : word;
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample ECAOscBank<TSample, Automata>::get_sample_rate()
+{
+    return sample_rate_;
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample ECAOscBank<TSample, Automata>::get_frequency(const unsigned int &automaton)
+{
+    if (automaton < Automata)
+    {
+        return frequency_[automaton];
+    }
+
+    return (TSample)0.0;
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+unsigned int ECAOscBank<TSample, Automata>::get_cells_number()
+{
+    return cells_number_;
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+uint8_t ECAOscBank<TSample, Automata>::get_rule_number(const unsigned int &automaton)
+{
+    if (automaton < Automata)
+    {
+        return rule_numbers_[automaton];
+    }
+
+    return 0;
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<bool> ECAOscBank<TSample, Automata>::get_cells(const unsigned int &automaton)
+{
+    std::vector<bool> cells;
+
+    if (automaton < Automata)
+    {
+        cells.resize(cells_number_);
+        for (unsigned int c = 0; c < cells_number_; c++)
+        {
+            cells[c] = (cells_[automaton * words_ + c / 64] >> (c % 64)) & 1;
+        }
+    }
+
+    return cells;
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void ECAOscBank<TSample, Automata>::reset()
+{
+    for (unsigned int a = 0; a < Automata; a++)
+    {
+        outputs_[a] = (TSample)0.0;
+        current_[a] = (TSample)0.0;
+        step_(a);
+        next_[a] = cells_to_float_(a);
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOscBank<TSample, Automata>::step()
+{
+    for (unsigned int a = 0; a < Automata; a++)
+    {
+        step_(a);
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOscBank<TSample, Automata>::run(std::array<TSample, Automata> &outputs)
+{
+    for (unsigned int a = 0; a < Automata; a++)
+    {
+        ++sample_count_[a];
+
+        if (sample_count_[a] > steps_[a])
+        {
+            current_[a] = next_[a];
+            step_(a);
+            next_[a] = cells_to_float_(a);
+            sample_count_[a] = (TSample)0.0;
+        }
+
+        const TSample ratio = sample_count_[a] / steps_[a];
+
+        outputs_[a] = current_[a] * ((TSample)1.0 - ratio) + next_[a] * ratio;
+    }
+
+    outputs = outputs_;
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOscBank<TSample, Automata>::run_block(std::array<std::vector<TSample>, Automata> &outputs)
+{
+    std::size_t block_size = outputs[0].size();
+    for (const auto &output : outputs)
+    {
+        block_size = std::min(block_size, output.size());
+    }
+
+    for (unsigned int a = 0; a < Automata; a++)
+    {
+        TSample *output = outputs[a].data();
+
+        for (std::size_t s = 0; s < block_size; s++)
+        {
+            ++sample_count_[a];
+
+            if (sample_count_[a] > steps_[a])
+            {
+                current_[a] = next_[a];
+                step_(a);
+                next_[a] = cells_to_float_(a);
+                sample_count_[a] = (TSample)0.0;
+            }
+
+            const TSample ratio = sample_count_[a] / steps_[a];
+
+            output[s] = current_[a] * ((TSample)1.0 - ratio) + next_[a] * ratio;
+        }
+
+        if (block_size > 0)
+        {
+            outputs_[a] = output[block_size - 1];
+        }
+    }
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline std::array<TSample, Automata> ECAOscBank<TSample, Automata>::get_last_sample()
+{
+    return outputs_;
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ECAOscBank<TSample, Automata>::step_(const unsigned int &automaton)
+{
+    uint64_t *cells = cells_.data() + automaton * words_;
+
+    ECARules::step(rule_numbers_[automaton], cells, next_cells_.data(), words_, cells_number_);
+
+    std::copy(next_cells_.begin(), next_cells_.end(), cells);
+}
+
+template <typename TSample, unsigned int Automata>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample ECAOscBank<TSample, Automata>::cells_to_float_(const unsigned int &automaton)
+{
+    const uint64_t value = ECARules::reverse_bits(cells_[automaton * words_]) >> (64 - last_cell_);
+
+    return ((TSample)2.0 * (TSample)value / range_) - (TSample)1.0;
+}
+
+}
+
+#endif // ECAOSC_H_
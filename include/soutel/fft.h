@@ -0,0 +1,200 @@
+/******************************************************************************
+Copyright (c) 2023-2026 Valerio Orlandini
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef FFT_H_
+#define FFT_H_
+
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 202002L
+#include<concepts>
+#endif
+
+namespace soutel
+{
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+inline bool is_power_of_two(const unsigned int &size)
+{
+    return size > 0 && (size & (size - 1)) == 0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void fft(std::vector<std::complex<TSample>> &buffer, const bool &inverse = false)
+{
+    const unsigned int size = buffer.size();
+
+    if (!is_power_of_two(size) || size < 2)
+    {
+        return;
+    }
+
+    for (unsigned int i = 1, j = 0; i < size; i++)
+    {
+        unsigned int bit = size >> 1;
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+
+        if (i < j)
+        {
+            std::swap(buffer[i], buffer[j]);
+        }
+    }
+
+    for (unsigned int length = 2; length <= size; length <<= 1)
+    {
+        const double angle = (inverse ? 2.0 : -2.0) * M_PI / (double)length;
+        const std::complex<double> rotation(std::cos(angle), std::sin(angle));
+        const unsigned int half = length >> 1;
+
+        std::complex<double> twiddle(1.0, 0.0);
+        for (unsigned int k = 0; k < half; k++)
+        {
+            const std::complex<TSample> w((TSample)twiddle.real(), (TSample)twiddle.imag());
+
+            for (unsigned int i = k; i < size; i += length)
+            {
+                std::complex<TSample> even = buffer[i];
+                std::complex<TSample> odd = buffer[i + half] * w;
+                buffer[i] = even + odd;
+                buffer[i + half] = even - odd;
+            }
+
+            twiddle *= rotation;
+        }
+    }
+
+    if (inverse)
+    {
+        const TSample scale = (TSample)1.0 / (TSample)size;
+        for (auto &bin : buffer)
+        {
+            bin *= scale;
+        }
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void ifft(std::vector<std::complex<TSample>> &buffer)
+{
+    fft(buffer, true);
+}
+
+// Transform of a real signal of size 2 M through a complex one of size M. On
+// input the buffer holds the M pairs (x[2 n], x[2 n + 1]); on output it holds
+// bins 0 to M - 1, with the real bin M stored as the imaginary part of bin 0.
+// The other half of the spectrum is the conjugate of this one.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void real_fft(std::vector<std::complex<TSample>> &buffer)
+{
+    const unsigned int size = buffer.size();
+
+    if (!is_power_of_two(size))
+    {
+        return;
+    }
+
+    fft(buffer);
+
+    const TSample first = buffer[0].real();
+    buffer[0] = std::complex<TSample>(first + buffer[0].imag(), first - buffer[0].imag());
+
+    const double angle = -M_PI / (double)size;
+    const std::complex<double> rotation(std::cos(angle), std::sin(angle));
+    std::complex<double> twiddle = rotation;
+
+    for (unsigned int k = 1; k <= size / 2; k++)
+    {
+        const std::complex<TSample> w((TSample)twiddle.real(), (TSample)twiddle.imag());
+        const std::complex<TSample> a = buffer[k];
+        const std::complex<TSample> b = std::conj(buffer[size - k]);
+        const std::complex<TSample> even = (a + b) * (TSample)0.5;
+        const std::complex<TSample> odd = std::complex<TSample>((a - b).imag(), (b - a).real()) * (TSample)0.5 * w;
+
+        buffer[k] = even + odd;
+        buffer[size - k] = std::conj(even - odd);
+
+        twiddle *= rotation;
+    }
+}
+
+// Inverse of real_fft(): takes bins 0 to M, packed as real_fft() leaves
+// them, and gives back the 2 M samples as M pairs (x[2 n], x[2 n + 1]).
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void real_ifft(std::vector<std::complex<TSample>> &buffer)
+{
+    const unsigned int size = buffer.size();
+
+    if (!is_power_of_two(size))
+    {
+        return;
+    }
+
+    const TSample first = buffer[0].real();
+    const TSample last = buffer[0].imag();
+    buffer[0] = std::complex<TSample>(first + last, first - last) * (TSample)0.5;
+
+    const double angle = M_PI / (double)size;
+    const std::complex<double> rotation(std::cos(angle), std::sin(angle));
+    std::complex<double> twiddle = rotation;
+
+    for (unsigned int k = 1; k <= size / 2; k++)
+    {
+        const std::complex<TSample> w((TSample)twiddle.real(), (TSample)twiddle.imag());
+        const std::complex<TSample> a = buffer[k];
+        const std::complex<TSample> b = std::conj(buffer[size - k]);
+        const std::complex<TSample> even = (a + b) * (TSample)0.5;
+        const std::complex<TSample> odd = (a - b) * (TSample)0.5 * w;
+
+        buffer[k] = even + std::complex<TSample>(-odd.imag(), odd.real());
+        buffer[size - k] = std::conj(even) + std::complex<TSample>(odd.imag(), odd.real());
+
+        twiddle *= rotation;
+    }
+
+    ifft(buffer);
+}
+
+}
+
+#endif // FFT_H_
@@ -1,156 +1,489 @@
-/******************************************************************************
-Copyright (c) 2023-2026 Valerio Orlandini
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-******************************************************************************/
-
-#ifndef LORENZ_H_
-#define LORENZ_H_
-
-#include <algorithm>
-
-#if __cplusplus >= 202002L
-#include<concepts>
-#endif
-
-namespace soutel
-{
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-class Lorenz
-{
-public:
-    Lorenz(const TSample &sigma = (TSample)10.0,
-           const TSample &rho = (TSample)28.0,
-           const TSample &beta = (TSample)(8.0 / 3.0),
-           const TSample &x = (TSample)0.01,
-           const TSample &y = (TSample)0.0,
-           const TSample &z = (TSample)0.0,
-           const TSample &t = (TSample)0.099)
-    {
-        set_sigma(sigma);
-        set_rho(rho);
-        set_beta(beta);
-        set_x(x);
-        set_y(y);
-        set_z(z);
-        set_t(t);
-    }
-
-    void set_sigma(const TSample &sigma)
-    {
-        sigma_ = sigma;
-    }
-
-    void set_rho(const TSample &rho)
-    {
-        rho_ = rho;
-    }
-
-    void set_beta(const TSample &beta)
-    {
-        beta_ = beta;
-    }
-
-    void set_x(const TSample &x)
-    {
-        x_ = x;
-    }
-
-    void set_y(const TSample &y)
-    {
-        y_ = y;
-    }
-
-    void set_z(const TSample &z)
-    {
-        z_ = z;
-    }
-
-    void set_t(const TSample &t)
-    {
-        t_ = std::clamp(t, (TSample)0.0, (TSample)0.025);
-    }
-
-
-    TSample get_sigma()
-    {
-        return sigma_;
-    }
-
-    TSample get_rho()
-    {
-        return rho_;
-    }
-
-    TSample get_beta()
-    {
-        return beta_;
-    }
-
-    TSample get_x()
-    {
-        return x_;
-    }
-
-    TSample get_y()
-    {
-        return y_;
-    }
-
-    TSample get_z()
-    {
-        return z_;
-    }
-
-    inline void step()
-    {
-        if (t_ > 0.0)
-        {
-            TSample x_1 = sigma_ * (y_ - x_);
-            TSample y_1 = x_ * (rho_ - z_) - y_;
-            TSample z_1 = x_ * y_ - beta_ * z_;
-
-            x_ += t_ * x_1;
-            y_ += t_ * y_1;
-            z_ += t_ * z_1;
-        }
-    }
-
-    inline void step(TSample &x, TSample &y, TSample &z)
-    {
-        step();
-
-        x = x_;
-        y = y_;
-        z = z_;
-    }
-
-private:
-    TSample sigma_, beta_, rho_;
-    TSample x_, y_, z_;
-    TSample t_;
-};
-
-}
-
+/******************************************************************************
+Copyright (c) 2023-2026 Valerio Orlandini
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef LORENZ_H_
+#define LORENZ_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "utils.h"
+
+#if __cplusplus >= 202002L
+#include<concepts>
+#endif
+
+namespace soutel
+{
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class Lorenz
+{
+public:
+    Lorenz(const TSample &sigma = (TSample)10.0,
+           const TSample &rho = (TSample)28.0,
+           const TSample &beta = (TSample)(8.0 / 3.0),
+           const TSample &x = (TSample)0.01,
+           const TSample &y = (TSample)0.0,
+           const TSample &z = (TSample)0.0,
+           const TSample &t = (TSample)0.099,
+           const ODEIntegrators &integrator = ODEIntegrators::euler,
+           const unsigned int &steps = 1u)
+    {
+        set_sigma(sigma);
+        set_rho(rho);
+        set_beta(beta);
+        set_x(x);
+        set_y(y);
+        set_z(z);
+        set_integrator(integrator);
+        set_steps(steps);
+        set_t(t);
+    }
+
+    void set_sigma(const TSample &sigma)
+    {
+        sigma_ = sigma;
+    }
+
+    void set_rho(const TSample &rho)
+    {
+        rho_ = rho;
+    }
+
+    void set_beta(const TSample &beta)
+    {
+        beta_ = beta;
+    }
+
+    void set_x(const TSample &x)
+    {
+        x_ = x;
+    }
+
+    void set_y(const TSample &y)
+    {
+        y_ = y;
+    }
+
+    void set_z(const TSample &z)
+    {
+        z_ = z;
+    }
+
+    void set_t(const TSample &t)
+    {
+        requested_t_ = t;
+
+        t_ = std::clamp(t, (TSample)0.0, max_t(integrator_));
+        adaptive_t_ = t_;
+    }
+
+    void set_integrator(const ODEIntegrators &integrator)
+    {
+        integrator_ = integrator;
+
+        set_t(requested_t_);
+    }
+
+    void set_steps(const unsigned int &steps)
+    {
+        steps_ = std::max(1u, steps);
+    }
+
+    void set_tolerance(const TSample &tolerance)
+    {
+        tolerance_ = std::max((TSample)1e-12, tolerance);
+    }
+
+
+    TSample get_sigma()
+    {
+        return sigma_;
+    }
+
+    TSample get_rho()
+    {
+        return rho_;
+    }
+
+    TSample get_beta()
+    {
+        return beta_;
+    }
+
+    TSample get_x()
+    {
+        return x_;
+    }
+
+    TSample get_y()
+    {
+        return y_;
+    }
+
+    TSample get_z()
+    {
+        return z_;
+    }
+
+    TSample get_t()
+    {
+        return t_;
+    }
+
+    ODEIntegrators get_integrator()
+    {
+        return integrator_;
+    }
+
+    unsigned int get_steps()
+    {
+        return steps_;
+    }
+
+    TSample get_tolerance()
+    {
+        return tolerance_;
+    }
+
+    static TSample max_t(const ODEIntegrators &integrator)
+    {
+        TSample max_t = (TSample)0.02;
+        switch (integrator)
+        {
+        case ODEIntegrators::euler:
+            break;
+        case ODEIntegrators::heun:
+            max_t = (TSample)0.05;
+            break;
+        case ODEIntegrators::rk4:
+            max_t = (TSample)0.1;
+            break;
+        case ODEIntegrators::rk45:
+            max_t = (TSample)0.5;
+            break;
+        }
+
+        return max_t;
+    }
+
+    inline void step()
+    {
+        if (t_ > 0.0)
+        {
+            auto derivatives = [this](const std::array<TSample, 3> &state)
+            {
+                return std::array<TSample, 3>{sigma_ * (state[1] - state[0]),
+                                              state[0] * (rho_ - state[2]) - state[1],
+                                              state[0] * state[1] - beta_ * state[2]};
+            };
+
+            std::array<TSample, 3> state = {x_, y_, z_};
+
+            if (integrator_ == ODEIntegrators::rk45)
+            {
+                ode_adaptive_step(derivatives, state, t_ * (TSample)steps_, adaptive_t_, tolerance_);
+            }
+            else
+            {
+                for (unsigned int s = 0; s < steps_; s++)
+                {
+                    ode_step(integrator_, derivatives, state, t_);
+                }
+            }
+
+            x_ = state[0];
+            y_ = state[1];
+            z_ = state[2];
+
+            if (std::isnan(x_) || std::isnan(y_) || std::isnan(z_))
+            {
+                x_ = (TSample)0.01;
+                y_ = (TSample)0.0;
+                z_ = (TSample)0.0;
+            }
+        }
+    }
+
+    inline void step(TSample &x, TSample &y, TSample &z)
+    {
+        step();
+
+        x = x_;
+        y = y_;
+        z = z_;
+    }
+
+private:
+    TSample sigma_, beta_, rho_;
+    TSample x_, y_, z_;
+    TSample t_;
+    TSample requested_t_ = (TSample)0.0;
+
+    ODEIntegrators integrator_ = ODEIntegrators::euler;
+    unsigned int steps_ = 1;
+    TSample tolerance_ = (TSample)1e-6;
+    TSample adaptive_t_ = (TSample)0.0;
+};
+
+// N Lorenz attractors stored as structure of arrays and integrated together,
+// one lane per attractor, each one with its own parameters and state.
+template <typename TSample, unsigned int Attractors>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class LorenzBank
+{
+public:
+    LorenzBank(const TSample &sigma = (TSample)10.0,
+               const TSample &rho = (TSample)28.0,
+               const TSample &beta = (TSample)(8.0 / 3.0),
+               const TSample &x = (TSample)0.01,
+               const TSample &y = (TSample)0.0,
+               const TSample &z = (TSample)0.0,
+               const TSample &spread = (TSample)0.001,
+               const TSample &t = (TSample)0.099,
+               const ODEIntegrators &integrator = ODEIntegrators::euler,
+               const unsigned int &steps = 1u)
+    {
+        set_sigma(sigma);
+        set_rho(rho);
+        set_beta(beta);
+        set_state(x, y, z, spread);
+        set_integrator(integrator);
+        set_steps(steps);
+        set_t(t);
+    }
+
+    void set_sigma(const TSample &sigma)
+    {
+        sigma_.fill(sigma);
+    }
+
+    void set_sigma(const unsigned int &attractor, const TSample &sigma)
+    {
+        if (attractor < Attractors)
+        {
+            sigma_[attractor] = sigma;
+        }
+    }
+
+    void set_rho(const TSample &rho)
+    {
+        rho_.fill(rho);
+    }
+
+    void set_rho(const unsigned int &attractor, const TSample &rho)
+    {
+        if (attractor < Attractors)
+        {
+            rho_[attractor] = rho;
+        }
+    }
+
+    void set_beta(const TSample &beta)
+    {
+        beta_.fill(beta);
+    }
+
+    void set_beta(const unsigned int &attractor, const TSample &beta)
+    {
+        if (attractor < Attractors)
+        {
+            beta_[attractor] = beta;
+        }
+    }
+
+    void set_x(const unsigned int &attractor, const TSample &x)
+    {
+        if (attractor < Attractors)
+        {
+            state_[0][attractor] = x;
+        }
+    }
+
+    void set_y(const unsigned int &attractor, const TSample &y)
+    {
+        if (attractor < Attractors)
+        {
+            state_[1][attractor] = y;
+        }
+    }
+
+    void set_z(const unsigned int &attractor, const TSample &z)
+    {
+        if (attractor < Attractors)
+        {
+            state_[2][attractor] = z;
+        }
+    }
+
+    void set_state(const TSample &x, const TSample &y, const TSample &z, const TSample &spread = (TSample)0.0)
+    {
+        for (unsigned int a = 0; a < Attractors; a++)
+        {
+            state_[0][a] = x + spread * (TSample)a;
+            state_[1][a] = y;
+            state_[2][a] = z;
+        }
+    }
+
+    void set_t(const TSample &t)
+    {
+        requested_t_ = t;
+
+        t_ = std::clamp(t, (TSample)0.0, Lorenz<TSample>::max_t(integrator_ == ODEIntegrators::rk45 ? ODEIntegrators::rk4 : integrator_));
+    }
+
+    void set_integrator(const ODEIntegrators &integrator)
+    {
+        integrator_ = integrator;
+
+        set_t(requested_t_);
+    }
+
+    void set_steps(const unsigned int &steps)
+    {
+        steps_ = std::max(1u, steps);
+    }
+
+    TSample get_sigma(const unsigned int &attractor)
+    {
+        return attractor < Attractors ? sigma_[attractor] : (TSample)0.0;
+    }
+
+    TSample get_rho(const unsigned int &attractor)
+    {
+        return attractor < Attractors ? rho_[attractor] : (TSample)0.0;
+    }
+
+    TSample get_beta(const unsigned int &attractor)
+    {
+        return attractor < Attractors ? beta_[attractor] : (TSample)0.0;
+    }
+
+    TSample get_x(const unsigned int &attractor)
+    {
+        return attractor < Attractors ? state_[0][attractor] : (TSample)0.0;
+    }
+
+    const std::array<TSample, Attractors> &get_x()
+    {
+        return state_[0];
+    }
+
+    TSample get_y(const unsigned int &attractor)
+    {
+        return attractor < Attractors ? state_[1][attractor] : (TSample)0.0;
+    }
+
+    const std::array<TSample, Attractors> &get_y()
+    {
+        return state_[1];
+    }
+
+    TSample get_z(const unsigned int &attractor)
+    {
+        return attractor < Attractors ? state_[2][attractor] : (TSample)0.0;
+    }
+
+    const std::array<TSample, Attractors> &get_z()
+    {
+        return state_[2];
+    }
+
+    TSample get_t()
+    {
+        return t_;
+    }
+
+    ODEIntegrators get_integrator()
+    {
+        return integrator_;
+    }
+
+    unsigned int get_steps()
+    {
+        return steps_;
+    }
+
+    inline void step()
+    {
+        if (t_ <= 0.0)
+        {
+            return;
+        }
+
+        auto derivatives = [this](const std::array<std::array<TSample, Attractors>, 3> &state,
+                                  std::array<std::array<TSample, Attractors>, 3> &out)
+        {
+            for (unsigned int l = 0; l < Attractors; l++)
+            {
+                out[0][l] = sigma_[l] * (state[1][l] - state[0][l]);
+                out[1][l] = state[0][l] * (rho_[l] - state[2][l]) - state[1][l];
+                out[2][l] = state[0][l] * state[1][l] - beta_[l] * state[2][l];
+            }
+        };
+
+        for (unsigned int s = 0; s < steps_; s++)
+        {
+            ode_step_lanes(integrator_, derivatives, state_, t_);
+        }
+
+        for (unsigned int a = 0; a < Attractors; a++)
+        {
+            if (std::isnan(state_[0][a]) || std::isnan(state_[1][a]) || std::isnan(state_[2][a]))
+            {
+                state_[0][a] = (TSample)0.01;
+                state_[1][a] = (TSample)0.0;
+                state_[2][a] = (TSample)0.0;
+            }
+        }
+    }
+
+    inline void step(std::array<TSample, Attractors> &x, std::array<TSample, Attractors> &y, std::array<TSample, Attractors> &z)
+    {
+        step();
+
+        x = state_[0];
+        y = state_[1];
+        z = state_[2];
+    }
+
+private:
+    std::array<TSample, Attractors> sigma_, rho_, beta_;
+    std::array<std::array<TSample, Attractors>, 3> state_;
+    TSample t_;
+    TSample requested_t_ = (TSample)0.0;
+
+    ODEIntegrators integrator_ = ODEIntegrators::euler;
+    unsigned int steps_ = 1;
+};
+
+}
+
 #endif // LORENZ_H_
\ No newline at end of file
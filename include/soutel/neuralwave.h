@@ -1,1519 +1,2603 @@
-/******************************************************************************
-Copyright (c) 2023-2026 Valerio Orlandini
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-******************************************************************************/
-
-
-#ifndef NEURALWAVE_H_
-#define NEURALWAVE_H_
-
-#include <array>
-#include <cmath>
-#include <vector>
-#include "interp.h"
-#include "wtosc.h"
-
-#if __cplusplus >= 202002L
-#include<concepts>
-#endif
-
-namespace soutel
-{
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-class NeuralWeights;
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-class NeuralWave
-{
-public:
-    NeuralWave(const TSample &sample_rate = (TSample)44100.0,
-               const TSample &frequency = (TSample)0.0,
-               const std::array<TSample, 8> &latent_space = {(TSample)0.0},
-               const bool &use_window = false);
-
-    void set_sample_rate(const TSample &sample_rate);
-    void set_frequency(const TSample &frequency);
-    void set_latent_space(const std::array<TSample, 8> &latent_space);
-    void set_latent_parameter(const int &index, const TSample &value);
-    void set_windowed(const bool &use_window);
-    void reset();
-
-    TSample get_sample_rate();
-    TSample get_frequency();
-    std::array<TSample, 8> get_latent_space();
-    std::vector<TSample> get_wavetable(const unsigned int &size = 600);
-    bool get_windowed();
-
-    inline TSample run();
-    inline void run(TSample &output);
-    inline TSample get_last_sample();
-
-    inline std::vector<TSample> autoencode(const std::vector<TSample> &input);
-    inline std::array<TSample, 8> encode(const std::vector<TSample> &input);
-    inline std::vector<TSample> decode(const std::array<TSample, 8> &latent_space, const unsigned int &size = 600);
-
-private:
-    std::array<TSample, 8> latent_space_;
-    std::vector<TSample> wavetable_;
-
-    soutel::WTOsc<TSample> oscillator_;
-
-    NeuralWeights<TSample> weights_;
-
-    TSample crossfade_ = (TSample)0.05;
-    bool windowed_ = false;
-
-    inline void set_wavetable_()
-    {
-        oscillator_.set_wavetable(wavetable_);
-        oscillator_.crossfade(crossfade_);
-        oscillator_.normalize((TSample)0.95);
-    }
-};
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-NeuralWave<TSample>::NeuralWave(const TSample &sample_rate, const TSample &frequency, const std::array<TSample, 8> &latent_space, const bool &use_window)
-{
-    oscillator_.set_sample_rate(sample_rate);
-    oscillator_.set_frequency(frequency);
-    wavetable_ = decode(latent_space);
-    set_wavetable_();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void NeuralWave<TSample>::set_sample_rate(const TSample &sample_rate)
-{
-    oscillator_.set_sample_rate(sample_rate);
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void NeuralWave<TSample>::set_frequency(const TSample &frequency)
-{
-    oscillator_.set_frequency(frequency);
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void NeuralWave<TSample>::reset()
-{
-    oscillator_.reset();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-TSample NeuralWave<TSample>::get_sample_rate()
-{
-    return oscillator_.get_sample_rate();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-TSample NeuralWave<TSample>::get_frequency()
-{
-    return oscillator_.get_frequency();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline TSample NeuralWave<TSample>::run()
-{
-    return oscillator_.run();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline void NeuralWave<TSample>::run(TSample &output)
-{
-    oscillator_.run(output);
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-inline TSample NeuralWave<TSample>::get_last_sample()
-{
-    return oscillator_.get_last_sample();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void NeuralWave<TSample>::set_latent_space(const std::array<TSample, 8> &latent_space)
-{
-    latent_space_ = latent_space;
-    wavetable_ = decode(latent_space_);
-    set_wavetable_();
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void NeuralWave<TSample>::set_latent_parameter(const int &index, const TSample &value)
-{
-    if (index >= 0 && index < 8)
-    {
-        latent_space_.at(index) = value;
-        wavetable_ = decode(latent_space_);
-        set_wavetable_();
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-void NeuralWave<TSample>::set_windowed(const bool &use_window)
-{
-    windowed_ = use_window;
-    oscillator_.set_windowed(windowed_);
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::array<TSample, 8> NeuralWave<TSample>::get_latent_space()
-{
-    return latent_space_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::vector<TSample> NeuralWave<TSample>::get_wavetable(const unsigned int &size)
-{
-    if (size == wavetable_.size())
-    {
-        return wavetable_;
-    }
-    else
-    {
-        return resize_chunk(wavetable_, size);
-    }
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-bool NeuralWave<TSample>::get_windowed()
-{
-    return windowed_;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::vector<TSample> NeuralWave<TSample>::autoencode(const std::vector<TSample> &input)
-{
-    return decode(encode(input));
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::array<TSample, 8> NeuralWave<TSample>::encode(const std::vector<TSample> &input)
-{
-    std::vector<TSample> input600 = input.size() == 600 ? input : resize_chunk(input, 600);
-
-    std::array<TSample, 8> latent_space{(TSample)0.0};
-
-    return latent_space;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-std::vector<TSample> NeuralWave<TSample>::decode(const std::array<TSample, 8> &latent_space, const unsigned int &size)
-{
-    std::vector<TSample> output(600, (TSample)0.0);
-
-    for (auto s = 0; s < 600; s++)
-    {
-        TSample out_sample = weights_.biases.at(s);
-
-        for (auto l = 0; l < 8; l++)
-        {
-            out_sample += latent_space.at(l) * weights_.weights.at(s).at(l);
-        }
-
-        out_sample = std::tanh(out_sample);
-
-        output.at(s) = out_sample;
-    }
-
-    if (size != output.size())
-    {
-        output = resize_chunk(output, size);
-    }
-
-    return output;
-}
-
-template <typename TSample>
-#if __cplusplus >= 202002L
-requires std::floating_point<TSample>
-#endif
-class NeuralWeights
-{
-   public: 
-std::array<std::array<TSample, 8>, 600> weights = {{
-    {(TSample)0.03722768276929855, (TSample)0.08576939254999161, (TSample)-0.11918995529413223, (TSample)-0.1025790125131607, (TSample)0.1920522004365921, (TSample)0.17667576670646667, (TSample)-0.10470889508724213, (TSample)0.00217429525218904},
-    {(TSample)0.0972549170255661, (TSample)0.13069918751716614, (TSample)-0.14646492898464203, (TSample)-0.15825383365154266, (TSample)0.25371089577674866, (TSample)0.2845610976219177, (TSample)-0.18034620583057404, (TSample)0.03562922403216362},
-    {(TSample)0.13089443743228912, (TSample)0.15183940529823303, (TSample)-0.14255747199058533, (TSample)-0.17040781676769257, (TSample)0.2996736466884613, (TSample)0.31931647658348083, (TSample)-0.20758499205112457, (TSample)0.051433466374874115},
-    {(TSample)0.15546107292175293, (TSample)0.16297124326229095, (TSample)-0.14510954916477203, (TSample)-0.17339587211608887, (TSample)0.3361959159374237, (TSample)0.3471187651157379, (TSample)-0.23174962401390076, (TSample)0.06912849843502045},
-    {(TSample)0.1677856594324112, (TSample)0.16933739185333252, (TSample)-0.1456346958875656, (TSample)-0.1822192519903183, (TSample)0.3609094023704529, (TSample)0.3679724335670471, (TSample)-0.2501020133495331, (TSample)0.08899154514074326},
-    {(TSample)0.17967332899570465, (TSample)0.17205604910850525, (TSample)-0.14901646971702576, (TSample)-0.1956704705953598, (TSample)0.3860374391078949, (TSample)0.38922086358070374, (TSample)-0.26923617720603943, (TSample)0.10614918172359467},
-    {(TSample)0.1914789229631424, (TSample)0.17256872355937958, (TSample)-0.14972291886806488, (TSample)-0.21287456154823303, (TSample)0.40493258833885193, (TSample)0.4012327790260315, (TSample)-0.2837647795677185, (TSample)0.12195420265197754},
-    {(TSample)0.2007138580083847, (TSample)0.16877605020999908, (TSample)-0.15211543440818787, (TSample)-0.2303476333618164, (TSample)0.4285360872745514, (TSample)0.41268250346183777, (TSample)-0.30390483140945435, (TSample)0.1357208639383316},
-    {(TSample)0.21105632185935974, (TSample)0.17194508016109467, (TSample)-0.15091149508953094, (TSample)-0.24754062294960022, (TSample)0.4457527697086334, (TSample)0.4248638153076172, (TSample)-0.3178124725818634, (TSample)0.157048761844635},
-    {(TSample)0.22184741497039795, (TSample)0.16718174517154694, (TSample)-0.1522921770811081, (TSample)-0.2664519250392914, (TSample)0.4626850187778473, (TSample)0.44211143255233765, (TSample)-0.33240506052970886, (TSample)0.1759866625070572},
-    {(TSample)0.23178385198116302, (TSample)0.17027465999126434, (TSample)-0.14850668609142303, (TSample)-0.2870591878890991, (TSample)0.47869375348091125, (TSample)0.45629093050956726, (TSample)-0.3455565571784973, (TSample)0.20083333551883698},
-    {(TSample)0.23696616291999817, (TSample)0.16570402681827545, (TSample)-0.14409583806991577, (TSample)-0.3093441128730774, (TSample)0.49260661005973816, (TSample)0.46906745433807373, (TSample)-0.3565934896469116, (TSample)0.22035135328769684},
-    {(TSample)0.2448788434267044, (TSample)0.16418324410915375, (TSample)-0.13616207242012024, (TSample)-0.32688412070274353, (TSample)0.5044630169868469, (TSample)0.4792962670326233, (TSample)-0.3646964132785797, (TSample)0.24068856239318848},
-    {(TSample)0.25128424167633057, (TSample)0.15790186822414398, (TSample)-0.13617798686027527, (TSample)-0.3546062409877777, (TSample)0.5202478170394897, (TSample)0.4935314357280731, (TSample)-0.3772616982460022, (TSample)0.2639445960521698},
-    {(TSample)0.25805994868278503, (TSample)0.15488623082637787, (TSample)-0.12838713824748993, (TSample)-0.3764128088951111, (TSample)0.5280241370201111, (TSample)0.5050625205039978, (TSample)-0.385288268327713, (TSample)0.28662818670272827},
-    {(TSample)0.2581583857536316, (TSample)0.14868052303791046, (TSample)-0.1262192726135254, (TSample)-0.4063413739204407, (TSample)0.539858877658844, (TSample)0.5220643281936646, (TSample)-0.39562347531318665, (TSample)0.3103013336658478},
-    {(TSample)0.2659781575202942, (TSample)0.14761637151241302, (TSample)-0.11703971773386002, (TSample)-0.4315902590751648, (TSample)0.5444896221160889, (TSample)0.5389629006385803, (TSample)-0.40075457096099854, (TSample)0.3389660716056824},
-    {(TSample)0.26741740107536316, (TSample)0.13604377210140228, (TSample)-0.1122252568602562, (TSample)-0.4630647599697113, (TSample)0.5485522150993347, (TSample)0.5509952306747437, (TSample)-0.41002804040908813, (TSample)0.36151525378227234},
-    {(TSample)0.2728423476219177, (TSample)0.1300976574420929, (TSample)-0.10238014161586761, (TSample)-0.49103841185569763, (TSample)0.5506608486175537, (TSample)0.560591459274292, (TSample)-0.4143100082874298, (TSample)0.38398319482803345},
-    {(TSample)0.2789401412010193, (TSample)0.11625171452760696, (TSample)-0.09918873757123947, (TSample)-0.5230275392532349, (TSample)0.5488016605377197, (TSample)0.5723495483398438, (TSample)-0.41879552602767944, (TSample)0.4069932699203491},
-    {(TSample)0.2851448655128479, (TSample)0.1110655814409256, (TSample)-0.09251870959997177, (TSample)-0.5454465746879578, (TSample)0.5480010509490967, (TSample)0.5825434327125549, (TSample)-0.42099514603614807, (TSample)0.4316173195838928},
-    {(TSample)0.28143733739852905, (TSample)0.09807354211807251, (TSample)-0.09055517613887787, (TSample)-0.5725618004798889, (TSample)0.5495537519454956, (TSample)0.5918247699737549, (TSample)-0.427357017993927, (TSample)0.4474782645702362},
-    {(TSample)0.2807825207710266, (TSample)0.09029264748096466, (TSample)-0.08563131093978882, (TSample)-0.5958317518234253, (TSample)0.5461543202400208, (TSample)0.6001181602478027, (TSample)-0.4272419214248657, (TSample)0.4655302166938782},
-    {(TSample)0.2757193148136139, (TSample)0.07900624722242355, (TSample)-0.08084757626056671, (TSample)-0.6254136562347412, (TSample)0.5470272302627563, (TSample)0.6117352843284607, (TSample)-0.4287865459918976, (TSample)0.4814930558204651},
-    {(TSample)0.27665191888809204, (TSample)0.06970790028572083, (TSample)-0.07323900610208511, (TSample)-0.642747700214386, (TSample)0.5387697815895081, (TSample)0.614139974117279, (TSample)-0.4265926778316498, (TSample)0.498853862285614},
-    {(TSample)0.27094411849975586, (TSample)0.05495437979698181, (TSample)-0.07262659817934036, (TSample)-0.6703249216079712, (TSample)0.5402239561080933, (TSample)0.6231212615966797, (TSample)-0.43031957745552063, (TSample)0.5092646479606628},
-    {(TSample)0.27100899815559387, (TSample)0.04177384078502655, (TSample)-0.06264147907495499, (TSample)-0.6888906359672546, (TSample)0.5281728506088257, (TSample)0.6265552639961243, (TSample)-0.42779234051704407, (TSample)0.5227465629577637},
-    {(TSample)0.263859361410141, (TSample)0.021977467462420464, (TSample)-0.05403737351298332, (TSample)-0.7162022590637207, (TSample)0.5181882977485657, (TSample)0.6344521045684814, (TSample)-0.4277665615081787, (TSample)0.5327007174491882},
-    {(TSample)0.258114755153656, (TSample)-0.0007743092719465494, (TSample)-0.03335604816675186, (TSample)-0.7391188740730286, (TSample)0.4917655885219574, (TSample)0.6372618079185486, (TSample)-0.42462724447250366, (TSample)0.5421952605247498},
-    {(TSample)0.25398391485214233, (TSample)-0.01757664419710636, (TSample)-0.027140483260154724, (TSample)-0.7638333439826965, (TSample)0.48193657398223877, (TSample)0.6448487639427185, (TSample)-0.4229181110858917, (TSample)0.5534819960594177},
-    {(TSample)0.25023844838142395, (TSample)-0.03417978063225746, (TSample)-0.01648435927927494, (TSample)-0.7815008163452148, (TSample)0.46486717462539673, (TSample)0.6494631171226501, (TSample)-0.41486310958862305, (TSample)0.5638054609298706},
-    {(TSample)0.23654858767986298, (TSample)-0.05562420189380646, (TSample)-0.007296427618712187, (TSample)-0.807325005531311, (TSample)0.44352808594703674, (TSample)0.6537644267082214, (TSample)-0.40964195132255554, (TSample)0.5728587508201599},
-    {(TSample)0.22783656418323517, (TSample)-0.07612714916467667, (TSample)0.008266065269708633, (TSample)-0.8323490023612976, (TSample)0.4200550615787506, (TSample)0.6568822860717773, (TSample)-0.4052889049053192, (TSample)0.5794434547424316},
-    {(TSample)0.22070331871509552, (TSample)-0.09379346668720245, (TSample)0.01336259488016367, (TSample)-0.8575727343559265, (TSample)0.4042385220527649, (TSample)0.6631386876106262, (TSample)-0.4014759361743927, (TSample)0.5922774076461792},
-    {(TSample)0.21302521228790283, (TSample)-0.10820511728525162, (TSample)0.02311854064464569, (TSample)-0.8757885694503784, (TSample)0.3824121654033661, (TSample)0.6630949378013611, (TSample)-0.39246299862861633, (TSample)0.5997169613838196},
-    {(TSample)0.2007143795490265, (TSample)-0.12519772350788116, (TSample)0.02425766922533512, (TSample)-0.8995097875595093, (TSample)0.3658526539802551, (TSample)0.6677739024162292, (TSample)-0.38450324535369873, (TSample)0.605384886264801},
-    {(TSample)0.1862889677286148, (TSample)-0.14225055277347565, (TSample)0.033169958740472794, (TSample)-0.9239935874938965, (TSample)0.33944353461265564, (TSample)0.6641716957092285, (TSample)-0.371440589427948, (TSample)0.6106776595115662},
-    {(TSample)0.16885623335838318, (TSample)-0.16607151925563812, (TSample)0.030980553478002548, (TSample)-0.9544861316680908, (TSample)0.32409054040908813, (TSample)0.6622780561447144, (TSample)-0.3577074408531189, (TSample)0.6082378625869751},
-    {(TSample)0.16101229190826416, (TSample)-0.18198072910308838, (TSample)0.035252366214990616, (TSample)-0.9796109199523926, (TSample)0.2973020374774933, (TSample)0.6553195118904114, (TSample)-0.3426322340965271, (TSample)0.6181649565696716},
-    {(TSample)0.1419297605752945, (TSample)-0.19340963661670685, (TSample)0.0318075530230999, (TSample)-1.0060375928878784, (TSample)0.28402307629585266, (TSample)0.6614506840705872, (TSample)-0.3324960470199585, (TSample)0.6214855909347534},
-    {(TSample)0.1332951933145523, (TSample)-0.2032729536294937, (TSample)0.03505108505487442, (TSample)-1.0176695585250854, (TSample)0.263765424489975, (TSample)0.6586663126945496, (TSample)-0.3189895451068878, (TSample)0.6268631815910339},
-    {(TSample)0.11687712371349335, (TSample)-0.22126737236976624, (TSample)0.03610939532518387, (TSample)-1.0391218662261963, (TSample)0.24412845075130463, (TSample)0.6623427867889404, (TSample)-0.3083907663822174, (TSample)0.6283758282661438},
-    {(TSample)0.10640846192836761, (TSample)-0.23453101515769958, (TSample)0.0421675480902195, (TSample)-1.0529369115829468, (TSample)0.2212752103805542, (TSample)0.656545102596283, (TSample)-0.29402339458465576, (TSample)0.630828320980072},
-    {(TSample)0.06539793312549591, (TSample)-0.2648317813873291, (TSample)0.030009053647518158, (TSample)-1.0948143005371094, (TSample)0.20965078473091125, (TSample)0.6482009887695312, (TSample)-0.28112316131591797, (TSample)0.6146546602249146},
-    {(TSample)0.044273290783166885, (TSample)-0.27950918674468994, (TSample)0.03738660737872124, (TSample)-1.113057017326355, (TSample)0.18187816441059113, (TSample)0.6422893404960632, (TSample)-0.2635560631752014, (TSample)0.6120418310165405},
-    {(TSample)0.025055041536688805, (TSample)-0.2940157651901245, (TSample)0.0384981669485569, (TSample)-1.1299283504486084, (TSample)0.1596231758594513, (TSample)0.6413761973381042, (TSample)-0.25007161498069763, (TSample)0.613231897354126},
-    {(TSample)0.005417820066213608, (TSample)-0.3043511211872101, (TSample)0.053394559770822525, (TSample)-1.141844630241394, (TSample)0.1338893622159958, (TSample)0.6372746825218201, (TSample)-0.23097379505634308, (TSample)0.6166214942932129},
-    {(TSample)-0.011830595321953297, (TSample)-0.323337584733963, (TSample)0.051503896713256836, (TSample)-1.1610451936721802, (TSample)0.11207153648138046, (TSample)0.6365723013877869, (TSample)-0.2148606926202774, (TSample)0.615134060382843},
-    {(TSample)-0.02560599334537983, (TSample)-0.3348281979560852, (TSample)0.05672186613082886, (TSample)-1.1704519987106323, (TSample)0.08606941998004913, (TSample)0.6310898065567017, (TSample)-0.19603285193443298, (TSample)0.6154550313949585},
-    {(TSample)-0.04601842910051346, (TSample)-0.3479980528354645, (TSample)0.057812295854091644, (TSample)-1.185126543045044, (TSample)0.06482161581516266, (TSample)0.6250081062316895, (TSample)-0.17988255620002747, (TSample)0.6128674745559692},
-    {(TSample)-0.0610409751534462, (TSample)-0.3592980206012726, (TSample)0.061535075306892395, (TSample)-1.195637822151184, (TSample)0.038246702402830124, (TSample)0.619910478591919, (TSample)-0.161950945854187, (TSample)0.6131067872047424},
-    {(TSample)-0.08041109144687653, (TSample)-0.3731135427951813, (TSample)0.06295276433229446, (TSample)-1.2112574577331543, (TSample)0.022276485338807106, (TSample)0.6166912913322449, (TSample)-0.15063787996768951, (TSample)0.6102409362792969},
-    {(TSample)-0.09211835265159607, (TSample)-0.38367223739624023, (TSample)0.06812626123428345, (TSample)-1.2152689695358276, (TSample)-0.005178290419280529, (TSample)0.6085243821144104, (TSample)-0.12850311398506165, (TSample)0.607134997844696},
-    {(TSample)-0.10990971326828003, (TSample)-0.3952421247959137, (TSample)0.06500502675771713, (TSample)-1.2254443168640137, (TSample)-0.0210881344974041, (TSample)0.6045557856559753, (TSample)-0.1124584749341011, (TSample)0.6015327572822571},
-    {(TSample)-0.11515061557292938, (TSample)-0.3867337107658386, (TSample)0.06183699518442154, (TSample)-1.222203254699707, (TSample)-0.04170079156756401, (TSample)0.6063485741615295, (TSample)-0.08224202692508698, (TSample)0.606452465057373},
-    {(TSample)-0.13820436596870422, (TSample)-0.3952423334121704, (TSample)0.05089644715189934, (TSample)-1.2316231727600098, (TSample)-0.05835868418216705, (TSample)0.6109314560890198, (TSample)-0.06569627672433853, (TSample)0.5985387563705444},
-    {(TSample)-0.15629437565803528, (TSample)-0.4031009078025818, (TSample)0.06386788189411163, (TSample)-1.2400168180465698, (TSample)-0.09103857725858688, (TSample)0.6024961471557617, (TSample)-0.03230931982398033, (TSample)0.5956767797470093},
-    {(TSample)-0.17711438238620758, (TSample)-0.41266170144081116, (TSample)0.0630728080868721, (TSample)-1.2518197298049927, (TSample)-0.1093233972787857, (TSample)0.5997630953788757, (TSample)-0.00903342105448246, (TSample)0.5909678339958191},
-    {(TSample)-0.1918606460094452, (TSample)-0.4093517065048218, (TSample)0.058762259781360626, (TSample)-1.2525969743728638, (TSample)-0.11777282506227493, (TSample)0.590539276599884, (TSample)0.007359977811574936, (TSample)0.5871230959892273},
-    {(TSample)-0.21406660974025726, (TSample)-0.4185243844985962, (TSample)0.050789136439561844, (TSample)-1.2602487802505493, (TSample)-0.134993314743042, (TSample)0.5875964164733887, (TSample)0.02472943812608719, (TSample)0.5788639783859253},
-    {(TSample)-0.2312774807214737, (TSample)-0.41948679089546204, (TSample)0.04902444779872894, (TSample)-1.2548941373825073, (TSample)-0.1601991206407547, (TSample)0.5810341835021973, (TSample)0.046037428081035614, (TSample)0.5747036933898926},
-    {(TSample)-0.2552816867828369, (TSample)-0.4330155551433563, (TSample)0.03678848221898079, (TSample)-1.2646013498306274, (TSample)-0.1772729754447937, (TSample)0.57423335313797, (TSample)0.061894871294498444, (TSample)0.5596768260002136},
-    {(TSample)-0.2744672894477844, (TSample)-0.43371862173080444, (TSample)0.03907603397965431, (TSample)-1.2614552974700928, (TSample)-0.19823262095451355, (TSample)0.5676767230033875, (TSample)0.08561104536056519, (TSample)0.5565112233161926},
-    {(TSample)-0.30450478196144104, (TSample)-0.43729889392852783, (TSample)0.03386339917778969, (TSample)-1.2672232389450073, (TSample)-0.22145844995975494, (TSample)0.5634428858757019, (TSample)0.10902415961027145, (TSample)0.5520298480987549},
-    {(TSample)-0.3245229423046112, (TSample)-0.43625423312187195, (TSample)0.03350210189819336, (TSample)-1.2625888586044312, (TSample)-0.2476319968700409, (TSample)0.554530680179596, (TSample)0.13449420034885406, (TSample)0.5500360727310181},
-    {(TSample)-0.35150954127311707, (TSample)-0.4435702860355377, (TSample)0.029144132509827614, (TSample)-1.2611525058746338, (TSample)-0.26423120498657227, (TSample)0.547516942024231, (TSample)0.15506671369075775, (TSample)0.5354623198509216},
-    {(TSample)-0.37222450971603394, (TSample)-0.44317302107810974, (TSample)0.03105725534260273, (TSample)-1.2535477876663208, (TSample)-0.282967209815979, (TSample)0.5359013676643372, (TSample)0.17893829941749573, (TSample)0.5279161334037781},
-    {(TSample)-0.39762064814567566, (TSample)-0.4516899585723877, (TSample)0.02415144443511963, (TSample)-1.2512325048446655, (TSample)-0.30138668417930603, (TSample)0.5288084745407104, (TSample)0.2012912929058075, (TSample)0.5178960561752319},
-    {(TSample)-0.42326804995536804, (TSample)-0.44485506415367126, (TSample)0.03512182831764221, (TSample)-1.248508334159851, (TSample)-0.3216826021671295, (TSample)0.5200753211975098, (TSample)0.23425006866455078, (TSample)0.5122400522232056},
-    {(TSample)-0.4483073651790619, (TSample)-0.44419535994529724, (TSample)0.030031152069568634, (TSample)-1.251494288444519, (TSample)-0.3325566053390503, (TSample)0.5158873200416565, (TSample)0.2518700361251831, (TSample)0.5036128163337708},
-    {(TSample)-0.4666022062301636, (TSample)-0.44045335054397583, (TSample)0.032553765922784805, (TSample)-1.2454991340637207, (TSample)-0.3470340073108673, (TSample)0.5051826238632202, (TSample)0.2781904637813568, (TSample)0.4966764450073242},
-    {(TSample)-0.4877375066280365, (TSample)-0.4402850866317749, (TSample)0.017899423837661743, (TSample)-1.2457020282745361, (TSample)-0.3547830283641815, (TSample)0.4996558129787445, (TSample)0.2934688329696655, (TSample)0.48385876417160034},
-    {(TSample)-0.511702299118042, (TSample)-0.42992502450942993, (TSample)0.019036324694752693, (TSample)-1.2471553087234497, (TSample)-0.3701929450035095, (TSample)0.48151180148124695, (TSample)0.32728302478790283, (TSample)0.4700562655925751},
-    {(TSample)-0.5358154773712158, (TSample)-0.41982895135879517, (TSample)0.013211367651820183, (TSample)-1.2481845617294312, (TSample)-0.3782995045185089, (TSample)0.4741520285606384, (TSample)0.34770694375038147, (TSample)0.4635451138019562},
-    {(TSample)-0.5508944988250732, (TSample)-0.4126957654953003, (TSample)-0.0029087672010064125, (TSample)-1.2305796146392822, (TSample)-0.3891105055809021, (TSample)0.46411141753196716, (TSample)0.37101680040359497, (TSample)0.45735567808151245},
-    {(TSample)-0.5787780284881592, (TSample)-0.406935453414917, (TSample)-0.03535637632012367, (TSample)-1.219253420829773, (TSample)-0.391257107257843, (TSample)0.4494580924510956, (TSample)0.38489338755607605, (TSample)0.4455462396144867},
-    {(TSample)-0.6034987568855286, (TSample)-0.3940974473953247, (TSample)-0.06115809082984924, (TSample)-1.2050107717514038, (TSample)-0.40100568532943726, (TSample)0.43315577507019043, (TSample)0.4084048867225647, (TSample)0.42703181505203247},
-    {(TSample)-0.6283010244369507, (TSample)-0.3867126405239105, (TSample)-0.07838500291109085, (TSample)-1.203813910484314, (TSample)-0.40469789505004883, (TSample)0.4246070683002472, (TSample)0.4264184832572937, (TSample)0.40854257345199585},
-    {(TSample)-0.6430942416191101, (TSample)-0.3775133192539215, (TSample)-0.08286076039075851, (TSample)-1.1957948207855225, (TSample)-0.4196094870567322, (TSample)0.41439539194107056, (TSample)0.4502505958080292, (TSample)0.4018993675708771},
-    {(TSample)-0.6704401969909668, (TSample)-0.3667328655719757, (TSample)-0.09953410923480988, (TSample)-1.1927727460861206, (TSample)-0.4240034520626068, (TSample)0.4141538143157959, (TSample)0.4735962152481079, (TSample)0.3829365670681},
-    {(TSample)-0.6907563209533691, (TSample)-0.3540031909942627, (TSample)-0.10820428282022476, (TSample)-1.1781114339828491, (TSample)-0.43816253542900085, (TSample)0.4079924523830414, (TSample)0.49972277879714966, (TSample)0.36999213695526123},
-    {(TSample)-0.7162814736366272, (TSample)-0.3498441278934479, (TSample)-0.1272033154964447, (TSample)-1.1765813827514648, (TSample)-0.4418623149394989, (TSample)0.3999828100204468, (TSample)0.5152624845504761, (TSample)0.35400357842445374},
-    {(TSample)-0.7352254390716553, (TSample)-0.3461502492427826, (TSample)-0.13534577190876007, (TSample)-1.1722184419631958, (TSample)-0.44954681396484375, (TSample)0.380756676197052, (TSample)0.5260793566703796, (TSample)0.3345234990119934},
-    {(TSample)-0.7506081461906433, (TSample)-0.33358776569366455, (TSample)-0.15357179939746857, (TSample)-1.1667931079864502, (TSample)-0.4582972228527069, (TSample)0.38141098618507385, (TSample)0.549375593662262, (TSample)0.3156764805316925},
-    {(TSample)-0.7623371481895447, (TSample)-0.32059183716773987, (TSample)-0.16706515848636627, (TSample)-1.156356692314148, (TSample)-0.4717763066291809, (TSample)0.3746434450149536, (TSample)0.5651869177818298, (TSample)0.3028176426887512},
-    {(TSample)-0.7809484004974365, (TSample)-0.3087005913257599, (TSample)-0.1856299340724945, (TSample)-1.1560100317001343, (TSample)-0.4789547920227051, (TSample)0.37160724401474, (TSample)0.5799965858459473, (TSample)0.288152813911438},
-    {(TSample)-0.788956344127655, (TSample)-0.2886681854724884, (TSample)-0.20119427144527435, (TSample)-1.1398792266845703, (TSample)-0.48674505949020386, (TSample)0.36605963110923767, (TSample)0.6028032898902893, (TSample)0.27560296654701233},
-    {(TSample)-0.8035144209861755, (TSample)-0.2670031189918518, (TSample)-0.22297044098377228, (TSample)-1.1277402639389038, (TSample)-0.4877549707889557, (TSample)0.36363962292671204, (TSample)0.6176655292510986, (TSample)0.2666007876396179},
-    {(TSample)-0.8166748881340027, (TSample)-0.24719731509685516, (TSample)-0.2411797195672989, (TSample)-1.1133100986480713, (TSample)-0.4932938516139984, (TSample)0.3540765941143036, (TSample)0.6305520534515381, (TSample)0.2599070966243744},
-    {(TSample)-0.8385254740715027, (TSample)-0.23515143990516663, (TSample)-0.266116738319397, (TSample)-1.1048338413238525, (TSample)-0.48842278122901917, (TSample)0.3479052186012268, (TSample)0.6378009915351868, (TSample)0.2447986602783203},
-    {(TSample)-0.8503437042236328, (TSample)-0.21726156771183014, (TSample)-0.27869096398353577, (TSample)-1.0927956104278564, (TSample)-0.4964560568332672, (TSample)0.33765915036201477, (TSample)0.6614519357681274, (TSample)0.2309918999671936},
-    {(TSample)-0.8680289387702942, (TSample)-0.1999778151512146, (TSample)-0.29888179898262024, (TSample)-1.0877504348754883, (TSample)-0.4925752282142639, (TSample)0.3260335624217987, (TSample)0.6751288175582886, (TSample)0.21471568942070007},
-    {(TSample)-0.8824631571769714, (TSample)-0.18651838600635529, (TSample)-0.32356250286102295, (TSample)-1.0728281736373901, (TSample)-0.4917936325073242, (TSample)0.32328617572784424, (TSample)0.6869760751724243, (TSample)0.19753487408161163},
-    {(TSample)-0.9054543972015381, (TSample)-0.1756826490163803, (TSample)-0.357400119304657, (TSample)-1.0733672380447388, (TSample)-0.4844416677951813, (TSample)0.31590843200683594, (TSample)0.6975316405296326, (TSample)0.17092210054397583},
-    {(TSample)-0.9162653684616089, (TSample)-0.14996938407421112, (TSample)-0.3787086009979248, (TSample)-1.0561414957046509, (TSample)-0.4873177409172058, (TSample)0.30528828501701355, (TSample)0.7113054990768433, (TSample)0.1611558496952057},
-    {(TSample)-0.9320928454399109, (TSample)-0.12855251133441925, (TSample)-0.4139630198478699, (TSample)-1.0463448762893677, (TSample)-0.4784524738788605, (TSample)0.29930421710014343, (TSample)0.7189985513687134, (TSample)0.14615125954151154},
-    {(TSample)-0.9383507370948792, (TSample)-0.10311300307512283, (TSample)-0.43860065937042236, (TSample)-1.0266132354736328, (TSample)-0.48143285512924194, (TSample)0.2952536344528198, (TSample)0.7349682450294495, (TSample)0.13696525990962982},
-    {(TSample)-0.9530535340309143, (TSample)-0.08504384756088257, (TSample)-0.4645932912826538, (TSample)-1.0222841501235962, (TSample)-0.4791855216026306, (TSample)0.29136696457862854, (TSample)0.7520619034767151, (TSample)0.11983446776866913},
-    {(TSample)-0.9607841372489929, (TSample)-0.06026512384414673, (TSample)-0.4772845506668091, (TSample)-1.0066628456115723, (TSample)-0.4843149483203888, (TSample)0.28774121403694153, (TSample)0.7646082043647766, (TSample)0.1133558377623558},
-    {(TSample)-0.9688698053359985, (TSample)-0.0399937778711319, (TSample)-0.5060282349586487, (TSample)-0.9931144118309021, (TSample)-0.4718201458454132, (TSample)0.2786323130130768, (TSample)0.7793838381767273, (TSample)0.10744761675596237},
-    {(TSample)-0.9943961501121521, (TSample)-0.015996480360627174, (TSample)-0.5486413240432739, (TSample)-0.9914821982383728, (TSample)-0.4459502398967743, (TSample)0.2672072649002075, (TSample)0.7887229919433594, (TSample)0.07189176231622696},
-    {(TSample)-1.0023071765899658, (TSample)-0.0007373729022219777, (TSample)-0.5741376876831055, (TSample)-0.9791314005851746, (TSample)-0.4401194155216217, (TSample)0.2653931677341461, (TSample)0.7929301261901855, (TSample)0.05716800317168236},
-    {(TSample)-1.0126290321350098, (TSample)0.022519776597619057, (TSample)-0.5937225818634033, (TSample)-0.9670047760009766, (TSample)-0.43586692214012146, (TSample)0.2664474546909332, (TSample)0.8068057894706726, (TSample)0.044540129601955414},
-    {(TSample)-1.021078109741211, (TSample)0.04137924313545227, (TSample)-0.6138026714324951, (TSample)-0.9569726586341858, (TSample)-0.43239203095436096, (TSample)0.2682531476020813, (TSample)0.8130117654800415, (TSample)0.03465552628040314},
-    {(TSample)-1.0290030241012573, (TSample)0.06648091971874237, (TSample)-0.6314289569854736, (TSample)-0.9384577870368958, (TSample)-0.4249653220176697, (TSample)0.2697593867778778, (TSample)0.8136815428733826, (TSample)0.027202608063817024},
-    {(TSample)-1.0399867296218872, (TSample)0.08517251908779144, (TSample)-0.6530010104179382, (TSample)-0.9279736280441284, (TSample)-0.41510704159736633, (TSample)0.2689940333366394, (TSample)0.82057124376297, (TSample)0.00801972858607769},
-    {(TSample)-1.0453675985336304, (TSample)0.10453597456216812, (TSample)-0.6668663620948792, (TSample)-0.9102023243904114, (TSample)-0.41540759801864624, (TSample)0.2684658467769623, (TSample)0.8273914456367493, (TSample)0.00036757878842763603},
-    {(TSample)-1.0437613725662231, (TSample)0.13861629366874695, (TSample)-0.6872326731681824, (TSample)-0.8932904601097107, (TSample)-0.40839388966560364, (TSample)0.27371346950531006, (TSample)0.8390640616416931, (TSample)-0.001999368891119957},
-    {(TSample)-1.042535424232483, (TSample)0.16019316017627716, (TSample)-0.7029457688331604, (TSample)-0.8729848265647888, (TSample)-0.4022520184516907, (TSample)0.2723332941532135, (TSample)0.8383750319480896, (TSample)-0.004324411042034626},
-    {(TSample)-1.049134612083435, (TSample)0.1790362000465393, (TSample)-0.7244904041290283, (TSample)-0.8577753901481628, (TSample)-0.3918730914592743, (TSample)0.2686278223991394, (TSample)0.838660717010498, (TSample)-0.01726273074746132},
-    {(TSample)-1.0406335592269897, (TSample)0.20840148627758026, (TSample)-0.7474652528762817, (TSample)-0.8331089019775391, (TSample)-0.3902151882648468, (TSample)0.2767137289047241, (TSample)0.842542827129364, (TSample)-0.01724429614841938},
-    {(TSample)-1.0362269878387451, (TSample)0.2308877557516098, (TSample)-0.7702065706253052, (TSample)-0.8135775923728943, (TSample)-0.3805364668369293, (TSample)0.27792486548423767, (TSample)0.8390768766403198, (TSample)-0.022624969482421875},
-    {(TSample)-1.0311942100524902, (TSample)0.25642451643943787, (TSample)-0.7848343849182129, (TSample)-0.7929328083992004, (TSample)-0.3690203130245209, (TSample)0.2726901173591614, (TSample)0.8286216259002686, (TSample)-0.023919101804494858},
-    {(TSample)-1.0191398859024048, (TSample)0.28968939185142517, (TSample)-0.8068670630455017, (TSample)-0.7698177695274353, (TSample)-0.3503566086292267, (TSample)0.2684131860733032, (TSample)0.817875862121582, (TSample)-0.027738207951188087},
-    {(TSample)-1.0165494680404663, (TSample)0.3190118670463562, (TSample)-0.8312823176383972, (TSample)-0.7544839382171631, (TSample)-0.33466237783432007, (TSample)0.26253411173820496, (TSample)0.8143517971038818, (TSample)-0.0407291054725647},
-    {(TSample)-1.0090411901474, (TSample)0.34462305903434753, (TSample)-0.8526413440704346, (TSample)-0.737805962562561, (TSample)-0.32299938797950745, (TSample)0.2620203197002411, (TSample)0.8123136162757874, (TSample)-0.044527485966682434},
-    {(TSample)-1.0043480396270752, (TSample)0.3674425184726715, (TSample)-0.8796398043632507, (TSample)-0.7261889576911926, (TSample)-0.30916041135787964, (TSample)0.25630632042884827, (TSample)0.8081929683685303, (TSample)-0.055160194635391235},
-    {(TSample)-0.9971083998680115, (TSample)0.39372557401657104, (TSample)-0.9055824279785156, (TSample)-0.7154598832130432, (TSample)-0.2960060238838196, (TSample)0.24924318492412567, (TSample)0.8034451007843018, (TSample)-0.06357000023126602},
-    {(TSample)-0.9905416965484619, (TSample)0.41923874616622925, (TSample)-0.9176761507987976, (TSample)-0.7000995874404907, (TSample)-0.29057776927948, (TSample)0.24919423460960388, (TSample)0.798416256904602, (TSample)-0.05771619454026222},
-    {(TSample)-0.9831255674362183, (TSample)0.44663217663764954, (TSample)-0.9384636282920837, (TSample)-0.6869600415229797, (TSample)-0.27873489260673523, (TSample)0.24305188655853271, (TSample)0.7923693656921387, (TSample)-0.06145044043660164},
-    {(TSample)-0.9704455137252808, (TSample)0.4711458086967468, (TSample)-0.9620858430862427, (TSample)-0.6707777380943298, (TSample)-0.27096307277679443, (TSample)0.24152374267578125, (TSample)0.7809037566184998, (TSample)-0.061115968972444534},
-    {(TSample)-0.9594600796699524, (TSample)0.4911908507347107, (TSample)-0.9887144565582275, (TSample)-0.6529413461685181, (TSample)-0.2593391537666321, (TSample)0.2405870258808136, (TSample)0.7759822010993958, (TSample)-0.0665816143155098},
-    {(TSample)-0.9439464807510376, (TSample)0.5131272673606873, (TSample)-1.0049136877059937, (TSample)-0.632461428642273, (TSample)-0.25444772839546204, (TSample)0.23789379000663757, (TSample)0.7663901448249817, (TSample)-0.059444062411785126},
-    {(TSample)-0.9300326704978943, (TSample)0.5433030724525452, (TSample)-1.0336475372314453, (TSample)-0.6161623597145081, (TSample)-0.24079325795173645, (TSample)0.2396877259016037, (TSample)0.7598159313201904, (TSample)-0.0610438734292984},
-    {(TSample)-0.9198710918426514, (TSample)0.570784866809845, (TSample)-1.0531328916549683, (TSample)-0.6006017923355103, (TSample)-0.23170976340770721, (TSample)0.23597301542758942, (TSample)0.7507544159889221, (TSample)-0.061841659247875214},
-    {(TSample)-0.910785973072052, (TSample)0.5970878601074219, (TSample)-1.075360894203186, (TSample)-0.5868452191352844, (TSample)-0.2178373634815216, (TSample)0.23381774127483368, (TSample)0.744076669216156, (TSample)-0.06750209629535675},
-    {(TSample)-0.8978079557418823, (TSample)0.6170775294303894, (TSample)-1.091691255569458, (TSample)-0.5719087719917297, (TSample)-0.20657330751419067, (TSample)0.23508009314537048, (TSample)0.7333949208259583, (TSample)-0.063510961830616},
-    {(TSample)-0.8900688886642456, (TSample)0.6369425058364868, (TSample)-1.1092783212661743, (TSample)-0.5605000257492065, (TSample)-0.19283458590507507, (TSample)0.23348568379878998, (TSample)0.7311038374900818, (TSample)-0.0678117647767067},
-    {(TSample)-0.8788347840309143, (TSample)0.6546816825866699, (TSample)-1.1222580671310425, (TSample)-0.5477848052978516, (TSample)-0.1890927106142044, (TSample)0.23327812552452087, (TSample)0.7203986048698425, (TSample)-0.0643109679222107},
-    {(TSample)-0.8694089651107788, (TSample)0.6703903079032898, (TSample)-1.151092767715454, (TSample)-0.5349651575088501, (TSample)-0.1748061329126358, (TSample)0.22584548592567444, (TSample)0.7091071605682373, (TSample)-0.06667786091566086},
-    {(TSample)-0.8572149276733398, (TSample)0.6867033839225769, (TSample)-1.1675570011138916, (TSample)-0.5228853821754456, (TSample)-0.16870945692062378, (TSample)0.22250407934188843, (TSample)0.6953645348548889, (TSample)-0.06374277174472809},
-    {(TSample)-0.8453888893127441, (TSample)0.7065454721450806, (TSample)-1.1948503255844116, (TSample)-0.5071737170219421, (TSample)-0.1591988056898117, (TSample)0.21261635422706604, (TSample)0.6795013546943665, (TSample)-0.061524029821157455},
-    {(TSample)-0.8326618075370789, (TSample)0.7297658324241638, (TSample)-1.2145003080368042, (TSample)-0.48787614703178406, (TSample)-0.15307006239891052, (TSample)0.20439596474170685, (TSample)0.6556093096733093, (TSample)-0.051133133471012115},
-    {(TSample)-0.8208717107772827, (TSample)0.7451211214065552, (TSample)-1.2345912456512451, (TSample)-0.473672091960907, (TSample)-0.14163091778755188, (TSample)0.19850175082683563, (TSample)0.640947699546814, (TSample)-0.05821061134338379},
-    {(TSample)-0.8081892132759094, (TSample)0.7580798268318176, (TSample)-1.2473340034484863, (TSample)-0.4635555148124695, (TSample)-0.140059694647789, (TSample)0.1962776482105255, (TSample)0.6254367828369141, (TSample)-0.055520690977573395},
-    {(TSample)-0.8013458847999573, (TSample)0.7749575972557068, (TSample)-1.2586427927017212, (TSample)-0.4606873691082001, (TSample)-0.12902256846427917, (TSample)0.18499411642551422, (TSample)0.6122084259986877, (TSample)-0.06277985870838165},
-    {(TSample)-0.7864487171173096, (TSample)0.7836278080940247, (TSample)-1.2771881818771362, (TSample)-0.4490738809108734, (TSample)-0.12517544627189636, (TSample)0.1747906357049942, (TSample)0.5862456560134888, (TSample)-0.05658873915672302},
-    {(TSample)-0.767401397228241, (TSample)0.7978171706199646, (TSample)-1.2925184965133667, (TSample)-0.44025343656539917, (TSample)-0.12176018208265305, (TSample)0.16941481828689575, (TSample)0.5642200708389282, (TSample)-0.05237162485718727},
-    {(TSample)-0.7524996399879456, (TSample)0.8124901652336121, (TSample)-1.307297945022583, (TSample)-0.42742523550987244, (TSample)-0.11922411620616913, (TSample)0.16872453689575195, (TSample)0.540915310382843, (TSample)-0.04202691465616226},
-    {(TSample)-0.7330335974693298, (TSample)0.8213121294975281, (TSample)-1.3205153942108154, (TSample)-0.42243245244026184, (TSample)-0.11324834823608398, (TSample)0.16261538863182068, (TSample)0.5149064660072327, (TSample)-0.04437384381890297},
-    {(TSample)-0.7090383768081665, (TSample)0.8266876935958862, (TSample)-1.3376522064208984, (TSample)-0.40982526540756226, (TSample)-0.10967499762773514, (TSample)0.16365943849086761, (TSample)0.4879148006439209, (TSample)-0.040843330323696136},
-    {(TSample)-0.6941297650337219, (TSample)0.8297657370567322, (TSample)-1.3520336151123047, (TSample)-0.40274977684020996, (TSample)-0.10552111268043518, (TSample)0.1571832150220871, (TSample)0.4662874937057495, (TSample)-0.04359821230173111},
-    {(TSample)-0.6800395846366882, (TSample)0.8465524315834045, (TSample)-1.362237572669983, (TSample)-0.3937894403934479, (TSample)-0.09636881202459335, (TSample)0.15166155993938446, (TSample)0.4451589286327362, (TSample)-0.038160379976034164},
-    {(TSample)-0.6650757789611816, (TSample)0.8499029874801636, (TSample)-1.3773423433303833, (TSample)-0.3905123770236969, (TSample)-0.09306517243385315, (TSample)0.14380387961864471, (TSample)0.4244486093521118, (TSample)-0.039362501353025436},
-    {(TSample)-0.6445392966270447, (TSample)0.8542067408561707, (TSample)-1.3856024742126465, (TSample)-0.3866710662841797, (TSample)-0.09445469081401825, (TSample)0.13828760385513306, (TSample)0.4040312170982361, (TSample)-0.03670785576105118},
-    {(TSample)-0.6282218098640442, (TSample)0.8554527759552002, (TSample)-1.3959447145462036, (TSample)-0.3830977976322174, (TSample)-0.08921020478010178, (TSample)0.1277691125869751, (TSample)0.3856058716773987, (TSample)-0.04099535197019577},
-    {(TSample)-0.6078499555587769, (TSample)0.8624602556228638, (TSample)-1.4059820175170898, (TSample)-0.3797161877155304, (TSample)-0.08192219585180283, (TSample)0.11149276047945023, (TSample)0.36392727494239807, (TSample)-0.04070951044559479},
-    {(TSample)-0.5925489068031311, (TSample)0.8621026873588562, (TSample)-1.4200541973114014, (TSample)-0.3685578405857086, (TSample)-0.07502756267786026, (TSample)0.09930697828531265, (TSample)0.33742406964302063, (TSample)-0.04068794474005699},
-    {(TSample)-0.5671801567077637, (TSample)0.8675862550735474, (TSample)-1.427237629890442, (TSample)-0.37211230397224426, (TSample)-0.06571801006793976, (TSample)0.08387158811092377, (TSample)0.30412110686302185, (TSample)-0.03259441256523132},
-    {(TSample)-0.544828474521637, (TSample)0.8772177696228027, (TSample)-1.4485148191452026, (TSample)-0.37606924772262573, (TSample)-0.056201495230197906, (TSample)0.05879686772823334, (TSample)0.26816701889038086, (TSample)-0.031807154417037964},
-    {(TSample)-0.4867449998855591, (TSample)0.8892163038253784, (TSample)-1.4763598442077637, (TSample)-0.37755268812179565, (TSample)-0.045526809990406036, (TSample)0.0009668858256191015, (TSample)0.17697079479694366, (TSample)-0.03171144798398018},
-    {(TSample)-0.4612632691860199, (TSample)0.8897409439086914, (TSample)-1.497183084487915, (TSample)-0.3797198534011841, (TSample)-0.023344483226537704, (TSample)-0.026648184284567833, (TSample)0.1372605264186859, (TSample)-0.0337691456079483},
-    {(TSample)-0.4396291971206665, (TSample)0.8860441446304321, (TSample)-1.5031489133834839, (TSample)-0.36859583854675293, (TSample)-0.028047626838088036, (TSample)-0.03870612755417824, (TSample)0.11033478379249573, (TSample)-0.02962796948850155},
-    {(TSample)-0.4280265271663666, (TSample)0.8795345425605774, (TSample)-1.5138537883758545, (TSample)-0.36579546332359314, (TSample)-0.021573957055807114, (TSample)-0.05994277447462082, (TSample)0.07924839109182358, (TSample)-0.03694678097963333},
-    {(TSample)-0.4088708460330963, (TSample)0.8779052495956421, (TSample)-1.5146713256835938, (TSample)-0.3682839274406433, (TSample)-0.017878849059343338, (TSample)-0.07227092981338501, (TSample)0.05080850422382355, (TSample)-0.037289850413799286},
-    {(TSample)-0.39304104447364807, (TSample)0.8688115477561951, (TSample)-1.5186986923217773, (TSample)-0.3705058991909027, (TSample)-0.015099750831723213, (TSample)-0.08833176642656326, (TSample)0.026306767016649246, (TSample)-0.043685462325811386},
-    {(TSample)-0.3743433952331543, (TSample)0.8660032749176025, (TSample)-1.5221978425979614, (TSample)-0.36859819293022156, (TSample)-0.01737982966005802, (TSample)-0.10232853144407272, (TSample)-0.0015884794993326068, (TSample)-0.03935941308736801},
-    {(TSample)-0.3501710295677185, (TSample)0.8614689111709595, (TSample)-1.529524564743042, (TSample)-0.37715157866477966, (TSample)-0.015533172525465488, (TSample)-0.129430890083313, (TSample)-0.032428521662950516, (TSample)-0.04593343660235405},
-    {(TSample)-0.33289769291877747, (TSample)0.858235239982605, (TSample)-1.5296709537506104, (TSample)-0.3772496283054352, (TSample)-0.021833086386322975, (TSample)-0.14256809651851654, (TSample)-0.06107185781002045, (TSample)-0.047092504799366},
-    {(TSample)-0.32342612743377686, (TSample)0.8529979586601257, (TSample)-1.5341005325317383, (TSample)-0.38033393025398254, (TSample)-0.022939074784517288, (TSample)-0.15887326002120972, (TSample)-0.08748657256364822, (TSample)-0.05300796031951904},
-    {(TSample)-0.30712419748306274, (TSample)0.8399912714958191, (TSample)-1.5329290628433228, (TSample)-0.37846899032592773, (TSample)-0.03474288806319237, (TSample)-0.1700277030467987, (TSample)-0.11857559531927109, (TSample)-0.052597884088754654},
-    {(TSample)-0.29459643363952637, (TSample)0.8321632146835327, (TSample)-1.5326236486434937, (TSample)-0.38204389810562134, (TSample)-0.04176977276802063, (TSample)-0.17344027757644653, (TSample)-0.14833982288837433, (TSample)-0.056883253157138824},
-    {(TSample)-0.28185805678367615, (TSample)0.8244718909263611, (TSample)-1.5285001993179321, (TSample)-0.3818710744380951, (TSample)-0.0499354787170887, (TSample)-0.18154309689998627, (TSample)-0.1779477298259735, (TSample)-0.06108536571264267},
-    {(TSample)-0.2721133530139923, (TSample)0.8138874173164368, (TSample)-1.524221658706665, (TSample)-0.38933125138282776, (TSample)-0.052161525934934616, (TSample)-0.1929135024547577, (TSample)-0.20738589763641357, (TSample)-0.06664213538169861},
-    {(TSample)-0.2581935524940491, (TSample)0.8035352826118469, (TSample)-1.5170881748199463, (TSample)-0.38660046458244324, (TSample)-0.06785892695188522, (TSample)-0.19926179945468903, (TSample)-0.22946859896183014, (TSample)-0.06453189253807068},
-    {(TSample)-0.251267671585083, (TSample)0.793985903263092, (TSample)-1.5101697444915771, (TSample)-0.3913072943687439, (TSample)-0.06230473890900612, (TSample)-0.217937171459198, (TSample)-0.26744869351387024, (TSample)-0.06531413644552231},
-    {(TSample)-0.24176211655139923, (TSample)0.7813085317611694, (TSample)-1.5044174194335938, (TSample)-0.3870070278644562, (TSample)-0.07286205887794495, (TSample)-0.22977976500988007, (TSample)-0.29545125365257263, (TSample)-0.06719071418046951},
-    {(TSample)-0.2296186089515686, (TSample)0.7644115686416626, (TSample)-1.5061973333358765, (TSample)-0.3875875771045685, (TSample)-0.07703595608472824, (TSample)-0.23698396980762482, (TSample)-0.32474657893180847, (TSample)-0.07790541648864746},
-    {(TSample)-0.20610015094280243, (TSample)0.7567868232727051, (TSample)-1.5006625652313232, (TSample)-0.38765907287597656, (TSample)-0.07728616148233414, (TSample)-0.25880882143974304, (TSample)-0.3552563786506653, (TSample)-0.07819284498691559},
-    {(TSample)-0.18998241424560547, (TSample)0.7358056902885437, (TSample)-1.495422601699829, (TSample)-0.3978525996208191, (TSample)-0.08109468966722488, (TSample)-0.27684441208839417, (TSample)-0.39192622900009155, (TSample)-0.0826895609498024},
-    {(TSample)-0.16948984563350677, (TSample)0.7145149111747742, (TSample)-1.4880529642105103, (TSample)-0.4008964002132416, (TSample)-0.08909068256616592, (TSample)-0.30215343832969666, (TSample)-0.42523762583732605, (TSample)-0.08693012595176697},
-    {(TSample)-0.15611405670642853, (TSample)0.696911096572876, (TSample)-1.4886596202850342, (TSample)-0.4002878963947296, (TSample)-0.09525278955698013, (TSample)-0.31114462018013, (TSample)-0.449566125869751, (TSample)-0.09447141736745834},
-    {(TSample)-0.1440349668264389, (TSample)0.6823813915252686, (TSample)-1.4782440662384033, (TSample)-0.3993932902812958, (TSample)-0.10745903104543686, (TSample)-0.32079190015792847, (TSample)-0.47127866744995117, (TSample)-0.10375987738370895},
-    {(TSample)-0.13762101531028748, (TSample)0.656275749206543, (TSample)-1.4724010229110718, (TSample)-0.40875938534736633, (TSample)-0.12011881172657013, (TSample)-0.3284130096435547, (TSample)-0.5020576119422913, (TSample)-0.11272647976875305},
-    {(TSample)-0.11928561329841614, (TSample)0.6304938197135925, (TSample)-1.458254337310791, (TSample)-0.40349483489990234, (TSample)-0.14816679060459137, (TSample)-0.3355288803577423, (TSample)-0.5359315276145935, (TSample)-0.10884594917297363},
-    {(TSample)-0.12076351046562195, (TSample)0.6069595813751221, (TSample)-1.4450138807296753, (TSample)-0.4022257924079895, (TSample)-0.1594463735818863, (TSample)-0.3524596095085144, (TSample)-0.5688859820365906, (TSample)-0.11961732059717178},
-    {(TSample)-0.11923839896917343, (TSample)0.5732847452163696, (TSample)-1.4360095262527466, (TSample)-0.4064415395259857, (TSample)-0.16963256895542145, (TSample)-0.378076434135437, (TSample)-0.5994014739990234, (TSample)-0.14716248214244843},
-    {(TSample)-0.11126910895109177, (TSample)0.554054856300354, (TSample)-1.423869252204895, (TSample)-0.41353878378868103, (TSample)-0.1869380921125412, (TSample)-0.3889522850513458, (TSample)-0.629112184047699, (TSample)-0.16537339985370636},
-    {(TSample)-0.09944973140954971, (TSample)0.5382864475250244, (TSample)-1.411216139793396, (TSample)-0.4099332094192505, (TSample)-0.20432442426681519, (TSample)-0.4006675183773041, (TSample)-0.6502147316932678, (TSample)-0.1714082807302475},
-    {(TSample)-0.09344650059938431, (TSample)0.5220898985862732, (TSample)-1.404129981994629, (TSample)-0.40784600377082825, (TSample)-0.21406331658363342, (TSample)-0.4078458249568939, (TSample)-0.6724077463150024, (TSample)-0.17963339388370514},
-    {(TSample)-0.08340861648321152, (TSample)0.5088905096054077, (TSample)-1.3874415159225464, (TSample)-0.4042387902736664, (TSample)-0.22955858707427979, (TSample)-0.4170910120010376, (TSample)-0.6954156756401062, (TSample)-0.18340946733951569},
-    {(TSample)-0.08427213877439499, (TSample)0.4925520122051239, (TSample)-1.3780146837234497, (TSample)-0.4092544615268707, (TSample)-0.23495501279830933, (TSample)-0.42027318477630615, (TSample)-0.7188441753387451, (TSample)-0.1929158717393875},
-    {(TSample)-0.07945407927036285, (TSample)0.47323372960090637, (TSample)-1.359142541885376, (TSample)-0.41026756167411804, (TSample)-0.2505912184715271, (TSample)-0.4289443790912628, (TSample)-0.741513729095459, (TSample)-0.1957433968782425},
-    {(TSample)-0.06857424229383469, (TSample)0.46216368675231934, (TSample)-1.3500564098358154, (TSample)-0.41606125235557556, (TSample)-0.26798737049102783, (TSample)-0.4234573245048523, (TSample)-0.764385998249054, (TSample)-0.18900960683822632},
-    {(TSample)-0.0586799681186676, (TSample)0.4453248679637909, (TSample)-1.3369981050491333, (TSample)-0.4158233404159546, (TSample)-0.28575509786605835, (TSample)-0.4308736324310303, (TSample)-0.7868795394897461, (TSample)-0.1927381306886673},
-    {(TSample)-0.057403381913900375, (TSample)0.4227440655231476, (TSample)-1.3290449380874634, (TSample)-0.422651469707489, (TSample)-0.2955218553543091, (TSample)-0.4363759160041809, (TSample)-0.8111776113510132, (TSample)-0.20455394685268402},
-    {(TSample)-0.0550067238509655, (TSample)0.4000428020954132, (TSample)-1.308741569519043, (TSample)-0.42669177055358887, (TSample)-0.311387300491333, (TSample)-0.4420304596424103, (TSample)-0.8351722955703735, (TSample)-0.21038366854190826},
-    {(TSample)-0.05789797380566597, (TSample)0.3821428716182709, (TSample)-1.2921968698501587, (TSample)-0.4299619495868683, (TSample)-0.31839290261268616, (TSample)-0.4339148700237274, (TSample)-0.8728106021881104, (TSample)-0.21574755012989044},
-    {(TSample)-0.051339663565158844, (TSample)0.3678677976131439, (TSample)-1.2748152017593384, (TSample)-0.43128326535224915, (TSample)-0.32936224341392517, (TSample)-0.43890008330345154, (TSample)-0.8923842310905457, (TSample)-0.22301387786865234},
-    {(TSample)-0.05980174243450165, (TSample)0.34416526556015015, (TSample)-1.2613675594329834, (TSample)-0.4385989010334015, (TSample)-0.33174559473991394, (TSample)-0.4424101710319519, (TSample)-0.9135324954986572, (TSample)-0.24022270739078522},
-    {(TSample)-0.06323986500501633, (TSample)0.33379170298576355, (TSample)-1.243965744972229, (TSample)-0.44029712677001953, (TSample)-0.3382071554660797, (TSample)-0.4409715235233307, (TSample)-0.9314894676208496, (TSample)-0.25445714592933655},
-    {(TSample)-0.06565830111503601, (TSample)0.31273290514945984, (TSample)-1.2351715564727783, (TSample)-0.4429764151573181, (TSample)-0.3501431345939636, (TSample)-0.4362063407897949, (TSample)-0.9518994092941284, (TSample)-0.2677592933177948},
-    {(TSample)-0.060453690588474274, (TSample)0.28362393379211426, (TSample)-1.2204854488372803, (TSample)-0.44894906878471375, (TSample)-0.3651389181613922, (TSample)-0.451199471950531, (TSample)-0.9806361794471741, (TSample)-0.2869327962398529},
-    {(TSample)-0.058093391358852386, (TSample)0.262908399105072, (TSample)-1.1964471340179443, (TSample)-0.4549253582954407, (TSample)-0.39008650183677673, (TSample)-0.45456793904304504, (TSample)-1.0091373920440674, (TSample)-0.2896054983139038},
-    {(TSample)-0.05322130396962166, (TSample)0.2469651997089386, (TSample)-1.1762027740478516, (TSample)-0.4595472514629364, (TSample)-0.4073285758495331, (TSample)-0.4576609134674072, (TSample)-1.0325038433074951, (TSample)-0.29581302404403687},
-    {(TSample)-0.05482823774218559, (TSample)0.22348652780056, (TSample)-1.1658419370651245, (TSample)-0.4718974530696869, (TSample)-0.42333081364631653, (TSample)-0.46026939153671265, (TSample)-1.0614930391311646, (TSample)-0.3068380653858185},
-    {(TSample)-0.05907805636525154, (TSample)0.20578067004680634, (TSample)-1.1440088748931885, (TSample)-0.4771571457386017, (TSample)-0.4493931829929352, (TSample)-0.46066978573799133, (TSample)-1.0841987133026123, (TSample)-0.31366270780563354},
-    {(TSample)-0.0692702978849411, (TSample)0.1718859225511551, (TSample)-1.1249322891235352, (TSample)-0.48681744933128357, (TSample)-0.4659661054611206, (TSample)-0.4686853587627411, (TSample)-1.1134958267211914, (TSample)-0.334915429353714},
-    {(TSample)-0.07105427980422974, (TSample)0.15268228948116302, (TSample)-1.1053680181503296, (TSample)-0.48343366384506226, (TSample)-0.48319777846336365, (TSample)-0.46953755617141724, (TSample)-1.1290242671966553, (TSample)-0.34395989775657654},
-    {(TSample)-0.07876714318990707, (TSample)0.13413958251476288, (TSample)-1.092598795890808, (TSample)-0.48661357164382935, (TSample)-0.49346745014190674, (TSample)-0.4633989930152893, (TSample)-1.1507307291030884, (TSample)-0.35870811343193054},
-    {(TSample)-0.08295052498579025, (TSample)0.11982540041208267, (TSample)-1.0696847438812256, (TSample)-0.48860839009284973, (TSample)-0.5064811706542969, (TSample)-0.4549049139022827, (TSample)-1.1709741353988647, (TSample)-0.374801367521286},
-    {(TSample)-0.09252768754959106, (TSample)0.09924879670143127, (TSample)-1.05479896068573, (TSample)-0.49715542793273926, (TSample)-0.5145636200904846, (TSample)-0.4520185589790344, (TSample)-1.1860980987548828, (TSample)-0.39606279134750366},
-    {(TSample)-0.1026894822716713, (TSample)0.07676862180233002, (TSample)-1.0263254642486572, (TSample)-0.49648383259773254, (TSample)-0.5324512720108032, (TSample)-0.45816105604171753, (TSample)-1.2064814567565918, (TSample)-0.4152738153934479},
-    {(TSample)-0.10345915704965591, (TSample)0.04927875101566315, (TSample)-1.004879355430603, (TSample)-0.5021334290504456, (TSample)-0.553217887878418, (TSample)-0.4622242748737335, (TSample)-1.2254416942596436, (TSample)-0.43023672699928284},
-    {(TSample)-0.10689050704240799, (TSample)0.039855800569057465, (TSample)-0.9804550409317017, (TSample)-0.4996125400066376, (TSample)-0.5672340989112854, (TSample)-0.45953255891799927, (TSample)-1.2376607656478882, (TSample)-0.43767955899238586},
-    {(TSample)-0.11162928491830826, (TSample)0.01734377257525921, (TSample)-0.9595845341682434, (TSample)-0.5019515156745911, (TSample)-0.5853681564331055, (TSample)-0.45568397641181946, (TSample)-1.255637764930725, (TSample)-0.45396628975868225},
-    {(TSample)-0.12530168890953064, (TSample)-0.0024380667600780725, (TSample)-0.9323602914810181, (TSample)-0.5021039843559265, (TSample)-0.5955336093902588, (TSample)-0.45157337188720703, (TSample)-1.2662206888198853, (TSample)-0.47160768508911133},
-    {(TSample)-0.1380903422832489, (TSample)-0.020039027556777, (TSample)-0.904148280620575, (TSample)-0.49599432945251465, (TSample)-0.6036425828933716, (TSample)-0.43956613540649414, (TSample)-1.2846328020095825, (TSample)-0.4788322150707245},
-    {(TSample)-0.14123255014419556, (TSample)-0.03155761957168579, (TSample)-0.8682658076286316, (TSample)-0.4916479289531708, (TSample)-0.6169910430908203, (TSample)-0.43406742811203003, (TSample)-1.3010057210922241, (TSample)-0.4851362109184265},
-    {(TSample)-0.1534499078989029, (TSample)-0.04410696402192116, (TSample)-0.8558865785598755, (TSample)-0.49290356040000916, (TSample)-0.6196786761283875, (TSample)-0.4246607720851898, (TSample)-1.3093805313110352, (TSample)-0.5011104345321655},
-    {(TSample)-0.16157424449920654, (TSample)-0.04989110305905342, (TSample)-0.8318910598754883, (TSample)-0.48745906352996826, (TSample)-0.627837598323822, (TSample)-0.4173661768436432, (TSample)-1.3170417547225952, (TSample)-0.5090957880020142},
-    {(TSample)-0.1726813167333603, (TSample)-0.06336318701505661, (TSample)-0.8152874112129211, (TSample)-0.4871473014354706, (TSample)-0.6353191137313843, (TSample)-0.41012173891067505, (TSample)-1.3260105848312378, (TSample)-0.5226148366928101},
-    {(TSample)-0.1840272694826126, (TSample)-0.07382646203041077, (TSample)-0.7886335253715515, (TSample)-0.4773319363594055, (TSample)-0.6460228562355042, (TSample)-0.4066731333732605, (TSample)-1.3307430744171143, (TSample)-0.5291009545326233},
-    {(TSample)-0.1985275000333786, (TSample)-0.08987759053707123, (TSample)-0.7705191969871521, (TSample)-0.47819361090660095, (TSample)-0.6488856077194214, (TSample)-0.40179377794265747, (TSample)-1.3419253826141357, (TSample)-0.5476193428039551},
-    {(TSample)-0.20714612305164337, (TSample)-0.09738742560148239, (TSample)-0.7471879124641418, (TSample)-0.46912655234336853, (TSample)-0.6591484546661377, (TSample)-0.39875736832618713, (TSample)-1.349908709526062, (TSample)-0.5590838193893433},
-    {(TSample)-0.22127901017665863, (TSample)-0.10636147856712341, (TSample)-0.7243164777755737, (TSample)-0.4649021327495575, (TSample)-0.6661971807479858, (TSample)-0.3868466019630432, (TSample)-1.3548364639282227, (TSample)-0.5730950832366943},
-    {(TSample)-0.23791596293449402, (TSample)-0.11297916620969772, (TSample)-0.7017259001731873, (TSample)-0.4546574056148529, (TSample)-0.6718251705169678, (TSample)-0.37507757544517517, (TSample)-1.361282229423523, (TSample)-0.5824500918388367},
-    {(TSample)-0.2517009377479553, (TSample)-0.12806306779384613, (TSample)-0.6842226386070251, (TSample)-0.44583627581596375, (TSample)-0.6807886362075806, (TSample)-0.3603445589542389, (TSample)-1.3649406433105469, (TSample)-0.5913149118423462},
-    {(TSample)-0.26518920063972473, (TSample)-0.13054415583610535, (TSample)-0.6597643494606018, (TSample)-0.441723495721817, (TSample)-0.6852826476097107, (TSample)-0.3447590470314026, (TSample)-1.3651096820831299, (TSample)-0.5998303294181824},
-    {(TSample)-0.28683680295944214, (TSample)-0.1394246518611908, (TSample)-0.6361165642738342, (TSample)-0.4412583112716675, (TSample)-0.6855151653289795, (TSample)-0.32966548204421997, (TSample)-1.3696268796920776, (TSample)-0.6088979840278625},
-    {(TSample)-0.30050021409988403, (TSample)-0.14226588606834412, (TSample)-0.6103248000144958, (TSample)-0.4312785565853119, (TSample)-0.6895566582679749, (TSample)-0.31925076246261597, (TSample)-1.3710070848464966, (TSample)-0.6160376667976379},
-    {(TSample)-0.31928613781929016, (TSample)-0.1502646654844284, (TSample)-0.582880437374115, (TSample)-0.42681851983070374, (TSample)-0.6988216042518616, (TSample)-0.3026443123817444, (TSample)-1.3820104598999023, (TSample)-0.6190407872200012},
-    {(TSample)-0.34289729595184326, (TSample)-0.15438205003738403, (TSample)-0.5517135262489319, (TSample)-0.41474390029907227, (TSample)-0.7003946304321289, (TSample)-0.2882643938064575, (TSample)-1.3836857080459595, (TSample)-0.6274291276931763},
-    {(TSample)-0.3673221468925476, (TSample)-0.16193856298923492, (TSample)-0.5306168794631958, (TSample)-0.4097042977809906, (TSample)-0.6998358964920044, (TSample)-0.2808266580104828, (TSample)-1.3908179998397827, (TSample)-0.6310250759124756},
-    {(TSample)-0.388079434633255, (TSample)-0.16400016844272614, (TSample)-0.49636977910995483, (TSample)-0.3993511199951172, (TSample)-0.7022842168807983, (TSample)-0.2701174020767212, (TSample)-1.3958128690719604, (TSample)-0.6359946131706238},
-    {(TSample)-0.4086408317089081, (TSample)-0.17294207215309143, (TSample)-0.4722760021686554, (TSample)-0.3953358829021454, (TSample)-0.6967018246650696, (TSample)-0.25361868739128113, (TSample)-1.4045865535736084, (TSample)-0.6473443508148193},
-    {(TSample)-0.42632824182510376, (TSample)-0.17326682806015015, (TSample)-0.44962024688720703, (TSample)-0.38447868824005127, (TSample)-0.6882269978523254, (TSample)-0.24391914904117584, (TSample)-1.4057344198226929, (TSample)-0.6572747826576233},
-    {(TSample)-0.4470290243625641, (TSample)-0.1783583164215088, (TSample)-0.4316478371620178, (TSample)-0.3794557452201843, (TSample)-0.6856275796890259, (TSample)-0.22873133420944214, (TSample)-1.4054135084152222, (TSample)-0.6683518290519714},
-    {(TSample)-0.4593093693256378, (TSample)-0.18169818818569183, (TSample)-0.40798312425613403, (TSample)-0.37006235122680664, (TSample)-0.6935003399848938, (TSample)-0.21813207864761353, (TSample)-1.3988515138626099, (TSample)-0.6717175245285034},
-    {(TSample)-0.47953662276268005, (TSample)-0.1851085126399994, (TSample)-0.3896728754043579, (TSample)-0.36292174458503723, (TSample)-0.6930606365203857, (TSample)-0.1989475041627884, (TSample)-1.3954048156738281, (TSample)-0.6794785857200623},
-    {(TSample)-0.5023229122161865, (TSample)-0.1834479123353958, (TSample)-0.36038070917129517, (TSample)-0.35171574354171753, (TSample)-0.6933242678642273, (TSample)-0.17893333733081818, (TSample)-1.3887255191802979, (TSample)-0.6764735579490662},
-    {(TSample)-0.5228654146194458, (TSample)-0.1902942657470703, (TSample)-0.34241801500320435, (TSample)-0.34411072731018066, (TSample)-0.689352810382843, (TSample)-0.16348429024219513, (TSample)-1.3877723217010498, (TSample)-0.6854600310325623},
-    {(TSample)-0.5466770529747009, (TSample)-0.18227672576904297, (TSample)-0.31354156136512756, (TSample)-0.3390905559062958, (TSample)-0.6810490489006042, (TSample)-0.13607986271381378, (TSample)-1.379765272140503, (TSample)-0.689866840839386},
-    {(TSample)-0.5740824341773987, (TSample)-0.18547113239765167, (TSample)-0.2942630648612976, (TSample)-0.3309137225151062, (TSample)-0.6765332818031311, (TSample)-0.1144699975848198, (TSample)-1.3788886070251465, (TSample)-0.7096876502037048},
-    {(TSample)-0.5948939323425293, (TSample)-0.17974558472633362, (TSample)-0.2679343521595001, (TSample)-0.3227798640727997, (TSample)-0.6759464144706726, (TSample)-0.10568385571241379, (TSample)-1.3708423376083374, (TSample)-0.7165645956993103},
-    {(TSample)-0.6211302876472473, (TSample)-0.18331214785575867, (TSample)-0.2488657683134079, (TSample)-0.3158622682094574, (TSample)-0.6707168221473694, (TSample)-0.0856141597032547, (TSample)-1.3662477731704712, (TSample)-0.7219098806381226},
-    {(TSample)-0.6421663165092468, (TSample)-0.17976517975330353, (TSample)-0.22930575907230377, (TSample)-0.29337260127067566, (TSample)-0.6662009954452515, (TSample)-0.0603976771235466, (TSample)-1.3616198301315308, (TSample)-0.7289315462112427},
-    {(TSample)-0.6628856658935547, (TSample)-0.18034493923187256, (TSample)-0.2143191397190094, (TSample)-0.2890143394470215, (TSample)-0.6613995432853699, (TSample)-0.0423903726041317, (TSample)-1.3559346199035645, (TSample)-0.7335928082466125},
-    {(TSample)-0.6800454258918762, (TSample)-0.1718631535768509, (TSample)-0.1900206208229065, (TSample)-0.27789923548698425, (TSample)-0.653401255607605, (TSample)-0.025522859767079353, (TSample)-1.3473559617996216, (TSample)-0.7346412539482117},
-    {(TSample)-0.7001122236251831, (TSample)-0.1627485603094101, (TSample)-0.1740695983171463, (TSample)-0.2699699103832245, (TSample)-0.635779857635498, (TSample)-0.005033668130636215, (TSample)-1.339754581451416, (TSample)-0.7379024624824524},
-    {(TSample)-0.7214804291725159, (TSample)-0.15735328197479248, (TSample)-0.15486378967761993, (TSample)-0.2590418756008148, (TSample)-0.6260807514190674, (TSample)0.009609282948076725, (TSample)-1.3311197757720947, (TSample)-0.746224045753479},
-    {(TSample)-0.7411704659461975, (TSample)-0.15918950736522675, (TSample)-0.12591266632080078, (TSample)-0.2405119687318802, (TSample)-0.6267355680465698, (TSample)0.040005940943956375, (TSample)-1.3135391473770142, (TSample)-0.7688944935798645},
-    {(TSample)-0.7636265754699707, (TSample)-0.1472148299217224, (TSample)-0.09735932946205139, (TSample)-0.227006196975708, (TSample)-0.6206703782081604, (TSample)0.057628028094768524, (TSample)-1.301182746887207, (TSample)-0.7670865654945374},
-    {(TSample)-0.784299910068512, (TSample)-0.13789412379264832, (TSample)-0.07400726526975632, (TSample)-0.22165827453136444, (TSample)-0.6125327944755554, (TSample)0.07891213893890381, (TSample)-1.290684700012207, (TSample)-0.769648015499115},
-    {(TSample)-0.7998216152191162, (TSample)-0.11992472410202026, (TSample)-0.048663824796676636, (TSample)-0.21109981834888458, (TSample)-0.5958113670349121, (TSample)0.0994710922241211, (TSample)-1.2788487672805786, (TSample)-0.7695429921150208},
-    {(TSample)-0.8300006985664368, (TSample)-0.11236734688282013, (TSample)-0.024012409150600433, (TSample)-0.2017892599105835, (TSample)-0.577147364616394, (TSample)0.1194077730178833, (TSample)-1.276599645614624, (TSample)-0.773827314376831},
-    {(TSample)-0.8539229035377502, (TSample)-0.10099692642688751, (TSample)-0.0015399932162836194, (TSample)-0.19187265634536743, (TSample)-0.5592442154884338, (TSample)0.13584886491298676, (TSample)-1.2697426080703735, (TSample)-0.7806219458580017},
-    {(TSample)-0.881492018699646, (TSample)-0.09992941468954086, (TSample)0.014131174422800541, (TSample)-0.18861298263072968, (TSample)-0.5409069061279297, (TSample)0.14729362726211548, (TSample)-1.2604174613952637, (TSample)-0.7944480776786804},
-    {(TSample)-0.9009021520614624, (TSample)-0.08702744543552399, (TSample)0.040668752044439316, (TSample)-0.17345012724399567, (TSample)-0.53190678358078, (TSample)0.157004714012146, (TSample)-1.2477444410324097, (TSample)-0.7931485176086426},
-    {(TSample)-0.9182018637657166, (TSample)-0.07610061019659042, (TSample)0.05477539822459221, (TSample)-0.16675883531570435, (TSample)-0.5163500308990479, (TSample)0.17345678806304932, (TSample)-1.2404561042785645, (TSample)-0.7946479320526123},
-    {(TSample)-0.9356883764266968, (TSample)-0.0639343112707138, (TSample)0.07846525311470032, (TSample)-0.15485908091068268, (TSample)-0.5061482787132263, (TSample)0.18891127407550812, (TSample)-1.2276381254196167, (TSample)-0.7929695248603821},
-    {(TSample)-0.9566844701766968, (TSample)-0.047845322638750076, (TSample)0.10133577883243561, (TSample)-0.15040834248065948, (TSample)-0.4839390516281128, (TSample)0.19230911135673523, (TSample)-1.2264575958251953, (TSample)-0.7913374304771423},
-    {(TSample)-0.978143572807312, (TSample)-0.024961983785033226, (TSample)0.12785644829273224, (TSample)-0.14110656082630157, (TSample)-0.47282832860946655, (TSample)0.20791661739349365, (TSample)-1.2093570232391357, (TSample)-0.7922471761703491},
-    {(TSample)-0.9937758445739746, (TSample)-0.012853213585913181, (TSample)0.14262989163398743, (TSample)-0.1331050544977188, (TSample)-0.46196889877319336, (TSample)0.224595308303833, (TSample)-1.1918479204177856, (TSample)-0.7933669090270996},
-    {(TSample)-1.019405722618103, (TSample)0.020045345649123192, (TSample)0.15880300104618073, (TSample)-0.12473266571760178, (TSample)-0.42322003841400146, (TSample)0.2404565066099167, (TSample)-1.1689409017562866, (TSample)-0.7897149920463562},
-    {(TSample)-1.0378168821334839, (TSample)0.03462732210755348, (TSample)0.17236360907554626, (TSample)-0.11841293424367905, (TSample)-0.4030137062072754, (TSample)0.2526737153530121, (TSample)-1.1506071090698242, (TSample)-0.7973372340202332},
-    {(TSample)-1.0615051984786987, (TSample)0.046180542558431625, (TSample)0.18928781151771545, (TSample)-0.10539243370294571, (TSample)-0.38785290718078613, (TSample)0.2718694806098938, (TSample)-1.1324387788772583, (TSample)-0.8004966974258423},
-    {(TSample)-1.0857781171798706, (TSample)0.0682842880487442, (TSample)0.21713627874851227, (TSample)-0.08119899034500122, (TSample)-0.3741553723812103, (TSample)0.29594993591308594, (TSample)-1.1139236688613892, (TSample)-0.8071515560150146},
-    {(TSample)-1.0979371070861816, (TSample)0.08493609726428986, (TSample)0.23597030341625214, (TSample)-0.06971994042396545, (TSample)-0.3641224205493927, (TSample)0.3142513930797577, (TSample)-1.1015740633010864, (TSample)-0.7988713979721069},
-    {(TSample)-1.1196552515029907, (TSample)0.10098287463188171, (TSample)0.2539895474910736, (TSample)-0.057893332093954086, (TSample)-0.3428509831428528, (TSample)0.3331548571586609, (TSample)-1.0848839282989502, (TSample)-0.8043994307518005},
-    {(TSample)-1.1305290460586548, (TSample)0.11815936863422394, (TSample)0.2650376260280609, (TSample)-0.047249481081962585, (TSample)-0.32929253578186035, (TSample)0.3534007668495178, (TSample)-1.0707803964614868, (TSample)-0.7998093366622925},
-    {(TSample)-1.14769446849823, (TSample)0.12989495694637299, (TSample)0.274795264005661, (TSample)-0.03879282996058464, (TSample)-0.3094085156917572, (TSample)0.37009197473526, (TSample)-1.0561637878417969, (TSample)-0.8059799671173096},
-    {(TSample)-1.1646802425384521, (TSample)0.1498684138059616, (TSample)0.2879285216331482, (TSample)-0.027523379772901535, (TSample)-0.2838279604911804, (TSample)0.3949703574180603, (TSample)-1.043257713317871, (TSample)-0.8056455254554749},
-    {(TSample)-1.194128394126892, (TSample)0.17009302973747253, (TSample)0.29382699728012085, (TSample)-0.01810322515666485, (TSample)-0.2458048015832901, (TSample)0.40811872482299805, (TSample)-1.0216968059539795, (TSample)-0.8241885900497437},
-    {(TSample)-1.2187622785568237, (TSample)0.19537031650543213, (TSample)0.30898517370224, (TSample)-0.01404986996203661, (TSample)-0.2132856696844101, (TSample)0.4158593416213989, (TSample)-0.9987205266952515, (TSample)-0.828459620475769},
-    {(TSample)-1.2393913269042969, (TSample)0.2161329686641693, (TSample)0.3222404718399048, (TSample)-0.009284373372793198, (TSample)-0.18523751199245453, (TSample)0.4388461410999298, (TSample)-0.9791806936264038, (TSample)-0.8260785341262817},
-    {(TSample)-1.2571712732315063, (TSample)0.23318366706371307, (TSample)0.3293653428554535, (TSample)-0.0028902923222631216, (TSample)-0.1633560061454773, (TSample)0.45453596115112305, (TSample)-0.9651709198951721, (TSample)-0.8226833939552307},
-    {(TSample)-1.2725262641906738, (TSample)0.24484050273895264, (TSample)0.34105080366134644, (TSample)0.00810543168336153, (TSample)-0.1431475579738617, (TSample)0.46501725912094116, (TSample)-0.9487510323524475, (TSample)-0.8267903327941895},
-    {(TSample)-1.283431887626648, (TSample)0.2645656168460846, (TSample)0.35281890630722046, (TSample)0.014134007506072521, (TSample)-0.12699753046035767, (TSample)0.47385984659194946, (TSample)-0.9333575963973999, (TSample)-0.8170013427734375},
-    {(TSample)-1.2928318977355957, (TSample)0.28327032923698425, (TSample)0.3624774217605591, (TSample)0.024429498240351677, (TSample)-0.10464537143707275, (TSample)0.48255228996276855, (TSample)-0.914718747138977, (TSample)-0.8050439357757568},
-    {(TSample)-1.306615948677063, (TSample)0.29351547360420227, (TSample)0.3720523715019226, (TSample)0.034585174173116684, (TSample)-0.0921291932463646, (TSample)0.49285805225372314, (TSample)-0.899391770362854, (TSample)-0.7995709776878357},
-    {(TSample)-1.3182554244995117, (TSample)0.3011258542537689, (TSample)0.3784323036670685, (TSample)0.044728685170412064, (TSample)-0.0746040791273117, (TSample)0.5009688138961792, (TSample)-0.8819555640220642, (TSample)-0.7960778474807739},
-    {(TSample)-1.3248169422149658, (TSample)0.30906668305397034, (TSample)0.3807036578655243, (TSample)0.053856778889894485, (TSample)-0.05540404096245766, (TSample)0.5090433955192566, (TSample)-0.8683981895446777, (TSample)-0.7877470254898071},
-    {(TSample)-1.3323440551757812, (TSample)0.31587204337120056, (TSample)0.3828780949115753, (TSample)0.06581394374370575, (TSample)-0.03671176731586456, (TSample)0.5137243866920471, (TSample)-0.8540139198303223, (TSample)-0.783608078956604},
-    {(TSample)-1.3409911394119263, (TSample)0.3249596059322357, (TSample)0.39190277457237244, (TSample)0.0735844075679779, (TSample)-0.01878984272480011, (TSample)0.5214584469795227, (TSample)-0.8401733040809631, (TSample)-0.7773905992507935},
-    {(TSample)-1.348060131072998, (TSample)0.3299732208251953, (TSample)0.39291059970855713, (TSample)0.08471477776765823, (TSample)0.0014322970528155565, (TSample)0.5226640701293945, (TSample)-0.8233869075775146, (TSample)-0.7737426161766052},
-    {(TSample)-1.3511719703674316, (TSample)0.34207141399383545, (TSample)0.40384441614151, (TSample)0.0926113948225975, (TSample)0.022688737139105797, (TSample)0.5355185270309448, (TSample)-0.8090621829032898, (TSample)-0.7625581622123718},
-    {(TSample)-1.3586719036102295, (TSample)0.3484385013580322, (TSample)0.4065925180912018, (TSample)0.10127387940883636, (TSample)0.0445975624024868, (TSample)0.5424092411994934, (TSample)-0.7944062352180481, (TSample)-0.7610546350479126},
-    {(TSample)-1.3593648672103882, (TSample)0.35288235545158386, (TSample)0.41086122393608093, (TSample)0.10725372284650803, (TSample)0.06097513809800148, (TSample)0.544265627861023, (TSample)-0.7817230820655823, (TSample)-0.7495309710502625},
-    {(TSample)-1.3614599704742432, (TSample)0.35396328568458557, (TSample)0.41338101029396057, (TSample)0.11250722408294678, (TSample)0.07963306456804276, (TSample)0.5398498177528381, (TSample)-0.7677514553070068, (TSample)-0.7430086135864258},
-    {(TSample)-1.3723934888839722, (TSample)0.373983234167099, (TSample)0.43132850527763367, (TSample)0.11610910296440125, (TSample)0.11270679533481598, (TSample)0.5326752066612244, (TSample)-0.74675452709198, (TSample)-0.7173764705657959},
-    {(TSample)-1.3998613357543945, (TSample)0.3977745771408081, (TSample)0.46396082639694214, (TSample)0.12984301149845123, (TSample)0.16277754306793213, (TSample)0.5118085145950317, (TSample)-0.7134875655174255, (TSample)-0.6797211766242981},
-    {(TSample)-1.4119665622711182, (TSample)0.40650293231010437, (TSample)0.48140373826026917, (TSample)0.1473836600780487, (TSample)0.20572739839553833, (TSample)0.5002527236938477, (TSample)-0.6920607686042786, (TSample)-0.6543360948562622},
-    {(TSample)-1.4136639833450317, (TSample)0.40652191638946533, (TSample)0.47752562165260315, (TSample)0.15615136921405792, (TSample)0.23324382305145264, (TSample)0.4931972324848175, (TSample)-0.6784539222717285, (TSample)-0.6480588316917419},
-    {(TSample)-1.4128985404968262, (TSample)0.41199564933776855, (TSample)0.481342613697052, (TSample)0.15948233008384705, (TSample)0.26101136207580566, (TSample)0.47203463315963745, (TSample)-0.660345733165741, (TSample)-0.6216374039649963},
-    {(TSample)-1.4108712673187256, (TSample)0.4053284525871277, (TSample)0.48061707615852356, (TSample)0.16248798370361328, (TSample)0.28341999650001526, (TSample)0.46213096380233765, (TSample)-0.6450574994087219, (TSample)-0.6067481637001038},
-    {(TSample)-1.4069513082504272, (TSample)0.4004027247428894, (TSample)0.4833635091781616, (TSample)0.1674635410308838, (TSample)0.3075346350669861, (TSample)0.4496154487133026, (TSample)-0.6357213854789734, (TSample)-0.5895959734916687},
-    {(TSample)-1.406070351600647, (TSample)0.3936786651611328, (TSample)0.48298922181129456, (TSample)0.17221559584140778, (TSample)0.33505237102508545, (TSample)0.4379118084907532, (TSample)-0.6232596635818481, (TSample)-0.577330470085144},
-    {(TSample)-1.400783896446228, (TSample)0.3900909125804901, (TSample)0.48589667677879333, (TSample)0.17863675951957703, (TSample)0.35962021350860596, (TSample)0.42576491832733154, (TSample)-0.6133404970169067, (TSample)-0.5558828115463257},
-    {(TSample)-1.3955479860305786, (TSample)0.38051342964172363, (TSample)0.4845035970211029, (TSample)0.17942769825458527, (TSample)0.38909098505973816, (TSample)0.40725934505462646, (TSample)-0.5987151861190796, (TSample)-0.5436192154884338},
-    {(TSample)-1.3874402046203613, (TSample)0.37188589572906494, (TSample)0.48173579573631287, (TSample)0.1786397099494934, (TSample)0.42412951588630676, (TSample)0.3865068554878235, (TSample)-0.5856342911720276, (TSample)-0.5113469362258911},
-    {(TSample)-1.3875657320022583, (TSample)0.35830917954444885, (TSample)0.47750556468963623, (TSample)0.17798559367656708, (TSample)0.4611489176750183, (TSample)0.35885682702064514, (TSample)-0.5731545090675354, (TSample)-0.4945771396160126},
-    {(TSample)-1.3798189163208008, (TSample)0.3457726538181305, (TSample)0.47572505474090576, (TSample)0.17686937749385834, (TSample)0.4880789518356323, (TSample)0.34252095222473145, (TSample)-0.5630565285682678, (TSample)-0.466105192899704},
-    {(TSample)-1.3692103624343872, (TSample)0.3264669179916382, (TSample)0.47131583094596863, (TSample)0.17385557293891907, (TSample)0.5195466876029968, (TSample)0.3112787902355194, (TSample)-0.5481694340705872, (TSample)-0.4485255181789398},
-    {(TSample)-1.3547751903533936, (TSample)0.31134530901908875, (TSample)0.4711286425590515, (TSample)0.17036603391170502, (TSample)0.5446215867996216, (TSample)0.2826140820980072, (TSample)-0.534656822681427, (TSample)-0.41978558897972107},
-    {(TSample)-1.338546633720398, (TSample)0.2903044819831848, (TSample)0.4616295099258423, (TSample)0.1690998524427414, (TSample)0.5796570777893066, (TSample)0.24787579476833344, (TSample)-0.5205453038215637, (TSample)-0.3981609344482422},
-    {(TSample)-1.3177886009216309, (TSample)0.2684396505355835, (TSample)0.45530402660369873, (TSample)0.16129320859909058, (TSample)0.613754391670227, (TSample)0.2122008502483368, (TSample)-0.5112026929855347, (TSample)-0.35639292001724243},
-    {(TSample)-1.2972582578659058, (TSample)0.24107098579406738, (TSample)0.44361385703086853, (TSample)0.1576254665851593, (TSample)0.6462886333465576, (TSample)0.15979692339897156, (TSample)-0.497839093208313, (TSample)-0.33502721786499023},
-    {(TSample)-1.272657871246338, (TSample)0.21643614768981934, (TSample)0.4341278076171875, (TSample)0.1556616872549057, (TSample)0.6766830682754517, (TSample)0.10340344160795212, (TSample)-0.4824681282043457, (TSample)-0.3108791708946228},
-    {(TSample)-1.2298898696899414, (TSample)0.10827557742595673, (TSample)0.39205610752105713, (TSample)0.10614702105522156, (TSample)0.767467200756073, (TSample)-0.07863979041576385, (TSample)-0.41534993052482605, (TSample)-0.27993765473365784},
-    {(TSample)-1.1960408687591553, (TSample)-0.07144135236740112, (TSample)0.3233892321586609, (TSample)0.023746991530060768, (TSample)0.9457306265830994, (TSample)-0.35357630252838135, (TSample)-0.3031213879585266, (TSample)-0.17009226977825165},
-    {(TSample)-1.1878303289413452, (TSample)-0.15555453300476074, (TSample)0.29117825627326965, (TSample)0.029736291617155075, (TSample)1.0159791707992554, (TSample)-0.47279104590415955, (TSample)-0.2595846354961395, (TSample)-0.14086568355560303},
-    {(TSample)-1.1745045185089111, (TSample)-0.1796494871377945, (TSample)0.28642627596855164, (TSample)0.030231323093175888, (TSample)1.0416185855865479, (TSample)-0.5121520757675171, (TSample)-0.25100377202033997, (TSample)-0.12856975197792053},
-    {(TSample)-1.165754795074463, (TSample)-0.2061070203781128, (TSample)0.27628931403160095, (TSample)0.025341475382447243, (TSample)1.0730925798416138, (TSample)-0.5477008819580078, (TSample)-0.2441297322511673, (TSample)-0.11574655026197433},
-    {(TSample)-1.1493486166000366, (TSample)-0.23379841446876526, (TSample)0.2681243419647217, (TSample)0.0251513309776783, (TSample)1.0929824113845825, (TSample)-0.5819739699363708, (TSample)-0.23656776547431946, (TSample)-0.09705637395381927},
-    {(TSample)-1.134466290473938, (TSample)-0.26001036167144775, (TSample)0.2545241713523865, (TSample)0.024992499500513077, (TSample)1.1198707818984985, (TSample)-0.614087700843811, (TSample)-0.22377589344978333, (TSample)-0.08795282989740372},
-    {(TSample)-1.1184253692626953, (TSample)-0.27623850107192993, (TSample)0.2546485364437103, (TSample)0.026654118672013283, (TSample)1.1417759656906128, (TSample)-0.6392651796340942, (TSample)-0.21743638813495636, (TSample)-0.06317383050918579},
-    {(TSample)-1.1018543243408203, (TSample)-0.293124794960022, (TSample)0.24452871084213257, (TSample)0.026564013212919235, (TSample)1.160927414894104, (TSample)-0.6607867479324341, (TSample)-0.2085607349872589, (TSample)-0.052098598331213},
-    {(TSample)-1.0868252515792847, (TSample)-0.30841588973999023, (TSample)0.2378147840499878, (TSample)0.026844151318073273, (TSample)1.1730914115905762, (TSample)-0.6774791479110718, (TSample)-0.20221742987632751, (TSample)-0.0359451025724411},
-    {(TSample)-1.070322871208191, (TSample)-0.3306422531604767, (TSample)0.2264215499162674, (TSample)0.02348584681749344, (TSample)1.19088613986969, (TSample)-0.697745680809021, (TSample)-0.19406510889530182, (TSample)-0.026171818375587463},
-    {(TSample)-1.0423333644866943, (TSample)-0.35069313645362854, (TSample)0.2181536704301834, (TSample)0.02044696919620037, (TSample)1.1979327201843262, (TSample)-0.720642626285553, (TSample)-0.19273321330547333, (TSample)0.0066056028008461},
-    {(TSample)-1.0173146724700928, (TSample)-0.37725862860679626, (TSample)0.20881852507591248, (TSample)0.02376813255250454, (TSample)1.2058162689208984, (TSample)-0.7432448863983154, (TSample)-0.18053603172302246, (TSample)0.024473082274198532},
-    {(TSample)-0.990912914276123, (TSample)-0.39475688338279724, (TSample)0.19936396181583405, (TSample)0.02334376983344555, (TSample)1.210117220878601, (TSample)-0.7610073089599609, (TSample)-0.17540103197097778, (TSample)0.05936981365084648},
-    {(TSample)-0.9538747668266296, (TSample)-0.41877031326293945, (TSample)0.18589992821216583, (TSample)0.021761616691946983, (TSample)1.224524974822998, (TSample)-0.7880861759185791, (TSample)-0.16791898012161255, (TSample)0.07467477768659592},
-    {(TSample)-0.9337450861930847, (TSample)-0.4298725128173828, (TSample)0.17641542851924896, (TSample)0.023100409656763077, (TSample)1.2366082668304443, (TSample)-0.8018790483474731, (TSample)-0.16055957973003387, (TSample)0.0972926989197731},
-    {(TSample)-0.9137125015258789, (TSample)-0.44683048129081726, (TSample)0.16183917224407196, (TSample)0.02625959925353527, (TSample)1.248378872871399, (TSample)-0.8163448572158813, (TSample)-0.15094740688800812, (TSample)0.11160019040107727},
-    {(TSample)-0.8911211490631104, (TSample)-0.4657262861728668, (TSample)0.14783954620361328, (TSample)0.024857407435774803, (TSample)1.253320574760437, (TSample)-0.8361530900001526, (TSample)-0.1432950347661972, (TSample)0.12995578348636627},
-    {(TSample)-0.8643100261688232, (TSample)-0.487772673368454, (TSample)0.13511569797992706, (TSample)0.03504207730293274, (TSample)1.2569540739059448, (TSample)-0.8508943319320679, (TSample)-0.13113240897655487, (TSample)0.14041933417320251},
-    {(TSample)-0.8215925693511963, (TSample)-0.5043143630027771, (TSample)0.12087500095367432, (TSample)0.04571704939007759, (TSample)1.2596526145935059, (TSample)-0.868832528591156, (TSample)-0.11865683645009995, (TSample)0.16577278077602386},
-    {(TSample)-0.7914248704910278, (TSample)-0.5303768515586853, (TSample)0.10004539787769318, (TSample)0.052033644169569016, (TSample)1.2595902681350708, (TSample)-0.8851606249809265, (TSample)-0.10149963945150375, (TSample)0.1828293651342392},
-    {(TSample)-0.7595826983451843, (TSample)-0.545138418674469, (TSample)0.08619335293769836, (TSample)0.05814042314887047, (TSample)1.2567082643508911, (TSample)-0.8926332592964172, (TSample)-0.09072751551866531, (TSample)0.20557644963264465},
-    {(TSample)-0.7379304766654968, (TSample)-0.5649378299713135, (TSample)0.07618865370750427, (TSample)0.0653366670012474, (TSample)1.2565979957580566, (TSample)-0.9047961831092834, (TSample)-0.08032012730836868, (TSample)0.21182195842266083},
-    {(TSample)-0.7138306498527527, (TSample)-0.5788404941558838, (TSample)0.07024352252483368, (TSample)0.07569418102502823, (TSample)1.2499995231628418, (TSample)-0.9097661375999451, (TSample)-0.0712093934416771, (TSample)0.23086652159690857},
-    {(TSample)-0.6907848715782166, (TSample)-0.5994401574134827, (TSample)0.0517464205622673, (TSample)0.08654966950416565, (TSample)1.2500989437103271, (TSample)-0.9138417840003967, (TSample)-0.06761696934700012, (TSample)0.24177207052707672},
-    {(TSample)-0.6568489074707031, (TSample)-0.6169173121452332, (TSample)0.03608401492238045, (TSample)0.09876271337270737, (TSample)1.2394976615905762, (TSample)-0.9179194569587708, (TSample)-0.061145469546318054, (TSample)0.26577314734458923},
-    {(TSample)-0.6402057409286499, (TSample)-0.6306996941566467, (TSample)0.025800010189414024, (TSample)0.10293159633874893, (TSample)1.2406126260757446, (TSample)-0.921759307384491, (TSample)-0.05274061858654022, (TSample)0.27357587218284607},
-    {(TSample)-0.6191622614860535, (TSample)-0.6410800814628601, (TSample)0.019635921344161034, (TSample)0.10915092378854752, (TSample)1.2353997230529785, (TSample)-0.921394407749176, (TSample)-0.04691359028220177, (TSample)0.2873525023460388},
-    {(TSample)-0.5986780524253845, (TSample)-0.6583181619644165, (TSample)0.014648675918579102, (TSample)0.1218251883983612, (TSample)1.2266932725906372, (TSample)-0.925017774105072, (TSample)-0.0370212160050869, (TSample)0.294646292924881},
-    {(TSample)-0.5746456980705261, (TSample)-0.6723225712776184, (TSample)0.009144730865955353, (TSample)0.1349208652973175, (TSample)1.2150938510894775, (TSample)-0.9255023002624512, (TSample)-0.027729958295822144, (TSample)0.3105778992176056},
-    {(TSample)-0.5526899695396423, (TSample)-0.6919902563095093, (TSample)-0.0012354872887954116, (TSample)0.144931361079216, (TSample)1.210569143295288, (TSample)-0.9317236542701721, (TSample)-0.015881944447755814, (TSample)0.312911719083786},
-    {(TSample)-0.5288323163986206, (TSample)-0.7122233510017395, (TSample)-0.012706819921731949, (TSample)0.15693320333957672, (TSample)1.19521164894104, (TSample)-0.9351395964622498, (TSample)0.000830395903903991, (TSample)0.3242850601673126},
-    {(TSample)-0.5112659931182861, (TSample)-0.7293508648872375, (TSample)-0.02265956625342369, (TSample)0.16532501578330994, (TSample)1.1909801959991455, (TSample)-0.9370257258415222, (TSample)0.013384988531470299, (TSample)0.32977789640426636},
-    {(TSample)-0.4925331473350525, (TSample)-0.7434958219528198, (TSample)-0.02783041261136532, (TSample)0.1765119582414627, (TSample)1.1805208921432495, (TSample)-0.9324011206626892, (TSample)0.02284477837383747, (TSample)0.3355370759963989},
-    {(TSample)-0.4642787575721741, (TSample)-0.7693784236907959, (TSample)-0.04294264689087868, (TSample)0.1901160180568695, (TSample)1.161726474761963, (TSample)-0.9352031350135803, (TSample)0.03847615048289299, (TSample)0.3321775197982788},
-    {(TSample)-0.4388774335384369, (TSample)-0.7801255583763123, (TSample)-0.05522261559963226, (TSample)0.20299606025218964, (TSample)1.1529046297073364, (TSample)-0.9371253252029419, (TSample)0.0490383543074131, (TSample)0.33855128288269043},
-    {(TSample)-0.422128826379776, (TSample)-0.7955344915390015, (TSample)-0.06703125685453415, (TSample)0.2124772071838379, (TSample)1.1467907428741455, (TSample)-0.9373267889022827, (TSample)0.056714627891778946, (TSample)0.3372313678264618},
-    {(TSample)-0.3814680278301239, (TSample)-0.8079211711883545, (TSample)-0.06364968419075012, (TSample)0.24080757796764374, (TSample)1.1170599460601807, (TSample)-0.9320525527000427, (TSample)0.07096511125564575, (TSample)0.3725782632827759},
-    {(TSample)-0.35554489493370056, (TSample)-0.8353648781776428, (TSample)-0.08101685345172882, (TSample)0.2472516894340515, (TSample)1.108793020248413, (TSample)-0.9348917007446289, (TSample)0.08544222265481949, (TSample)0.3614145815372467},
-    {(TSample)-0.31599441170692444, (TSample)-0.8606600761413574, (TSample)-0.0856204554438591, (TSample)0.2586958408355713, (TSample)1.0938599109649658, (TSample)-0.9407995939254761, (TSample)0.10416760295629501, (TSample)0.3643423914909363},
-    {(TSample)-0.29673948884010315, (TSample)-0.8787059187889099, (TSample)-0.09435007721185684, (TSample)0.2645524740219116, (TSample)1.083790898323059, (TSample)-0.935359537601471, (TSample)0.11574029177427292, (TSample)0.3641335368156433},
-    {(TSample)-0.278117835521698, (TSample)-0.8959895372390747, (TSample)-0.11121583729982376, (TSample)0.26813191175460815, (TSample)1.074461817741394, (TSample)-0.92685866355896, (TSample)0.12343153357505798, (TSample)0.3611425459384918},
-    {(TSample)-0.25042247772216797, (TSample)-0.9214205145835876, (TSample)-0.12313076108694077, (TSample)0.2872559428215027, (TSample)1.0493508577346802, (TSample)-0.9201252460479736, (TSample)0.12723296880722046, (TSample)0.3654882311820984},
-    {(TSample)-0.2306956648826599, (TSample)-0.9284310340881348, (TSample)-0.12726247310638428, (TSample)0.2977190911769867, (TSample)1.0388953685760498, (TSample)-0.913732647895813, (TSample)0.1333811730146408, (TSample)0.36952874064445496},
-    {(TSample)-0.2060817927122116, (TSample)-0.9316399693489075, (TSample)-0.12769068777561188, (TSample)0.3192460238933563, (TSample)1.028480052947998, (TSample)-0.9048489332199097, (TSample)0.14444699883460999, (TSample)0.3686612844467163},
-    {(TSample)-0.19026023149490356, (TSample)-0.939379870891571, (TSample)-0.13237695395946503, (TSample)0.3329820930957794, (TSample)1.0112838745117188, (TSample)-0.8903726935386658, (TSample)0.15382012724876404, (TSample)0.3627772331237793},
-    {(TSample)-0.17122597992420197, (TSample)-0.95323646068573, (TSample)-0.14889749884605408, (TSample)0.34315216541290283, (TSample)1.0019960403442383, (TSample)-0.8717783093452454, (TSample)0.17285431921482086, (TSample)0.3582480251789093},
-    {(TSample)-0.14895062148571014, (TSample)-0.9660497903823853, (TSample)-0.1489071398973465, (TSample)0.3612649142742157, (TSample)0.9786444902420044, (TSample)-0.8578583598136902, (TSample)0.1883314847946167, (TSample)0.3546704053878784},
-    {(TSample)-0.13995115458965302, (TSample)-0.9801234602928162, (TSample)-0.15296263992786407, (TSample)0.37324947118759155, (TSample)0.9683606028556824, (TSample)-0.8470712900161743, (TSample)0.1978476494550705, (TSample)0.34751278162002563},
-    {(TSample)-0.12860660254955292, (TSample)-0.989167332649231, (TSample)-0.152147576212883, (TSample)0.38474786281585693, (TSample)0.9530829191207886, (TSample)-0.8351850509643555, (TSample)0.20729981362819672, (TSample)0.34523481130599976},
-    {(TSample)-0.11787256598472595, (TSample)-1.0072641372680664, (TSample)-0.16061225533485413, (TSample)0.39287564158439636, (TSample)0.9439406991004944, (TSample)-0.8259058594703674, (TSample)0.21817275881767273, (TSample)0.33976277709007263},
-    {(TSample)-0.10307157784700394, (TSample)-1.0159920454025269, (TSample)-0.15878546237945557, (TSample)0.4075571894645691, (TSample)0.9290686845779419, (TSample)-0.8097007870674133, (TSample)0.2301321029663086, (TSample)0.3307966887950897},
-    {(TSample)-0.09602612257003784, (TSample)-1.0301028490066528, (TSample)-0.1541115939617157, (TSample)0.42224881052970886, (TSample)0.9105339050292969, (TSample)-0.788791835308075, (TSample)0.24553270637989044, (TSample)0.30908098816871643},
-    {(TSample)-0.08161602169275284, (TSample)-1.0400010347366333, (TSample)-0.16043218970298767, (TSample)0.43105459213256836, (TSample)0.8979942202568054, (TSample)-0.7790427207946777, (TSample)0.25606662034988403, (TSample)0.30177322030067444},
-    {(TSample)-0.06434234231710434, (TSample)-1.0509824752807617, (TSample)-0.16811566054821014, (TSample)0.4380042850971222, (TSample)0.882853627204895, (TSample)-0.7611321806907654, (TSample)0.2670719623565674, (TSample)0.2881275713443756},
-    {(TSample)-0.04733927920460701, (TSample)-1.0586836338043213, (TSample)-0.1714639961719513, (TSample)0.44721052050590515, (TSample)0.8667964339256287, (TSample)-0.7438206076622009, (TSample)0.28055426478385925, (TSample)0.284429669380188},
-    {(TSample)-0.030086565762758255, (TSample)-1.0729566812515259, (TSample)-0.1771155446767807, (TSample)0.4536280632019043, (TSample)0.8467599153518677, (TSample)-0.7249332070350647, (TSample)0.29614827036857605, (TSample)0.2771107852458954},
-    {(TSample)-0.00819949246942997, (TSample)-1.0843243598937988, (TSample)-0.18049854040145874, (TSample)0.4601888656616211, (TSample)0.8244494795799255, (TSample)-0.7025876045227051, (TSample)0.31332892179489136, (TSample)0.26965683698654175},
-    {(TSample)0.00784354005008936, (TSample)-1.093868613243103, (TSample)-0.1882593184709549, (TSample)0.469093918800354, (TSample)0.812466025352478, (TSample)-0.6805580854415894, (TSample)0.3284289538860321, (TSample)0.2573758065700531},
-    {(TSample)0.02177795208990574, (TSample)-1.1004313230514526, (TSample)-0.19107089936733246, (TSample)0.4766598045825958, (TSample)0.7976239919662476, (TSample)-0.6630119681358337, (TSample)0.3419451117515564, (TSample)0.2482244223356247},
-    {(TSample)0.028985099866986275, (TSample)-1.112039566040039, (TSample)-0.19997790455818176, (TSample)0.48501056432724, (TSample)0.7848659157752991, (TSample)-0.6489869952201843, (TSample)0.35083892941474915, (TSample)0.2336227148771286},
-    {(TSample)0.03739479184150696, (TSample)-1.1184024810791016, (TSample)-0.20226503908634186, (TSample)0.4934087097644806, (TSample)0.7708989977836609, (TSample)-0.633720874786377, (TSample)0.36247044801712036, (TSample)0.22266970574855804},
-    {(TSample)0.04637372866272926, (TSample)-1.1293597221374512, (TSample)-0.21027570962905884, (TSample)0.5016261339187622, (TSample)0.754331648349762, (TSample)-0.6152007579803467, (TSample)0.3717940151691437, (TSample)0.20780104398727417},
-    {(TSample)0.05266832187771797, (TSample)-1.1326650381088257, (TSample)-0.21250684559345245, (TSample)0.5103182792663574, (TSample)0.7372386455535889, (TSample)-0.5988377332687378, (TSample)0.37803319096565247, (TSample)0.19942612946033478},
-    {(TSample)0.05809197202324867, (TSample)-1.144281268119812, (TSample)-0.22126533091068268, (TSample)0.519538164138794, (TSample)0.7198581099510193, (TSample)-0.5772010087966919, (TSample)0.38478508591651917, (TSample)0.18417024612426758},
-    {(TSample)0.06747502088546753, (TSample)-1.1473259925842285, (TSample)-0.22266188263893127, (TSample)0.5320281386375427, (TSample)0.698166012763977, (TSample)-0.5582283139228821, (TSample)0.3942412734031677, (TSample)0.1756136566400528},
-    {(TSample)0.07659973949193954, (TSample)-1.156312346458435, (TSample)-0.22822056710720062, (TSample)0.5412171483039856, (TSample)0.677252471446991, (TSample)-0.5372006297111511, (TSample)0.4042578339576721, (TSample)0.15873324871063232},
-    {(TSample)0.08724325150251389, (TSample)-1.1599183082580566, (TSample)-0.2314050793647766, (TSample)0.5528672933578491, (TSample)0.6593350172042847, (TSample)-0.518057644367218, (TSample)0.4137466251850128, (TSample)0.14533458650112152},
-    {(TSample)0.08956706523895264, (TSample)-1.1635479927062988, (TSample)-0.2374962568283081, (TSample)0.5613758563995361, (TSample)0.6482686400413513, (TSample)-0.4952232837677002, (TSample)0.4188302159309387, (TSample)0.12665420770645142},
-    {(TSample)0.09390196204185486, (TSample)-1.164029836654663, (TSample)-0.2382115125656128, (TSample)0.5749517679214478, (TSample)0.6301537752151489, (TSample)-0.4733465015888214, (TSample)0.42965424060821533, (TSample)0.1089426726102829},
-    {(TSample)0.09944500774145126, (TSample)-1.1695581674575806, (TSample)-0.24664002656936646, (TSample)0.5842431783676147, (TSample)0.6186519265174866, (TSample)-0.4519844949245453, (TSample)0.436172753572464, (TSample)0.09133142232894897},
-    {(TSample)0.10642353445291519, (TSample)-1.1661690473556519, (TSample)-0.25301501154899597, (TSample)0.5962297320365906, (TSample)0.6031006574630737, (TSample)-0.42442986369132996, (TSample)0.4482634961605072, (TSample)0.07177664339542389},
-    {(TSample)0.11190202832221985, (TSample)-1.173548936843872, (TSample)-0.2625277042388916, (TSample)0.6045696139335632, (TSample)0.5901800394058228, (TSample)-0.40355807542800903, (TSample)0.4569387435913086, (TSample)0.05270160362124443},
-    {(TSample)0.12207478284835815, (TSample)-1.1758407354354858, (TSample)-0.2619813084602356, (TSample)0.619322657585144, (TSample)0.5716887712478638, (TSample)-0.3828886151313782, (TSample)0.46605539321899414, (TSample)0.03954716771841049},
-    {(TSample)0.12429316341876984, (TSample)-1.18171226978302, (TSample)-0.2688938081264496, (TSample)0.6251033544540405, (TSample)0.5609355568885803, (TSample)-0.3654749393463135, (TSample)0.47192806005477905, (TSample)0.022236069664359093},
-    {(TSample)0.1267874538898468, (TSample)-1.1817165613174438, (TSample)-0.26599186658859253, (TSample)0.6382752656936646, (TSample)0.5471545457839966, (TSample)-0.3466782867908478, (TSample)0.4867696166038513, (TSample)0.007080674171447754},
-    {(TSample)0.1385580152273178, (TSample)-1.1923717260360718, (TSample)-0.268970787525177, (TSample)0.6478955149650574, (TSample)0.5362406373023987, (TSample)-0.3255351781845093, (TSample)0.4961612820625305, (TSample)-0.01480370294302702},
-    {(TSample)0.14555002748966217, (TSample)-1.1918134689331055, (TSample)-0.2669573426246643, (TSample)0.6551020741462708, (TSample)0.5258798003196716, (TSample)-0.3079257905483246, (TSample)0.5025250911712646, (TSample)-0.03350500762462616},
-    {(TSample)0.14524997770786285, (TSample)-1.1953890323638916, (TSample)-0.27168014645576477, (TSample)0.660591185092926, (TSample)0.5166443586349487, (TSample)-0.28941574692726135, (TSample)0.5069922208786011, (TSample)-0.05398321896791458},
-    {(TSample)0.14916445314884186, (TSample)-1.1929374933242798, (TSample)-0.270122230052948, (TSample)0.6708278656005859, (TSample)0.503801703453064, (TSample)-0.2707943916320801, (TSample)0.5146908164024353, (TSample)-0.06971554458141327},
-    {(TSample)0.14701122045516968, (TSample)-1.1938905715942383, (TSample)-0.27135393023490906, (TSample)0.6765490770339966, (TSample)0.49657300114631653, (TSample)-0.24443967640399933, (TSample)0.5269182920455933, (TSample)-0.09557943046092987},
-    {(TSample)0.14655570685863495, (TSample)-1.1936906576156616, (TSample)-0.2681022882461548, (TSample)0.6876378655433655, (TSample)0.4812757968902588, (TSample)-0.22101134061813354, (TSample)0.5353917479515076, (TSample)-0.11453966796398163},
-    {(TSample)0.1463046669960022, (TSample)-1.1978468894958496, (TSample)-0.27105483412742615, (TSample)0.6900473237037659, (TSample)0.47285082936286926, (TSample)-0.1987304538488388, (TSample)0.5404934883117676, (TSample)-0.1343582421541214},
-    {(TSample)0.14670495688915253, (TSample)-1.1944653987884521, (TSample)-0.26810190081596375, (TSample)0.6980787515640259, (TSample)0.4623338580131531, (TSample)-0.1798570454120636, (TSample)0.5466891527175903, (TSample)-0.15535923838615417},
-    {(TSample)0.1438814252614975, (TSample)-1.1944141387939453, (TSample)-0.2695249021053314, (TSample)0.6998168230056763, (TSample)0.453092098236084, (TSample)-0.15746426582336426, (TSample)0.5525976419448853, (TSample)-0.177029550075531},
-    {(TSample)0.14002551138401031, (TSample)-1.1836987733840942, (TSample)-0.2621530294418335, (TSample)0.7079490423202515, (TSample)0.4406818151473999, (TSample)-0.1312035620212555, (TSample)0.5606634616851807, (TSample)-0.19907520711421967},
-    {(TSample)0.13851462304592133, (TSample)-1.1808366775512695, (TSample)-0.2628336548805237, (TSample)0.7095407247543335, (TSample)0.43059030175209045, (TSample)-0.10738757252693176, (TSample)0.569208562374115, (TSample)-0.22326183319091797},
-    {(TSample)0.14024445414543152, (TSample)-1.1700612306594849, (TSample)-0.2579936683177948, (TSample)0.7138567566871643, (TSample)0.4188753068447113, (TSample)-0.08378542214632034, (TSample)0.5849936604499817, (TSample)-0.2452537715435028},
-    {(TSample)0.14079807698726654, (TSample)-1.1660854816436768, (TSample)-0.2590726315975189, (TSample)0.7136877775192261, (TSample)0.4128679037094116, (TSample)-0.05594583600759506, (TSample)0.5910254120826721, (TSample)-0.2713471055030823},
-    {(TSample)0.1419435292482376, (TSample)-1.1604424715042114, (TSample)-0.2573198676109314, (TSample)0.7182210087776184, (TSample)0.4063040316104889, (TSample)-0.03446315973997116, (TSample)0.5986002087593079, (TSample)-0.2906053364276886},
-    {(TSample)0.1400480419397354, (TSample)-1.1639231443405151, (TSample)-0.25886642932891846, (TSample)0.7187345623970032, (TSample)0.40292975306510925, (TSample)-0.016738375648856163, (TSample)0.60349041223526, (TSample)-0.30972903966903687},
-    {(TSample)0.13886967301368713, (TSample)-1.1619188785552979, (TSample)-0.25548380613327026, (TSample)0.7228376269340515, (TSample)0.3972720801830292, (TSample)-7.720007852185518e-05, (TSample)0.6095749735832214, (TSample)-0.3274965286254883},
-    {(TSample)0.12915614247322083, (TSample)-1.1564007997512817, (TSample)-0.2546955943107605, (TSample)0.7189083695411682, (TSample)0.4000021517276764, (TSample)0.019692441448569298, (TSample)0.6176577806472778, (TSample)-0.3531847894191742},
-    {(TSample)0.13395297527313232, (TSample)-1.1514651775360107, (TSample)-0.2527386546134949, (TSample)0.7252303957939148, (TSample)0.39054277539253235, (TSample)0.03955284506082535, (TSample)0.6249310970306396, (TSample)-0.37085652351379395},
-    {(TSample)0.13295027613639832, (TSample)-1.1490154266357422, (TSample)-0.2538995146751404, (TSample)0.7231497168540955, (TSample)0.38551342487335205, (TSample)0.0653083473443985, (TSample)0.6365631222724915, (TSample)-0.3973473310470581},
-    {(TSample)0.13573375344276428, (TSample)-1.1379162073135376, (TSample)-0.24594436585903168, (TSample)0.7213712930679321, (TSample)0.38089144229888916, (TSample)0.08710291236639023, (TSample)0.6501246094703674, (TSample)-0.42105716466903687},
-    {(TSample)0.13644835352897644, (TSample)-1.1316150426864624, (TSample)-0.24411655962467194, (TSample)0.7168395519256592, (TSample)0.3757791817188263, (TSample)0.108749158680439, (TSample)0.6585588455200195, (TSample)-0.447580486536026},
-    {(TSample)0.13630613684654236, (TSample)-1.1204564571380615, (TSample)-0.23963132500648499, (TSample)0.7211284637451172, (TSample)0.37191134691238403, (TSample)0.12921375036239624, (TSample)0.6688366532325745, (TSample)-0.46782591938972473},
-    {(TSample)0.1364695280790329, (TSample)-1.1196974515914917, (TSample)-0.24199740588665009, (TSample)0.7207700610160828, (TSample)0.36551931500434875, (TSample)0.15177345275878906, (TSample)0.6737332344055176, (TSample)-0.49127650260925293},
-    {(TSample)0.13914252817630768, (TSample)-1.1120967864990234, (TSample)-0.23457151651382446, (TSample)0.7239704728126526, (TSample)0.3570743203163147, (TSample)0.17189818620681763, (TSample)0.6782848238945007, (TSample)-0.5101655721664429},
-    {(TSample)0.13131871819496155, (TSample)-1.1072702407836914, (TSample)-0.23234519362449646, (TSample)0.7201164364814758, (TSample)0.35147595405578613, (TSample)0.20129717886447906, (TSample)0.6799207925796509, (TSample)-0.533833920955658},
-    {(TSample)0.12688766419887543, (TSample)-1.1004722118377686, (TSample)-0.22384262084960938, (TSample)0.7131706476211548, (TSample)0.3477139174938202, (TSample)0.22489580512046814, (TSample)0.6833425760269165, (TSample)-0.5553693771362305},
-    {(TSample)0.12761664390563965, (TSample)-1.0972750186920166, (TSample)-0.2242518812417984, (TSample)0.708742082118988, (TSample)0.3482401669025421, (TSample)0.2422943413257599, (TSample)0.687750518321991, (TSample)-0.5797844529151917},
-    {(TSample)0.13230660557746887, (TSample)-1.0889508724212646, (TSample)-0.21928083896636963, (TSample)0.7078321576118469, (TSample)0.34213370084762573, (TSample)0.25930213928222656, (TSample)0.6864675879478455, (TSample)-0.5958377122879028},
-    {(TSample)0.12913279235363007, (TSample)-1.0866730213165283, (TSample)-0.2111341506242752, (TSample)0.6999156475067139, (TSample)0.3446181118488312, (TSample)0.274246484041214, (TSample)0.6904198527336121, (TSample)-0.622133731842041},
-    {(TSample)0.12955032289028168, (TSample)-1.0768156051635742, (TSample)-0.20611609518527985, (TSample)0.6936998963356018, (TSample)0.3436603844165802, (TSample)0.2928096652030945, (TSample)0.693075954914093, (TSample)-0.6370624899864197},
-    {(TSample)0.1316451132297516, (TSample)-1.0720497369766235, (TSample)-0.20499971508979797, (TSample)0.6879843473434448, (TSample)0.3440452516078949, (TSample)0.3074195683002472, (TSample)0.697355329990387, (TSample)-0.6587784290313721},
-    {(TSample)0.13040249049663544, (TSample)-1.0643097162246704, (TSample)-0.19621188938617706, (TSample)0.6826305985450745, (TSample)0.3404265344142914, (TSample)0.32506754994392395, (TSample)0.7000740766525269, (TSample)-0.6719698905944824},
-    {(TSample)0.12925997376441956, (TSample)-1.0595273971557617, (TSample)-0.19530639052391052, (TSample)0.6767056584358215, (TSample)0.34179776906967163, (TSample)0.34075090289115906, (TSample)0.7010341286659241, (TSample)-0.6921793818473816},
-    {(TSample)0.1296573430299759, (TSample)-1.0490542650222778, (TSample)-0.18840385973453522, (TSample)0.667335569858551, (TSample)0.3394124209880829, (TSample)0.3576391339302063, (TSample)0.7017603516578674, (TSample)-0.7035120725631714},
-    {(TSample)0.12454657256603241, (TSample)-1.0435158014297485, (TSample)-0.1802806407213211, (TSample)0.657512366771698, (TSample)0.34251588582992554, (TSample)0.3776203393936157, (TSample)0.7056644558906555, (TSample)-0.7279717326164246},
-    {(TSample)0.12901228666305542, (TSample)-1.0304573774337769, (TSample)-0.17715314030647278, (TSample)0.6482789516448975, (TSample)0.34540480375289917, (TSample)0.40030714869499207, (TSample)0.7079943418502808, (TSample)-0.7456596493721008},
-    {(TSample)0.12827348709106445, (TSample)-1.0258829593658447, (TSample)-0.16944603621959686, (TSample)0.633926510810852, (TSample)0.3577720820903778, (TSample)0.4064860939979553, (TSample)0.7179935574531555, (TSample)-0.7783598899841309},
-    {(TSample)0.13463550806045532, (TSample)-1.0146915912628174, (TSample)-0.16337011754512787, (TSample)0.6209262013435364, (TSample)0.3599720597267151, (TSample)0.42826637625694275, (TSample)0.7175862789154053, (TSample)-0.795609176158905},
-    {(TSample)0.13732066750526428, (TSample)-1.0118355751037598, (TSample)-0.1626461148262024, (TSample)0.6105051636695862, (TSample)0.3663192689418793, (TSample)0.44020867347717285, (TSample)0.7191497683525085, (TSample)-0.8192371726036072},
-    {(TSample)0.13802433013916016, (TSample)-0.9995096325874329, (TSample)-0.16093245148658752, (TSample)0.5957087874412537, (TSample)0.37149590253829956, (TSample)0.4527635872364044, (TSample)0.7209424376487732, (TSample)-0.8388702273368835},
-    {(TSample)0.15032321214675903, (TSample)-1.0028345584869385, (TSample)-0.16604529321193695, (TSample)0.5913938283920288, (TSample)0.3670840263366699, (TSample)0.459671288728714, (TSample)0.7152622938156128, (TSample)-0.854523241519928},
-    {(TSample)0.14787352085113525, (TSample)-0.9932747483253479, (TSample)-0.16229236125946045, (TSample)0.578037440776825, (TSample)0.37790974974632263, (TSample)0.4797229766845703, (TSample)0.7177321910858154, (TSample)-0.8673826456069946},
-    {(TSample)0.15245692431926727, (TSample)-0.9918036460876465, (TSample)-0.17043401300907135, (TSample)0.5655080080032349, (TSample)0.384121835231781, (TSample)0.4886305630207062, (TSample)0.7155535221099854, (TSample)-0.8902833461761475},
-    {(TSample)0.1572922170162201, (TSample)-0.9835237264633179, (TSample)-0.16784104704856873, (TSample)0.551088273525238, (TSample)0.38713082671165466, (TSample)0.5038933157920837, (TSample)0.7151985168457031, (TSample)-0.9011538624763489},
-    {(TSample)0.1564861387014389, (TSample)-0.9760704636573792, (TSample)-0.16612747311592102, (TSample)0.5368017554283142, (TSample)0.3912528455257416, (TSample)0.5158131718635559, (TSample)0.7172039151191711, (TSample)-0.9231939911842346},
-    {(TSample)0.16308525204658508, (TSample)-0.9665229320526123, (TSample)-0.15925608575344086, (TSample)0.5216121077537537, (TSample)0.3868114948272705, (TSample)0.5249093174934387, (TSample)0.7175679206848145, (TSample)-0.9320254921913147},
-    {(TSample)0.16445299983024597, (TSample)-0.9596880674362183, (TSample)-0.15460628271102905, (TSample)0.5136847496032715, (TSample)0.3941307067871094, (TSample)0.5315852761268616, (TSample)0.7209718227386475, (TSample)-0.9516218900680542},
-    {(TSample)0.15205271542072296, (TSample)-0.9553228616714478, (TSample)-0.1607130914926529, (TSample)0.48687291145324707, (TSample)0.4084751307964325, (TSample)0.5419679284095764, (TSample)0.714438259601593, (TSample)-0.9871180057525635},
-    {(TSample)0.15703359246253967, (TSample)-0.9460150003433228, (TSample)-0.14994916319847107, (TSample)0.47176191210746765, (TSample)0.41276776790618896, (TSample)0.5413547158241272, (TSample)0.7054062485694885, (TSample)-1.0132886171340942},
-    {(TSample)0.16554924845695496, (TSample)-0.9352939128875732, (TSample)-0.1481902152299881, (TSample)0.4591158628463745, (TSample)0.4175526797771454, (TSample)0.5457445383071899, (TSample)0.7015323638916016, (TSample)-1.0194599628448486},
-    {(TSample)0.16993990540504456, (TSample)-0.9301342964172363, (TSample)-0.14967194199562073, (TSample)0.4418237805366516, (TSample)0.42233017086982727, (TSample)0.535450279712677, (TSample)0.6967492699623108, (TSample)-1.0404764413833618},
-    {(TSample)0.17448127269744873, (TSample)-0.9250472784042358, (TSample)-0.14494481682777405, (TSample)0.4253453314304352, (TSample)0.42098018527030945, (TSample)0.5407746434211731, (TSample)0.6880338788032532, (TSample)-1.0513947010040283},
-    {(TSample)0.17719876766204834, (TSample)-0.9229360222816467, (TSample)-0.14003436267375946, (TSample)0.41288527846336365, (TSample)0.42964085936546326, (TSample)0.5427095293998718, (TSample)0.6823827028274536, (TSample)-1.0698235034942627},
-    {(TSample)0.18106798827648163, (TSample)-0.914451003074646, (TSample)-0.13398030400276184, (TSample)0.4010608494281769, (TSample)0.4334842562675476, (TSample)0.5456289052963257, (TSample)0.679058313369751, (TSample)-1.077896237373352},
-    {(TSample)0.1819225400686264, (TSample)-0.9076011776924133, (TSample)-0.13173171877861023, (TSample)0.3907019793987274, (TSample)0.44293105602264404, (TSample)0.5430338978767395, (TSample)0.6774749159812927, (TSample)-1.0955759286880493},
-    {(TSample)0.19142824411392212, (TSample)-0.8943804502487183, (TSample)-0.12181295454502106, (TSample)0.3759341537952423, (TSample)0.4585667550563812, (TSample)0.5378989577293396, (TSample)0.6734198331832886, (TSample)-1.1051868200302124},
-    {(TSample)0.1939401477575302, (TSample)-0.8867716789245605, (TSample)-0.12005795538425446, (TSample)0.3538348972797394, (TSample)0.4769997298717499, (TSample)0.5361855030059814, (TSample)0.6715788245201111, (TSample)-1.1261733770370483},
-    {(TSample)0.21850821375846863, (TSample)-0.8643383383750916, (TSample)-0.10002253949642181, (TSample)0.3336886167526245, (TSample)0.48510223627090454, (TSample)0.5361230969429016, (TSample)0.6711463332176208, (TSample)-1.1223978996276855},
-    {(TSample)0.23509462177753448, (TSample)-0.8482727408409119, (TSample)-0.0860186368227005, (TSample)0.32032978534698486, (TSample)0.493609756231308, (TSample)0.5377780795097351, (TSample)0.6727161407470703, (TSample)-1.1271430253982544},
-    {(TSample)0.24249990284442902, (TSample)-0.8387208580970764, (TSample)-0.08103825896978378, (TSample)0.3054170608520508, (TSample)0.5008417367935181, (TSample)0.5395303964614868, (TSample)0.6684116721153259, (TSample)-1.1299400329589844},
-    {(TSample)0.25183165073394775, (TSample)-0.8321383595466614, (TSample)-0.07573152333498001, (TSample)0.291913241147995, (TSample)0.5081756114959717, (TSample)0.5347602963447571, (TSample)0.666416347026825, (TSample)-1.1388230323791504},
-    {(TSample)0.25806647539138794, (TSample)-0.8229561448097229, (TSample)-0.07089465111494064, (TSample)0.27771878242492676, (TSample)0.5151983499526978, (TSample)0.5345123410224915, (TSample)0.6600397229194641, (TSample)-1.1395949125289917},
-    {(TSample)0.2668640911579132, (TSample)-0.8123183250427246, (TSample)-0.06874822825193405, (TSample)0.2654326260089874, (TSample)0.5263405442237854, (TSample)0.5283086895942688, (TSample)0.6559193730354309, (TSample)-1.1471248865127563},
-    {(TSample)0.26908475160598755, (TSample)-0.8016982674598694, (TSample)-0.06868236511945724, (TSample)0.2512791156768799, (TSample)0.5357850193977356, (TSample)0.5221648812294006, (TSample)0.6448033452033997, (TSample)-1.1558074951171875},
-    {(TSample)0.2714753746986389, (TSample)-0.7906734943389893, (TSample)-0.059270285069942474, (TSample)0.23853889107704163, (TSample)0.5435109734535217, (TSample)0.510746419429779, (TSample)0.6318517923355103, (TSample)-1.1632180213928223},
-    {(TSample)0.2775558829307556, (TSample)-0.7796911597251892, (TSample)-0.0524572916328907, (TSample)0.21798650920391083, (TSample)0.5531207323074341, (TSample)0.5043440461158752, (TSample)0.6222563982009888, (TSample)-1.162188172340393},
-    {(TSample)0.2805141806602478, (TSample)-0.7728980779647827, (TSample)-0.048574693500995636, (TSample)0.19852152466773987, (TSample)0.56621253490448, (TSample)0.4888588786125183, (TSample)0.6176654696464539, (TSample)-1.1748545169830322},
-    {(TSample)0.2832857370376587, (TSample)-0.7587720155715942, (TSample)-0.047278597950935364, (TSample)0.1865793913602829, (TSample)0.5816643834114075, (TSample)0.4793298542499542, (TSample)0.6076229214668274, (TSample)-1.1780431270599365},
-    {(TSample)0.28845974802970886, (TSample)-0.7478552460670471, (TSample)-0.04487445577979088, (TSample)0.1717032790184021, (TSample)0.597565770149231, (TSample)0.46394073963165283, (TSample)0.6028384566307068, (TSample)-1.1876492500305176},
-    {(TSample)0.29234281182289124, (TSample)-0.7273806929588318, (TSample)-0.04179088771343231, (TSample)0.1433144211769104, (TSample)0.6236658692359924, (TSample)0.44926348328590393, (TSample)0.5963664054870605, (TSample)-1.1940175294876099},
-    {(TSample)0.30096951127052307, (TSample)-0.716328501701355, (TSample)-0.040281519293785095, (TSample)0.13050296902656555, (TSample)0.6394467353820801, (TSample)0.42908552289009094, (TSample)0.5917401313781738, (TSample)-1.2010759115219116},
-    {(TSample)0.3107280731201172, (TSample)-0.7022226452827454, (TSample)-0.0343945249915123, (TSample)0.1094399020075798, (TSample)0.654391348361969, (TSample)0.4166249930858612, (TSample)0.5805544853210449, (TSample)-1.201529622077942},
-    {(TSample)0.32609161734580994, (TSample)-0.6817619800567627, (TSample)-0.023764444515109062, (TSample)0.08424994349479675, (TSample)0.6664706468582153, (TSample)0.3950602412223816, (TSample)0.573827862739563, (TSample)-1.2109241485595703},
-    {(TSample)0.33935779333114624, (TSample)-0.6719557046890259, (TSample)-0.011836481280624866, (TSample)0.06120859459042549, (TSample)0.6793674826622009, (TSample)0.3767825663089752, (TSample)0.5541637539863586, (TSample)-1.207050085067749},
-    {(TSample)0.35227730870246887, (TSample)-0.6560140252113342, (TSample)-0.009373936802148819, (TSample)0.0304190032184124, (TSample)0.7049041986465454, (TSample)0.35263705253601074, (TSample)0.5396402478218079, (TSample)-1.2089118957519531},
-    {(TSample)0.3883568346500397, (TSample)-0.6304199695587158, (TSample)-0.007873184978961945, (TSample)-0.01199350506067276, (TSample)0.740321934223175, (TSample)0.302697092294693, (TSample)0.5068321824073792, (TSample)-1.2080167531967163},
-    {(TSample)0.4056171774864197, (TSample)-0.6152012348175049, (TSample)-0.005456892773509026, (TSample)-0.039141979068517685, (TSample)0.7628692984580994, (TSample)0.26699098944664, (TSample)0.4955718517303467, (TSample)-1.2114372253417969},
-    {(TSample)0.41580507159233093, (TSample)-0.599798858165741, (TSample)0.002324070315808058, (TSample)-0.056260861456394196, (TSample)0.7771024703979492, (TSample)0.2499220222234726, (TSample)0.4878873825073242, (TSample)-1.2114709615707397},
-    {(TSample)0.42738503217697144, (TSample)-0.5924639701843262, (TSample)0.008721431717276573, (TSample)-0.0731692910194397, (TSample)0.7877829074859619, (TSample)0.22801434993743896, (TSample)0.47741496562957764, (TSample)-1.216353178024292},
-    {(TSample)0.44390544295310974, (TSample)-0.5750062465667725, (TSample)0.012425088323652744, (TSample)-0.09954846650362015, (TSample)0.8087123036384583, (TSample)0.21352271735668182, (TSample)0.4732775092124939, (TSample)-1.2194581031799316},
-    {(TSample)0.45603644847869873, (TSample)-0.5618584752082825, (TSample)0.013968429528176785, (TSample)-0.1177155151963234, (TSample)0.8277963399887085, (TSample)0.18845200538635254, (TSample)0.4652861952781677, (TSample)-1.2289772033691406},
-    {(TSample)0.46972501277923584, (TSample)-0.5431832671165466, (TSample)0.018986843526363373, (TSample)-0.1360333412885666, (TSample)0.8374096155166626, (TSample)0.17210036516189575, (TSample)0.45424962043762207, (TSample)-1.2276616096496582},
-    {(TSample)0.4853624105453491, (TSample)-0.52970951795578, (TSample)0.019540663808584213, (TSample)-0.15285596251487732, (TSample)0.8512217402458191, (TSample)0.1491430550813675, (TSample)0.4432285726070404, (TSample)-1.2370402812957764},
-    {(TSample)0.4975396394729614, (TSample)-0.5143008232116699, (TSample)0.02245360054075718, (TSample)-0.16448350250720978, (TSample)0.8590960502624512, (TSample)0.13460245728492737, (TSample)0.4365009069442749, (TSample)-1.2344626188278198},
-    {(TSample)0.5075173377990723, (TSample)-0.5050898194313049, (TSample)0.023460261523723602, (TSample)-0.1808030903339386, (TSample)0.8691145181655884, (TSample)0.11165869235992432, (TSample)0.4304082691669464, (TSample)-1.2415471076965332},
-    {(TSample)0.5179234147071838, (TSample)-0.4924638569355011, (TSample)0.030319394543766975, (TSample)-0.190143421292305, (TSample)0.8740334510803223, (TSample)0.10117165744304657, (TSample)0.42325499653816223, (TSample)-1.2394391298294067},
-    {(TSample)0.5247684717178345, (TSample)-0.4846714437007904, (TSample)0.032292939722537994, (TSample)-0.19944243133068085, (TSample)0.8797074556350708, (TSample)0.08711627870798111, (TSample)0.41922158002853394, (TSample)-1.2449332475662231},
-    {(TSample)0.5333658456802368, (TSample)-0.4713438153266907, (TSample)0.0384204126894474, (TSample)-0.21339747309684753, (TSample)0.8831601142883301, (TSample)0.07474728673696518, (TSample)0.41148707270622253, (TSample)-1.2423231601715088},
-    {(TSample)0.5392364263534546, (TSample)-0.4544188380241394, (TSample)0.04568656161427498, (TSample)-0.22996339201927185, (TSample)0.894356906414032, (TSample)0.05654826760292053, (TSample)0.40876877307891846, (TSample)-1.2481117248535156},
-    {(TSample)0.5497221946716309, (TSample)-0.4399307668209076, (TSample)0.052757278084754944, (TSample)-0.23566044867038727, (TSample)0.8974955677986145, (TSample)0.04514693096280098, (TSample)0.3957377076148987, (TSample)-1.2381470203399658},
-    {(TSample)0.5490755438804626, (TSample)-0.4266132712364197, (TSample)0.05788052827119827, (TSample)-0.24887609481811523, (TSample)0.9188146591186523, (TSample)0.01023061852902174, (TSample)0.37963613867759705, (TSample)-1.2429614067077637},
-    {(TSample)0.557213306427002, (TSample)-0.41330015659332275, (TSample)0.06091716140508652, (TSample)-0.2597324848175049, (TSample)0.9223889112472534, (TSample)-0.00461594806984067, (TSample)0.37092629075050354, (TSample)-1.2372238636016846},
-    {(TSample)0.5669457316398621, (TSample)-0.39778608083724976, (TSample)0.06794808804988861, (TSample)-0.2768901586532593, (TSample)0.931168258190155, (TSample)-0.027258966118097305, (TSample)0.36899444460868835, (TSample)-1.233449101448059},
-    {(TSample)0.5791633129119873, (TSample)-0.3766164779663086, (TSample)0.0794123038649559, (TSample)-0.2925300896167755, (TSample)0.9388914704322815, (TSample)-0.04377064108848572, (TSample)0.35690632462501526, (TSample)-1.2172329425811768},
-    {(TSample)0.5818027257919312, (TSample)-0.36746639013290405, (TSample)0.08761066198348999, (TSample)-0.304964542388916, (TSample)0.945619523525238, (TSample)-0.06706717610359192, (TSample)0.3519863784313202, (TSample)-1.211388349533081},
-    {(TSample)0.5904667973518372, (TSample)-0.3554099202156067, (TSample)0.09130945801734924, (TSample)-0.31230175495147705, (TSample)0.9475339651107788, (TSample)-0.08063558489084244, (TSample)0.3458609879016876, (TSample)-1.203862190246582},
-    {(TSample)0.5920566916465759, (TSample)-0.34590068459510803, (TSample)0.09117044508457184, (TSample)-0.317997008562088, (TSample)0.9538367390632629, (TSample)-0.09451339393854141, (TSample)0.3467424809932709, (TSample)-1.2119059562683105},
-    {(TSample)0.5997347235679626, (TSample)-0.3299926519393921, (TSample)0.09966860711574554, (TSample)-0.3238406777381897, (TSample)0.9526501893997192, (TSample)-0.10970713943243027, (TSample)0.3401796817779541, (TSample)-1.200377106666565},
-    {(TSample)0.6054071187973022, (TSample)-0.3222705125808716, (TSample)0.0996207594871521, (TSample)-0.3343566954135895, (TSample)0.95775306224823, (TSample)-0.12828676402568817, (TSample)0.3366325795650482, (TSample)-1.2051252126693726},
-    {(TSample)0.6184482574462891, (TSample)-0.3015589118003845, (TSample)0.11415620148181915, (TSample)-0.3506070673465729, (TSample)0.9557544589042664, (TSample)-0.1478802114725113, (TSample)0.32936152815818787, (TSample)-1.1867640018463135},
-    {(TSample)0.6214096546173096, (TSample)-0.28956013917922974, (TSample)0.11751142144203186, (TSample)-0.35519081354141235, (TSample)0.9597917795181274, (TSample)-0.16391818225383759, (TSample)0.32819294929504395, (TSample)-1.1897166967391968},
-    {(TSample)0.6318453550338745, (TSample)-0.27019253373146057, (TSample)0.1253558099269867, (TSample)-0.3584211766719818, (TSample)0.95778888463974, (TSample)-0.17258162796497345, (TSample)0.3256109356880188, (TSample)-1.1812036037445068},
-    {(TSample)0.6614296436309814, (TSample)-0.25585702061653137, (TSample)0.147603377699852, (TSample)-0.3432319462299347, (TSample)0.931652843952179, (TSample)-0.19464002549648285, (TSample)0.32591328024864197, (TSample)-1.1484400033950806},
-    {(TSample)0.6688889265060425, (TSample)-0.23814985156059265, (TSample)0.15383782982826233, (TSample)-0.34651219844818115, (TSample)0.9318663477897644, (TSample)-0.20782706141471863, (TSample)0.32162463665008545, (TSample)-1.1419786214828491},
-    {(TSample)0.6745370626449585, (TSample)-0.22519779205322266, (TSample)0.16132614016532898, (TSample)-0.3479483723640442, (TSample)0.9341374635696411, (TSample)-0.22700004279613495, (TSample)0.3185844123363495, (TSample)-1.139825701713562},
-    {(TSample)0.678520143032074, (TSample)-0.20820878446102142, (TSample)0.17703884840011597, (TSample)-0.3527766466140747, (TSample)0.9290401339530945, (TSample)-0.24082985520362854, (TSample)0.30760514736175537, (TSample)-1.1259671449661255},
-    {(TSample)0.6818071603775024, (TSample)-0.18717928230762482, (TSample)0.18614162504673004, (TSample)-0.3585153818130493, (TSample)0.9316210150718689, (TSample)-0.2583542764186859, (TSample)0.30448251962661743, (TSample)-1.1200658082962036},
-    {(TSample)0.6857199668884277, (TSample)-0.1677883267402649, (TSample)0.1990821212530136, (TSample)-0.36186856031417847, (TSample)0.9323726892471313, (TSample)-0.2705771028995514, (TSample)0.3000471591949463, (TSample)-1.108535885810852},
-    {(TSample)0.6916713118553162, (TSample)-0.15679922699928284, (TSample)0.20593787729740143, (TSample)-0.3636587858200073, (TSample)0.9275887608528137, (TSample)-0.2885746359825134, (TSample)0.2945883274078369, (TSample)-1.1029483079910278},
-    {(TSample)0.6923084259033203, (TSample)-0.14556556940078735, (TSample)0.21438123285770416, (TSample)-0.36755362153053284, (TSample)0.9206805229187012, (TSample)-0.3027241826057434, (TSample)0.29084500670433044, (TSample)-1.0940226316452026},
-    {(TSample)0.6936512589454651, (TSample)-0.13966692984104156, (TSample)0.23034831881523132, (TSample)-0.3748075067996979, (TSample)0.9182221293449402, (TSample)-0.333181232213974, (TSample)0.280843585729599, (TSample)-1.0894839763641357},
-    {(TSample)0.7001277208328247, (TSample)-0.11740945279598236, (TSample)0.2445555478334427, (TSample)-0.3837208151817322, (TSample)0.9209654331207275, (TSample)-0.3485129475593567, (TSample)0.28064247965812683, (TSample)-1.083243727684021},
-    {(TSample)0.7067546248435974, (TSample)-0.10326288640499115, (TSample)0.24952740967273712, (TSample)-0.39122429490089417, (TSample)0.926110565662384, (TSample)-0.364665687084198, (TSample)0.27780935168266296, (TSample)-1.0888659954071045},
-    {(TSample)0.72920823097229, (TSample)-0.08270254731178284, (TSample)0.27160346508026123, (TSample)-0.3955594003200531, (TSample)0.9096192121505737, (TSample)-0.38286346197128296, (TSample)0.2655603587627411, (TSample)-1.0676051378250122},
-    {(TSample)0.7238048315048218, (TSample)-0.08049937337636948, (TSample)0.26878637075424194, (TSample)-0.3986319601535797, (TSample)0.908693790435791, (TSample)-0.3994210958480835, (TSample)0.2642170488834381, (TSample)-1.0734490156173706},
-    {(TSample)0.7392927408218384, (TSample)-0.05830255150794983, (TSample)0.29320213198661804, (TSample)-0.3929029107093811, (TSample)0.8902313709259033, (TSample)-0.4117547571659088, (TSample)0.26162853837013245, (TSample)-1.0401772260665894},
-    {(TSample)0.7388243675231934, (TSample)-0.04810640960931778, (TSample)0.3011249899864197, (TSample)-0.3959001898765564, (TSample)0.8894951343536377, (TSample)-0.4296509027481079, (TSample)0.26091596484184265, (TSample)-1.04103684425354},
-    {(TSample)0.7398511171340942, (TSample)-0.03501465544104576, (TSample)0.3109659254550934, (TSample)-0.39691537618637085, (TSample)0.886032223701477, (TSample)-0.44510605931282043, (TSample)0.2579890191555023, (TSample)-1.0323069095611572},
-    {(TSample)0.7397467494010925, (TSample)-0.02930149808526039, (TSample)0.31897035241127014, (TSample)-0.39900368452072144, (TSample)0.8823903203010559, (TSample)-0.46398526430130005, (TSample)0.25704604387283325, (TSample)-1.0319246053695679},
-    {(TSample)0.7434690594673157, (TSample)-0.016545267775654793, (TSample)0.3301238715648651, (TSample)-0.3971395194530487, (TSample)0.8736756443977356, (TSample)-0.4787215292453766, (TSample)0.25681719183921814, (TSample)-1.020344853401184},
-    {(TSample)0.7409002780914307, (TSample)-0.007905345410108566, (TSample)0.3499820828437805, (TSample)-0.3949953317642212, (TSample)0.8615230321884155, (TSample)-0.4987225830554962, (TSample)0.24967755377292633, (TSample)-1.0153926610946655},
-    {(TSample)0.7379868030548096, (TSample)0.003603186458349228, (TSample)0.3608713448047638, (TSample)-0.3921586275100708, (TSample)0.8538063764572144, (TSample)-0.5089030861854553, (TSample)0.24599091708660126, (TSample)-1.008900761604309},
-    {(TSample)0.7324820160865784, (TSample)0.01103760115802288, (TSample)0.36796513199806213, (TSample)-0.38979196548461914, (TSample)0.8518257737159729, (TSample)-0.524905264377594, (TSample)0.24782226979732513, (TSample)-1.0101497173309326},
-    {(TSample)0.7297471165657043, (TSample)0.02031129226088524, (TSample)0.37855735421180725, (TSample)-0.386076956987381, (TSample)0.8432013988494873, (TSample)-0.5370516180992126, (TSample)0.24734321236610413, (TSample)-1.0013428926467896},
-    {(TSample)0.7244343161582947, (TSample)0.02294057421386242, (TSample)0.3808671534061432, (TSample)-0.3780268430709839, (TSample)0.8440499305725098, (TSample)-0.5631211400032043, (TSample)0.25687217712402344, (TSample)-0.9975627064704895},
-    {(TSample)0.7213401794433594, (TSample)0.03213260695338249, (TSample)0.3911755681037903, (TSample)-0.3765289783477783, (TSample)0.8323072791099548, (TSample)-0.5790435671806335, (TSample)0.25869691371917725, (TSample)-0.9898732900619507},
-    {(TSample)0.7156904935836792, (TSample)0.036524247378110886, (TSample)0.3953646421432495, (TSample)-0.37507888674736023, (TSample)0.826648473739624, (TSample)-0.5957142114639282, (TSample)0.2616818845272064, (TSample)-0.9929382801055908},
-    {(TSample)0.7134342193603516, (TSample)0.04866093769669533, (TSample)0.40287014842033386, (TSample)-0.3726317286491394, (TSample)0.8189189434051514, (TSample)-0.609019935131073, (TSample)0.263077050447464, (TSample)-0.9875653982162476},
-    {(TSample)0.7046566009521484, (TSample)0.056062571704387665, (TSample)0.4116218090057373, (TSample)-0.36737924814224243, (TSample)0.8084912896156311, (TSample)-0.6257032155990601, (TSample)0.26770129799842834, (TSample)-0.9947834610939026},
-    {(TSample)0.6932355165481567, (TSample)0.06134072318673134, (TSample)0.4192279279232025, (TSample)-0.3685902953147888, (TSample)0.8007084727287292, (TSample)-0.6436788439750671, (TSample)0.2702922821044922, (TSample)-1.0001273155212402},
-    {(TSample)0.6855157613754272, (TSample)0.06824560463428497, (TSample)0.4279739558696747, (TSample)-0.364018976688385, (TSample)0.7935629487037659, (TSample)-0.671445369720459, (TSample)0.27662014961242676, (TSample)-0.9969123005867004},
-    {(TSample)0.6791782975196838, (TSample)0.08221989125013351, (TSample)0.43721115589141846, (TSample)-0.3539661467075348, (TSample)0.7835911512374878, (TSample)-0.6981859803199768, (TSample)0.2824499309062958, (TSample)-0.9827584624290466},
-    {(TSample)0.6674709320068359, (TSample)0.08747770637273788, (TSample)0.44278788566589355, (TSample)-0.34242483973503113, (TSample)0.7795795202255249, (TSample)-0.7243377566337585, (TSample)0.28825584053993225, (TSample)-0.9814456701278687},
-    {(TSample)0.6572513580322266, (TSample)0.09451966732740402, (TSample)0.4508163630962372, (TSample)-0.3344290554523468, (TSample)0.7709873914718628, (TSample)-0.7360143661499023, (TSample)0.28931111097335815, (TSample)-0.9747239947319031},
-    {(TSample)0.649591326713562, (TSample)0.09532029181718826, (TSample)0.4511072337627411, (TSample)-0.3273636996746063, (TSample)0.7619935274124146, (TSample)-0.7519212961196899, (TSample)0.29232415556907654, (TSample)-0.9784613847732544},
-    {(TSample)0.6417925953865051, (TSample)0.10179466009140015, (TSample)0.45831719040870667, (TSample)-0.32018977403640747, (TSample)0.7492774128913879, (TSample)-0.762373149394989, (TSample)0.29508376121520996, (TSample)-0.9724672436714172},
-    {(TSample)0.6238650679588318, (TSample)0.10311653465032578, (TSample)0.4706119894981384, (TSample)-0.3124602138996124, (TSample)0.7369948029518127, (TSample)-0.7878690361976624, (TSample)0.29427841305732727, (TSample)-0.9717141389846802},
-    {(TSample)0.6153408885002136, (TSample)0.11047927290201187, (TSample)0.4774807393550873, (TSample)-0.3031650483608246, (TSample)0.7219088077545166, (TSample)-0.7985423803329468, (TSample)0.2997533679008484, (TSample)-0.9606253504753113},
-    {(TSample)0.6012592315673828, (TSample)0.11548646539449692, (TSample)0.4893893301486969, (TSample)-0.2992643713951111, (TSample)0.7069793343544006, (TSample)-0.8145359754562378, (TSample)0.3056392967700958, (TSample)-0.9556556940078735},
-    {(TSample)0.5912320613861084, (TSample)0.12009258568286896, (TSample)0.49656781554222107, (TSample)-0.2868020832538605, (TSample)0.688673734664917, (TSample)-0.8276790380477905, (TSample)0.31182098388671875, (TSample)-0.9490096569061279},
-    {(TSample)0.5791719555854797, (TSample)0.12042764574289322, (TSample)0.5000848174095154, (TSample)-0.2778741419315338, (TSample)0.6749681830406189, (TSample)-0.8419336676597595, (TSample)0.3187982439994812, (TSample)-0.9513372182846069},
-    {(TSample)0.5776390433311462, (TSample)0.12938044965267181, (TSample)0.5157673358917236, (TSample)-0.2647956609725952, (TSample)0.6509432196617126, (TSample)-0.849086344242096, (TSample)0.3246934413909912, (TSample)-0.934978723526001},
-    {(TSample)0.5607432723045349, (TSample)0.13196192681789398, (TSample)0.5263742804527283, (TSample)-0.2574300467967987, (TSample)0.6382560729980469, (TSample)-0.8575108051300049, (TSample)0.3357209265232086, (TSample)-0.9365007877349854},
-    {(TSample)0.5469496846199036, (TSample)0.1367405205965042, (TSample)0.5349592566490173, (TSample)-0.2472543567419052, (TSample)0.6195804476737976, (TSample)-0.8625932931900024, (TSample)0.34604161977767944, (TSample)-0.9302864670753479},
-    {(TSample)0.5314159989356995, (TSample)0.14194805920124054, (TSample)0.5390857458114624, (TSample)-0.23876263201236725, (TSample)0.6055384278297424, (TSample)-0.8679433465003967, (TSample)0.3558955192565918, (TSample)-0.9301864504814148},
-    {(TSample)0.5226829051971436, (TSample)0.15060682594776154, (TSample)0.543781042098999, (TSample)-0.22596067190170288, (TSample)0.5897839069366455, (TSample)-0.8788403272628784, (TSample)0.35919150710105896, (TSample)-0.9198815822601318},
-    {(TSample)0.5064907073974609, (TSample)0.1538536697626114, (TSample)0.5432182550430298, (TSample)-0.21031488478183746, (TSample)0.5770294666290283, (TSample)-0.8864892721176147, (TSample)0.36883220076560974, (TSample)-0.9166999459266663},
-    {(TSample)0.49828046560287476, (TSample)0.16100004315376282, (TSample)0.5507970452308655, (TSample)-0.19313497841358185, (TSample)0.5529130101203918, (TSample)-0.8917170763015747, (TSample)0.37538865208625793, (TSample)-0.8986372947692871},
-    {(TSample)0.4928147494792938, (TSample)0.16485320031642914, (TSample)0.5615742206573486, (TSample)-0.18052887916564941, (TSample)0.5286003947257996, (TSample)-0.9021633863449097, (TSample)0.38185128569602966, (TSample)-0.885258674621582},
-    {(TSample)0.4798201620578766, (TSample)0.16968408226966858, (TSample)0.5722017288208008, (TSample)-0.16180455684661865, (TSample)0.507032036781311, (TSample)-0.9135725498199463, (TSample)0.3848324716091156, (TSample)-0.8667475581169128},
-    {(TSample)0.4731748700141907, (TSample)0.17651647329330444, (TSample)0.5841799974441528, (TSample)-0.14164243638515472, (TSample)0.48427197337150574, (TSample)-0.925530195236206, (TSample)0.3912155330181122, (TSample)-0.8452202677726746},
-    {(TSample)0.4596785604953766, (TSample)0.17513684928417206, (TSample)0.5885255932807922, (TSample)-0.12914885580539703, (TSample)0.4663410186767578, (TSample)-0.9382025599479675, (TSample)0.39146313071250916, (TSample)-0.8337259888648987},
-    {(TSample)0.45515525341033936, (TSample)0.18449687957763672, (TSample)0.6041479706764221, (TSample)-0.10871852189302444, (TSample)0.4373537600040436, (TSample)-0.946768045425415, (TSample)0.40015310049057007, (TSample)-0.8121471405029297},
-    {(TSample)0.4443954825401306, (TSample)0.18773864209651947, (TSample)0.6048631072044373, (TSample)-0.09685063362121582, (TSample)0.4199569821357727, (TSample)-0.9512606859207153, (TSample)0.4027659595012665, (TSample)-0.8062805533409119},
-    {(TSample)0.42986994981765747, (TSample)0.19090819358825684, (TSample)0.6118210554122925, (TSample)-0.08297844231128693, (TSample)0.3986753225326538, (TSample)-0.9552630186080933, (TSample)0.4147913455963135, (TSample)-0.799990713596344},
-    {(TSample)0.41156890988349915, (TSample)0.1907045692205429, (TSample)0.6136149168014526, (TSample)-0.07323870807886124, (TSample)0.3819156289100647, (TSample)-0.9575871825218201, (TSample)0.42588892579078674, (TSample)-0.796657145023346},
-    {(TSample)0.39912375807762146, (TSample)0.19427935779094696, (TSample)0.6171162128448486, (TSample)-0.06143736466765404, (TSample)0.3638094961643219, (TSample)-0.9671033024787903, (TSample)0.4323583245277405, (TSample)-0.7877110242843628},
-    {(TSample)0.3847229480743408, (TSample)0.19258183240890503, (TSample)0.6138420701026917, (TSample)-0.05574677884578705, (TSample)0.34991511702537537, (TSample)-0.9714246392250061, (TSample)0.4384327828884125, (TSample)-0.7867981791496277},
-    {(TSample)0.3767988979816437, (TSample)0.1909417062997818, (TSample)0.6154265403747559, (TSample)-0.048106905072927475, (TSample)0.32658499479293823, (TSample)-0.984817624092102, (TSample)0.44760867953300476, (TSample)-0.78202223777771},
-    {(TSample)0.35976287722587585, (TSample)0.19167868793010712, (TSample)0.6124296188354492, (TSample)-0.04383915662765503, (TSample)0.31359660625457764, (TSample)-0.9882723689079285, (TSample)0.4518776535987854, (TSample)-0.7817528247833252},
-    {(TSample)0.34480586647987366, (TSample)0.1926964521408081, (TSample)0.6084761023521423, (TSample)-0.03532535955309868, (TSample)0.29799512028694153, (TSample)-0.994748055934906, (TSample)0.45448702573776245, (TSample)-0.7761125564575195},
-    {(TSample)0.3246847093105316, (TSample)0.19677723944187164, (TSample)0.6039720773696899, (TSample)-0.02589466981589794, (TSample)0.28202536702156067, (TSample)-0.9919933080673218, (TSample)0.4651813507080078, (TSample)-0.7768246531486511},
-    {(TSample)0.3101629614830017, (TSample)0.20543120801448822, (TSample)0.6073949337005615, (TSample)-0.010417872108519077, (TSample)0.2586287260055542, (TSample)-0.9911343455314636, (TSample)0.47810280323028564, (TSample)-0.7666401267051697},
-    {(TSample)0.3017931580543518, (TSample)0.21439450979232788, (TSample)0.606563925743103, (TSample)0.0037808266934007406, (TSample)0.24119620025157928, (TSample)-0.9874089956283569, (TSample)0.48422420024871826, (TSample)-0.7560186386108398},
-    {(TSample)0.29888907074928284, (TSample)0.2171487957239151, (TSample)0.6047888398170471, (TSample)0.01801871322095394, (TSample)0.21965347230434418, (TSample)-0.9922705292701721, (TSample)0.49195000529289246, (TSample)-0.7429069876670837},
-    {(TSample)0.287533700466156, (TSample)0.213377445936203, (TSample)0.6008843779563904, (TSample)0.02970912680029869, (TSample)0.20703087747097015, (TSample)-0.9959444999694824, (TSample)0.4966796040534973, (TSample)-0.7381021976470947},
-    {(TSample)0.2728133499622345, (TSample)0.21277476847171783, (TSample)0.608015775680542, (TSample)0.03860514983534813, (TSample)0.18676738440990448, (TSample)-1.00039541721344, (TSample)0.5002502799034119, (TSample)-0.7279958128929138},
-    {(TSample)0.2570447027683258, (TSample)0.20740699768066406, (TSample)0.6042336225509644, (TSample)0.04468855634331703, (TSample)0.17301760613918304, (TSample)-1.0009137392044067, (TSample)0.5040891766548157, (TSample)-0.7244574427604675},
-    {(TSample)0.2446710169315338, (TSample)0.20448194444179535, (TSample)0.6112483143806458, (TSample)0.053029946982860565, (TSample)0.14897771179676056, (TSample)-1.0046619176864624, (TSample)0.5118999481201172, (TSample)-0.7103304862976074},
-    {(TSample)0.2308613657951355, (TSample)0.19617855548858643, (TSample)0.6095012426376343, (TSample)0.059622444212436676, (TSample)0.12702080607414246, (TSample)-1.0100246667861938, (TSample)0.5184895396232605, (TSample)-0.699195384979248},
-    {(TSample)0.22020845115184784, (TSample)0.18921887874603271, (TSample)0.6112327575683594, (TSample)0.06864886730909348, (TSample)0.10004723817110062, (TSample)-1.0155006647109985, (TSample)0.5251815915107727, (TSample)-0.6877475380897522},
-    {(TSample)0.20142555236816406, (TSample)0.18296268582344055, (TSample)0.607393741607666, (TSample)0.07347257435321808, (TSample)0.08759426325559616, (TSample)-1.0158296823501587, (TSample)0.5300462245941162, (TSample)-0.684478223323822},
-    {(TSample)0.19108706712722778, (TSample)0.17746412754058838, (TSample)0.6068087220191956, (TSample)0.07732900977134705, (TSample)0.06764789670705795, (TSample)-1.0191386938095093, (TSample)0.5358254313468933, (TSample)-0.6757482886314392},
-    {(TSample)0.17801572382450104, (TSample)0.16907477378845215, (TSample)0.6059879064559937, (TSample)0.08679519593715668, (TSample)0.05094996094703674, (TSample)-1.0211079120635986, (TSample)0.5449385046958923, (TSample)-0.6711555123329163},
-    {(TSample)0.16989929974079132, (TSample)0.1638673096895218, (TSample)0.6067155003547668, (TSample)0.09463877230882645, (TSample)0.030471689999103546, (TSample)-1.0241260528564453, (TSample)0.5527578592300415, (TSample)-0.6605831980705261},
-    {(TSample)0.16165371239185333, (TSample)0.15734021365642548, (TSample)0.6043539643287659, (TSample)0.10164394974708557, (TSample)0.013945079408586025, (TSample)-1.020449161529541, (TSample)0.5583705902099609, (TSample)-0.6549625992774963},
-    {(TSample)0.14920394122600555, (TSample)0.15265895426273346, (TSample)0.6030910015106201, (TSample)0.10824095457792282, (TSample)-0.004225636832416058, (TSample)-1.0184812545776367, (TSample)0.5625980496406555, (TSample)-0.6470614075660706},
-    {(TSample)0.1344136744737625, (TSample)0.14311011135578156, (TSample)0.5979260802268982, (TSample)0.11609213054180145, (TSample)-0.021756673231720924, (TSample)-1.0146418809890747, (TSample)0.5653479695320129, (TSample)-0.6404874920845032},
-    {(TSample)0.12474368512630463, (TSample)0.14688856899738312, (TSample)0.6026912927627563, (TSample)0.128579244017601, (TSample)-0.04736020416021347, (TSample)-1.0036238431930542, (TSample)0.5713412165641785, (TSample)-0.6177355647087097},
-    {(TSample)0.12125831842422485, (TSample)0.14476636052131653, (TSample)0.6015015840530396, (TSample)0.14198414981365204, (TSample)-0.06774237006902695, (TSample)-1.001067876815796, (TSample)0.5728214383125305, (TSample)-0.5990615487098694},
-    {(TSample)0.11279436200857162, (TSample)0.14118696749210358, (TSample)0.5958613753318787, (TSample)0.1443643569946289, (TSample)-0.07982044667005539, (TSample)-1.001526117324829, (TSample)0.5753058195114136, (TSample)-0.5923502445220947},
-    {(TSample)0.09783531725406647, (TSample)0.1316504329442978, (TSample)0.5886533260345459, (TSample)0.1533745974302292, (TSample)-0.0944213718175888, (TSample)-0.9977350831031799, (TSample)0.5787523984909058, (TSample)-0.5889871716499329},
-    {(TSample)0.08632921427488327, (TSample)0.1254454255104065, (TSample)0.5878080129623413, (TSample)0.15707990527153015, (TSample)-0.11446453630924225, (TSample)-0.998094379901886, (TSample)0.5841337442398071, (TSample)-0.578273355960846},
-    {(TSample)0.07293137907981873, (TSample)0.1182030662894249, (TSample)0.5746095180511475, (TSample)0.16106706857681274, (TSample)-0.12345277518033981, (TSample)-0.9939009547233582, (TSample)0.5889644622802734, (TSample)-0.5786500573158264},
-    {(TSample)0.05803197622299194, (TSample)0.11229026317596436, (TSample)0.5706163048744202, (TSample)0.16679181158542633, (TSample)-0.1428879201412201, (TSample)-0.9814498424530029, (TSample)0.5902983546257019, (TSample)-0.5604240298271179},
-    {(TSample)0.051850322633981705, (TSample)0.11174992471933365, (TSample)0.5634028315544128, (TSample)0.17957866191864014, (TSample)-0.164511039853096, (TSample)-0.967056393623352, (TSample)0.5955756902694702, (TSample)-0.5447980761528015},
-    {(TSample)0.04952205717563629, (TSample)0.11209888756275177, (TSample)0.5658180713653564, (TSample)0.19381183385849, (TSample)-0.1906643509864807, (TSample)-0.9549482464790344, (TSample)0.5981831550598145, (TSample)-0.5161393284797668},
-    {(TSample)0.039831455796957016, (TSample)0.10991907864809036, (TSample)0.5675787925720215, (TSample)0.20840127766132355, (TSample)-0.21140284836292267, (TSample)-0.9456971883773804, (TSample)0.5989315509796143, (TSample)-0.49030712246894836},
-    {(TSample)0.028042925521731377, (TSample)0.10476323217153549, (TSample)0.5667848587036133, (TSample)0.21817103028297424, (TSample)-0.23228341341018677, (TSample)-0.9399513602256775, (TSample)0.6006999611854553, (TSample)-0.4711568057537079},
-    {(TSample)0.014880609698593616, (TSample)0.08624425530433655, (TSample)0.5543892979621887, (TSample)0.2211804836988449, (TSample)-0.24111777544021606, (TSample)-0.937218189239502, (TSample)0.6014564037322998, (TSample)-0.4730527997016907},
-    {(TSample)0.010428432375192642, (TSample)0.08291205763816833, (TSample)0.5462290048599243, (TSample)0.22005392611026764, (TSample)-0.2538317143917084, (TSample)-0.9282418489456177, (TSample)0.5990939140319824, (TSample)-0.45575809478759766},
-    {(TSample)0.042856503278017044, (TSample)0.10055296123027802, (TSample)0.5641523003578186, (TSample)0.25765490531921387, (TSample)-0.31168192625045776, (TSample)-0.8998361825942993, (TSample)0.5980950593948364, (TSample)-0.3885616064071655},
-    {(TSample)0.04041143134236336, (TSample)0.08966805040836334, (TSample)0.5552526116371155, (TSample)0.26071199774742126, (TSample)-0.33124348521232605, (TSample)-0.8930754065513611, (TSample)0.5955374836921692, (TSample)-0.37460994720458984},
-    {(TSample)0.04434964805841446, (TSample)0.08022910356521606, (TSample)0.5533249378204346, (TSample)0.27561163902282715, (TSample)-0.35217931866645813, (TSample)-0.8793542385101318, (TSample)0.5957991480827332, (TSample)-0.3523251414299011},
-    {(TSample)0.044707443565130234, (TSample)0.06805077940225601, (TSample)0.5515307188034058, (TSample)0.28194767236709595, (TSample)-0.3698097765445709, (TSample)-0.8685003519058228, (TSample)0.5924001336097717, (TSample)-0.33821526169776917},
-    {(TSample)0.036722566932439804, (TSample)0.057987961918115616, (TSample)0.5407935976982117, (TSample)0.2807810604572296, (TSample)-0.382928729057312, (TSample)-0.8564674258232117, (TSample)0.5926907062530518, (TSample)-0.33603835105895996},
-    {(TSample)0.027427200227975845, (TSample)0.048721589148044586, (TSample)0.5380265116691589, (TSample)0.27735456824302673, (TSample)-0.4026159346103668, (TSample)-0.8415071964263916, (TSample)0.5931063294410706, (TSample)-0.326237291097641},
-    {(TSample)0.01909499242901802, (TSample)0.03395175188779831, (TSample)0.5261624455451965, (TSample)0.272611528635025, (TSample)-0.41794681549072266, (TSample)-0.8330808281898499, (TSample)0.5929145812988281, (TSample)-0.3185236155986786},
-    {(TSample)0.014125309884548187, (TSample)0.028823494911193848, (TSample)0.5193806886672974, (TSample)0.26829513907432556, (TSample)-0.43260839581489563, (TSample)-0.8177209496498108, (TSample)0.5921365022659302, (TSample)-0.3042115271091461},
-    {(TSample)0.017185410484671593, (TSample)0.023689134046435356, (TSample)0.5145817995071411, (TSample)0.26983773708343506, (TSample)-0.449812650680542, (TSample)-0.8026412129402161, (TSample)0.5877706408500671, (TSample)-0.2803974449634552},
-    {(TSample)0.011183077469468117, (TSample)0.013562276028096676, (TSample)0.5061905980110168, (TSample)0.2622673809528351, (TSample)-0.4610694944858551, (TSample)-0.7915850877761841, (TSample)0.581248939037323, (TSample)-0.26602903008461},
-    {(TSample)0.004667448811233044, (TSample)-0.010095542296767235, (TSample)0.4933837354183197, (TSample)0.24669131636619568, (TSample)-0.4735868573188782, (TSample)-0.7890502214431763, (TSample)0.5693802833557129, (TSample)-0.25470706820487976},
-    {(TSample)-0.004351179115474224, (TSample)-0.02038882113993168, (TSample)0.46726706624031067, (TSample)0.2411026954650879, (TSample)-0.48610445857048035, (TSample)-0.774847686290741, (TSample)0.5644927620887756, (TSample)-0.2511409521102905},
-    {(TSample)-0.011272785253822803, (TSample)-0.0267590694129467, (TSample)0.45246583223342896, (TSample)0.23801380395889282, (TSample)-0.4871261417865753, (TSample)-0.7604690790176392, (TSample)0.5617908835411072, (TSample)-0.2495439648628235},
-    {(TSample)-0.01332986168563366, (TSample)-0.031649403274059296, (TSample)0.4450775682926178, (TSample)0.23123399913311005, (TSample)-0.495455801486969, (TSample)-0.7448096871376038, (TSample)0.5561172962188721, (TSample)-0.23381400108337402},
-    {(TSample)-0.013175779022276402, (TSample)-0.038277383893728256, (TSample)0.43585243821144104, (TSample)0.22325493395328522, (TSample)-0.5018652081489563, (TSample)-0.7275998592376709, (TSample)0.546646237373352, (TSample)-0.21996954083442688},
-    {(TSample)-0.014819442294538021, (TSample)-0.04789266362786293, (TSample)0.42524924874305725, (TSample)0.21025203168392181, (TSample)-0.5012121200561523, (TSample)-0.7082867622375488, (TSample)0.5333067774772644, (TSample)-0.20935270190238953},
-    {(TSample)-0.01954452320933342, (TSample)-0.06215507164597511, (TSample)0.41077888011932373, (TSample)0.19539125263690948, (TSample)-0.5070689916610718, (TSample)-0.6982007026672363, (TSample)0.5240445733070374, (TSample)-0.19750528037548065},
-    {(TSample)-0.022603793069720268, (TSample)-0.06990864127874374, (TSample)0.39959144592285156, (TSample)0.18111662566661835, (TSample)-0.5061112642288208, (TSample)-0.6877766251564026, (TSample)0.5195491909980774, (TSample)-0.18985474109649658},
-    {(TSample)-0.01944376714527607, (TSample)-0.07690541446208954, (TSample)0.39038950204849243, (TSample)0.17278459668159485, (TSample)-0.5014129877090454, (TSample)-0.6707661747932434, (TSample)0.510200560092926, (TSample)-0.16857169568538666},
-    {(TSample)-0.01843150146305561, (TSample)-0.08059190213680267, (TSample)0.3877844214439392, (TSample)0.16419091820716858, (TSample)-0.5012810230255127, (TSample)-0.6476186513900757, (TSample)0.4991653561592102, (TSample)-0.14363324642181396},
-    {(TSample)-0.015245153568685055, (TSample)-0.08178030699491501, (TSample)0.3821831941604614, (TSample)0.15771633386611938, (TSample)-0.4962502419948578, (TSample)-0.6313029527664185, (TSample)0.48652729392051697, (TSample)-0.12201936542987823},
-    {(TSample)-0.015558989718556404, (TSample)-0.08627153933048248, (TSample)0.37467193603515625, (TSample)0.14451615512371063, (TSample)-0.4902644455432892, (TSample)-0.6132514476776123, (TSample)0.47466450929641724, (TSample)-0.10455963760614395},
-    {(TSample)-0.01985461264848709, (TSample)-0.09596472978591919, (TSample)0.3633580803871155, (TSample)0.13115675747394562, (TSample)-0.4807906150817871, (TSample)-0.59769207239151, (TSample)0.4646207392215729, (TSample)-0.09670327603816986},
-    {(TSample)-0.019343961030244827, (TSample)-0.10137099772691727, (TSample)0.35330578684806824, (TSample)0.11944396793842316, (TSample)-0.4728644788265228, (TSample)-0.5796381235122681, (TSample)0.45196211338043213, (TSample)-0.07853477448225021},
-    {(TSample)-0.01887323707342148, (TSample)-0.10580355674028397, (TSample)0.34133490920066833, (TSample)0.10789861530065536, (TSample)-0.4558303952217102, (TSample)-0.5622191429138184, (TSample)0.4380066990852356, (TSample)-0.06894441694021225},
-    {(TSample)-0.011334951967000961, (TSample)-0.10756225138902664, (TSample)0.3341935873031616, (TSample)0.09753216058015823, (TSample)-0.4424635171890259, (TSample)-0.5421926975250244, (TSample)0.4235035479068756, (TSample)-0.04441307112574577},
-    {(TSample)-0.005464496091008186, (TSample)-0.11158841848373413, (TSample)0.32226791977882385, (TSample)0.093708336353302, (TSample)-0.4241843521595001, (TSample)-0.5201458930969238, (TSample)0.4017670452594757, (TSample)-0.02747655287384987},
-    {(TSample)-0.00012251490261405706, (TSample)-0.11186889559030533, (TSample)0.31238824129104614, (TSample)0.08603089302778244, (TSample)-0.4069210886955261, (TSample)-0.49738943576812744, (TSample)0.3849506676197052, (TSample)-0.0105529660359025},
-    {(TSample)0.0016529967542737722, (TSample)-0.11241040378808975, (TSample)0.299845814704895, (TSample)0.08303552120923996, (TSample)-0.38568034768104553, (TSample)-0.4780454635620117, (TSample)0.36586734652519226, (TSample)0.0010523933451622725},
-    {(TSample)0.0086258165538311, (TSample)-0.11029409617185593, (TSample)0.28591281175613403, (TSample)0.0760853961110115, (TSample)-0.36126574873924255, (TSample)-0.4512700140476227, (TSample)0.34449177980422974, (TSample)0.012543394230306149},
-    {(TSample)0.01042149681597948, (TSample)-0.11167758703231812, (TSample)0.2809070348739624, (TSample)0.07174576073884964, (TSample)-0.3370724320411682, (TSample)-0.42536067962646484, (TSample)0.3194545805454254, (TSample)0.02021511271595955},
-    {(TSample)0.018189687281847, (TSample)-0.10677535086870193, (TSample)0.26155567169189453, (TSample)0.05941024422645569, (TSample)-0.3082767426967621, (TSample)-0.38624921441078186, (TSample)0.28613799810409546, (TSample)0.028415722772479057},
-    {(TSample)0.03491980955004692, (TSample)-0.09228593111038208, (TSample)0.2250501960515976, (TSample)0.043492332100868225, (TSample)-0.2277519553899765, (TSample)-0.3236808776855469, (TSample)0.22693635523319244, (TSample)0.04642796143889427},
-    {(TSample)0.024263212457299232, (TSample)-0.054741259664297104, (TSample)0.1306653767824173, (TSample)0.03853192552924156, (TSample)-0.15763503313064575, (TSample)-0.1714523732662201, (TSample)0.11252526938915253, (TSample)0.029635939747095108}
-}};
-std::array<TSample, 600> biases = {
-    (TSample)0.10315033793449402,
-    (TSample)0.16453203558921814,
-    (TSample)0.20419315993785858,
-    (TSample)0.2372640073299408,
-    (TSample)0.2634998559951782,
-    (TSample)0.28764814138412476,
-    (TSample)0.3092195689678192,
-    (TSample)0.3297305703163147,
-    (TSample)0.34882065653800964,
-    (TSample)0.3678368926048279,
-    (TSample)0.38528546690940857,
-    (TSample)0.40057238936424255,
-    (TSample)0.4180772304534912,
-    (TSample)0.4328465461730957,
-    (TSample)0.4472884237766266,
-    (TSample)0.45908135175704956,
-    (TSample)0.473237007856369,
-    (TSample)0.4838467836380005,
-    (TSample)0.4962819218635559,
-    (TSample)0.5067028999328613,
-    (TSample)0.5177538990974426,
-    (TSample)0.5265982747077942,
-    (TSample)0.5346825122833252,
-    (TSample)0.544042706489563,
-    (TSample)0.5527054071426392,
-    (TSample)0.5613375902175903,
-    (TSample)0.5690299272537231,
-    (TSample)0.5751580595970154,
-    (TSample)0.578043520450592,
-    (TSample)0.582988440990448,
-    (TSample)0.587859570980072,
-    (TSample)0.5885695815086365,
-    (TSample)0.5916042327880859,
-    (TSample)0.5938692092895508,
-    (TSample)0.595223605632782,
-    (TSample)0.5956096649169922,
-    (TSample)0.5942227840423584,
-    (TSample)0.5967566967010498,
-    (TSample)0.597881019115448,
-    (TSample)0.5962600708007812,
-    (TSample)0.5962561368942261,
-    (TSample)0.5954697728157043,
-    (TSample)0.5951933860778809,
-    (TSample)0.5917807221412659,
-    (TSample)0.5908125042915344,
-    (TSample)0.5882386565208435,
-    (TSample)0.586729109287262,
-    (TSample)0.5861556529998779,
-    (TSample)0.5850293636322021,
-    (TSample)0.5838743448257446,
-    (TSample)0.5809717178344727,
-    (TSample)0.5808951258659363,
-    (TSample)0.5798918604850769,
-    (TSample)0.5795924067497253,
-    (TSample)0.5781405568122864,
-    (TSample)0.5758519768714905,
-    (TSample)0.5740320086479187,
-    (TSample)0.56983882188797,
-    (TSample)0.5668953061103821,
-    (TSample)0.5617659091949463,
-    (TSample)0.5568665862083435,
-    (TSample)0.5524049997329712,
-    (TSample)0.5482416749000549,
-    (TSample)0.5405260920524597,
-    (TSample)0.5335583090782166,
-    (TSample)0.5292434692382812,
-    (TSample)0.5252640843391418,
-    (TSample)0.5205775499343872,
-    (TSample)0.5176025032997131,
-    (TSample)0.5146294832229614,
-    (TSample)0.5123547315597534,
-    (TSample)0.5091605186462402,
-    (TSample)0.5054313540458679,
-    (TSample)0.5006427764892578,
-    (TSample)0.4966813325881958,
-    (TSample)0.49178045988082886,
-    (TSample)0.48928892612457275,
-    (TSample)0.48520374298095703,
-    (TSample)0.48194006085395813,
-    (TSample)0.47838515043258667,
-    (TSample)0.47350046038627625,
-    (TSample)0.46909964084625244,
-    (TSample)0.46413934230804443,
-    (TSample)0.45888668298721313,
-    (TSample)0.45467033982276917,
-    (TSample)0.44866177439689636,
-    (TSample)0.44608598947525024,
-    (TSample)0.4406302273273468,
-    (TSample)0.4355485737323761,
-    (TSample)0.4294077455997467,
-    (TSample)0.42375898361206055,
-    (TSample)0.4169231355190277,
-    (TSample)0.41200143098831177,
-    (TSample)0.40573009848594666,
-    (TSample)0.39899155497550964,
-    (TSample)0.39155149459838867,
-    (TSample)0.38636744022369385,
-    (TSample)0.3811301589012146,
-    (TSample)0.37472033500671387,
-    (TSample)0.3665448725223541,
-    (TSample)0.36332255601882935,
-    (TSample)0.3592175841331482,
-    (TSample)0.35467422008514404,
-    (TSample)0.3503144085407257,
-    (TSample)0.3457101881504059,
-    (TSample)0.34376591444015503,
-    (TSample)0.3398957848548889,
-    (TSample)0.3371642827987671,
-    (TSample)0.33219990134239197,
-    (TSample)0.3296102285385132,
-    (TSample)0.3232007324695587,
-    (TSample)0.31961676478385925,
-    (TSample)0.31663596630096436,
-    (TSample)0.31367844343185425,
-    (TSample)0.31072574853897095,
-    (TSample)0.3090851306915283,
-    (TSample)0.30425825715065,
-    (TSample)0.3017904758453369,
-    (TSample)0.2977007329463959,
-    (TSample)0.29441404342651367,
-    (TSample)0.2888835370540619,
-    (TSample)0.28657329082489014,
-    (TSample)0.28000620007514954,
-    (TSample)0.2763863205909729,
-    (TSample)0.2714214622974396,
-    (TSample)0.2684504985809326,
-    (TSample)0.26600587368011475,
-    (TSample)0.26461875438690186,
-    (TSample)0.260891854763031,
-    (TSample)0.2607971727848053,
-    (TSample)0.2569907605648041,
-    (TSample)0.2557205557823181,
-    (TSample)0.25273001194000244,
-    (TSample)0.2510710656642914,
-    (TSample)0.2469453662633896,
-    (TSample)0.2455260157585144,
-    (TSample)0.24202457070350647,
-    (TSample)0.23965542018413544,
-    (TSample)0.23807966709136963,
-    (TSample)0.23486630618572235,
-    (TSample)0.2315305471420288,
-    (TSample)0.23054955899715424,
-    (TSample)0.2282336950302124,
-    (TSample)0.227050319314003,
-    (TSample)0.22409947216510773,
-    (TSample)0.2241053283214569,
-    (TSample)0.22262324392795563,
-    (TSample)0.22279874980449677,
-    (TSample)0.21990913152694702,
-    (TSample)0.22062984108924866,
-    (TSample)0.2157617211341858,
-    (TSample)0.21599484980106354,
-    (TSample)0.21675856411457062,
-    (TSample)0.21911820769309998,
-    (TSample)0.21673189103603363,
-    (TSample)0.21778668463230133,
-    (TSample)0.2172991931438446,
-    (TSample)0.21597331762313843,
-    (TSample)0.21332338452339172,
-    (TSample)0.21209755539894104,
-    (TSample)0.20925049483776093,
-    (TSample)0.2054566740989685,
-    (TSample)0.20381183922290802,
-    (TSample)0.2019760012626648,
-    (TSample)0.1985267549753189,
-    (TSample)0.19530507922172546,
-    (TSample)0.19467075169086456,
-    (TSample)0.19398804008960724,
-    (TSample)0.1932464838027954,
-    (TSample)0.19335748255252838,
-    (TSample)0.19223466515541077,
-    (TSample)0.19084219634532928,
-    (TSample)0.18862783908843994,
-    (TSample)0.18187399208545685,
-    (TSample)0.17326274514198303,
-    (TSample)0.16990084946155548,
-    (TSample)0.16796612739562988,
-    (TSample)0.16615603864192963,
-    (TSample)0.16596229374408722,
-    (TSample)0.16452287137508392,
-    (TSample)0.162812277674675,
-    (TSample)0.16240185499191284,
-    (TSample)0.1610657125711441,
-    (TSample)0.15735863149166107,
-    (TSample)0.15447336435317993,
-    (TSample)0.1517878770828247,
-    (TSample)0.14963336288928986,
-    (TSample)0.14603129029273987,
-    (TSample)0.14495499432086945,
-    (TSample)0.14356128871440887,
-    (TSample)0.13923218846321106,
-    (TSample)0.13408604264259338,
-    (TSample)0.13170595467090607,
-    (TSample)0.12683291733264923,
-    (TSample)0.12403042614459991,
-    (TSample)0.1188523918390274,
-    (TSample)0.11216839402914047,
-    (TSample)0.1097722202539444,
-    (TSample)0.1068606749176979,
-    (TSample)0.10565025359392166,
-    (TSample)0.10530440509319305,
-    (TSample)0.10342453420162201,
-    (TSample)0.10128657519817352,
-    (TSample)0.09900666028261185,
-    (TSample)0.09761794656515121,
-    (TSample)0.09534431993961334,
-    (TSample)0.09359626471996307,
-    (TSample)0.09150685369968414,
-    (TSample)0.08887087553739548,
-    (TSample)0.08681689947843552,
-    (TSample)0.08568837493658066,
-    (TSample)0.0840100646018982,
-    (TSample)0.08164699375629425,
-    (TSample)0.08000224083662033,
-    (TSample)0.07949668914079666,
-    (TSample)0.07800690084695816,
-    (TSample)0.0792773887515068,
-    (TSample)0.07770319283008575,
-    (TSample)0.07811349630355835,
-    (TSample)0.07667985558509827,
-    (TSample)0.07717593759298325,
-    (TSample)0.07506128400564194,
-    (TSample)0.07543253898620605,
-    (TSample)0.0731888860464096,
-    (TSample)0.07108046859502792,
-    (TSample)0.07125764340162277,
-    (TSample)0.07291127741336823,
-    (TSample)0.07126069813966751,
-    (TSample)0.070250503718853,
-    (TSample)0.06968135386705399,
-    (TSample)0.0700816810131073,
-    (TSample)0.07019796222448349,
-    (TSample)0.06845568120479584,
-    (TSample)0.06923162192106247,
-    (TSample)0.06742941588163376,
-    (TSample)0.064407579600811,
-    (TSample)0.06626564264297485,
-    (TSample)0.06331544369459152,
-    (TSample)0.062114253640174866,
-    (TSample)0.06212928891181946,
-    (TSample)0.06306231021881104,
-    (TSample)0.05978141725063324,
-    (TSample)0.057807791978120804,
-    (TSample)0.054846156388521194,
-    (TSample)0.0547652505338192,
-    (TSample)0.053017765283584595,
-    (TSample)0.05336243286728859,
-    (TSample)0.051792632788419724,
-    (TSample)0.05093446746468544,
-    (TSample)0.05071652680635452,
-    (TSample)0.05116776376962662,
-    (TSample)0.05127938836812973,
-    (TSample)0.05017809197306633,
-    (TSample)0.04970690608024597,
-    (TSample)0.05101187527179718,
-    (TSample)0.052737314254045486,
-    (TSample)0.05105341970920563,
-    (TSample)0.05253693461418152,
-    (TSample)0.050557803362607956,
-    (TSample)0.050721120089292526,
-    (TSample)0.04765872657299042,
-    (TSample)0.048921987414360046,
-    (TSample)0.04847247898578644,
-    (TSample)0.05160786956548691,
-    (TSample)0.054599665105342865,
-    (TSample)0.05464477837085724,
-    (TSample)0.05314135551452637,
-    (TSample)0.05454675480723381,
-    (TSample)0.05312219262123108,
-    (TSample)0.053747568279504776,
-    (TSample)0.05066803842782974,
-    (TSample)0.0502573698759079,
-    (TSample)0.04841392859816551,
-    (TSample)0.04758184403181076,
-    (TSample)0.04654405266046524,
-    (TSample)0.047045912593603134,
-    (TSample)0.04538242518901825,
-    (TSample)0.04744299128651619,
-    (TSample)0.04639662057161331,
-    (TSample)0.047509316354990005,
-    (TSample)0.04071184992790222,
-    (TSample)0.03748808801174164,
-    (TSample)0.03509562835097313,
-    (TSample)0.0388881117105484,
-    (TSample)0.03373569995164871,
-    (TSample)0.03414716571569443,
-    (TSample)0.03473328799009323,
-    (TSample)0.037104640156030655,
-    (TSample)0.036035533994436264,
-    (TSample)0.03850396350026131,
-    (TSample)0.03570910543203354,
-    (TSample)0.03812435641884804,
-    (TSample)0.03760601580142975,
-    (TSample)0.03837875649333,
-    (TSample)0.035709358751773834,
-    (TSample)0.037167858332395554,
-    (TSample)0.03573453798890114,
-    (TSample)0.036561090499162674,
-    (TSample)0.039045680314302444,
-    (TSample)0.03966081142425537,
-    (TSample)0.024445706978440285,
-    (TSample)0.02339063584804535,
-    (TSample)0.026771416887640953,
-    (TSample)0.029577938839793205,
-    (TSample)0.028287097811698914,
-    (TSample)0.031631503254175186,
-    (TSample)0.03428972139954567,
-    (TSample)0.03706004470586777,
-    (TSample)0.03612874448299408,
-    (TSample)0.037824731320142746,
-    (TSample)0.033974792808294296,
-    (TSample)0.02936423011124134,
-    (TSample)0.02350676618516445,
-    (TSample)0.022068647667765617,
-    (TSample)0.019889289513230324,
-    (TSample)0.019040456041693687,
-    (TSample)0.01886763982474804,
-    (TSample)0.019824014976620674,
-    (TSample)0.014908285811543465,
-    (TSample)0.011736137792468071,
-    (TSample)0.007460397202521563,
-    (TSample)0.006493294145911932,
-    (TSample)0.003309021471068263,
-    (TSample)0.0029235135298222303,
-    (TSample)-0.0010659077670425177,
-    (TSample)-0.0021547838114202023,
-    (TSample)-0.004894424695521593,
-    (TSample)-0.006060494109988213,
-    (TSample)-0.007541902828961611,
-    (TSample)-0.006175077520310879,
-    (TSample)-0.00933678075671196,
-    (TSample)-0.010531771928071976,
-    (TSample)-0.01289078313857317,
-    (TSample)-0.013533363118767738,
-    (TSample)-0.016066530719399452,
-    (TSample)-0.017013657838106155,
-    (TSample)-0.023150818422436714,
-    (TSample)-0.021724559366703033,
-    (TSample)-0.024937624111771584,
-    (TSample)-0.02715337835252285,
-    (TSample)-0.02855108678340912,
-    (TSample)-0.03273766115307808,
-    (TSample)-0.035186801105737686,
-    (TSample)-0.03595253452658653,
-    (TSample)-0.03846672177314758,
-    (TSample)-0.04088730365037918,
-    (TSample)-0.045291051268577576,
-    (TSample)-0.04614473506808281,
-    (TSample)-0.048889826983213425,
-    (TSample)-0.05184276029467583,
-    (TSample)-0.05575527995824814,
-    (TSample)-0.05711369588971138,
-    (TSample)-0.05965699627995491,
-    (TSample)-0.06153222918510437,
-    (TSample)-0.06576729565858841,
-    (TSample)-0.07125797122716904,
-    (TSample)-0.07744801044464111,
-    (TSample)-0.08033640682697296,
-    (TSample)-0.08378538489341736,
-    (TSample)-0.08583671599626541,
-    (TSample)-0.08856574445962906,
-    (TSample)-0.09132998436689377,
-    (TSample)-0.09399761259555817,
-    (TSample)-0.09659551829099655,
-    (TSample)-0.09926711022853851,
-    (TSample)-0.10251093655824661,
-    (TSample)-0.10498989373445511,
-    (TSample)-0.10594294220209122,
-    (TSample)-0.1066499575972557,
-    (TSample)-0.10731834173202515,
-    (TSample)-0.10695776343345642,
-    (TSample)-0.1081109270453453,
-    (TSample)-0.10783383250236511,
-    (TSample)-0.10945866256952286,
-    (TSample)-0.11103134602308273,
-    (TSample)-0.11124593019485474,
-    (TSample)-0.11147525161504745,
-    (TSample)-0.111996129155159,
-    (TSample)-0.11257762461900711,
-    (TSample)-0.11389879882335663,
-    (TSample)-0.11417870223522186,
-    (TSample)-0.1156567707657814,
-    (TSample)-0.11560790985822678,
-    (TSample)-0.11816742271184921,
-    (TSample)-0.11986666172742844,
-    (TSample)-0.12295263260602951,
-    (TSample)-0.1257096230983734,
-    (TSample)-0.12784487009048462,
-    (TSample)-0.12864381074905396,
-    (TSample)-0.1298271119594574,
-    (TSample)-0.1303713023662567,
-    (TSample)-0.12958602607250214,
-    (TSample)-0.13028578460216522,
-    (TSample)-0.1316699981689453,
-    (TSample)-0.13092762231826782,
-    (TSample)-0.1323726922273636,
-    (TSample)-0.1317058652639389,
-    (TSample)-0.13374383747577667,
-    (TSample)-0.1341692954301834,
-    (TSample)-0.13330279290676117,
-    (TSample)-0.13344919681549072,
-    (TSample)-0.13183070719242096,
-    (TSample)-0.1318976879119873,
-    (TSample)-0.13185657560825348,
-    (TSample)-0.13323162496089935,
-    (TSample)-0.13290217518806458,
-    (TSample)-0.1344314068555832,
-    (TSample)-0.13561521470546722,
-    (TSample)-0.1378755420446396,
-    (TSample)-0.1392914205789566,
-    (TSample)-0.14302822947502136,
-    (TSample)-0.1398121863603592,
-    (TSample)-0.14089637994766235,
-    (TSample)-0.13959747552871704,
-    (TSample)-0.14306840300559998,
-    (TSample)-0.14501163363456726,
-    (TSample)-0.1471039354801178,
-    (TSample)-0.1459886133670807,
-    (TSample)-0.14806507527828217,
-    (TSample)-0.14767277240753174,
-    (TSample)-0.1502665877342224,
-    (TSample)-0.149766743183136,
-    (TSample)-0.1486237496137619,
-    (TSample)-0.14691920578479767,
-    (TSample)-0.14738322794437408,
-    (TSample)-0.1463288515806198,
-    (TSample)-0.14895951747894287,
-    (TSample)-0.14783185720443726,
-    (TSample)-0.1502005159854889,
-    (TSample)-0.14901131391525269,
-    (TSample)-0.1513940840959549,
-    (TSample)-0.15099436044692993,
-    (TSample)-0.15559795498847961,
-    (TSample)-0.15627792477607727,
-    (TSample)-0.15887196362018585,
-    (TSample)-0.1578451544046402,
-    (TSample)-0.1592550128698349,
-    (TSample)-0.157365620136261,
-    (TSample)-0.1579235941171646,
-    (TSample)-0.1581801176071167,
-    (TSample)-0.16108813881874084,
-    (TSample)-0.1589304357767105,
-    (TSample)-0.15832316875457764,
-    (TSample)-0.15411964058876038,
-    (TSample)-0.155080184340477,
-    (TSample)-0.15124376118183136,
-    (TSample)-0.15220335125923157,
-    (TSample)-0.15223215520381927,
-    (TSample)-0.15185852348804474,
-    (TSample)-0.15290381014347076,
-    (TSample)-0.1518433839082718,
-    (TSample)-0.14844559133052826,
-    (TSample)-0.147793248295784,
-    (TSample)-0.14306817948818207,
-    (TSample)-0.14455416798591614,
-    (TSample)-0.14240793883800507,
-    (TSample)-0.14495038986206055,
-    (TSample)-0.14415660500526428,
-    (TSample)-0.1452837884426117,
-    (TSample)-0.1447739601135254,
-    (TSample)-0.14580823481082916,
-    (TSample)-0.144361674785614,
-    (TSample)-0.14727267622947693,
-    (TSample)-0.1478012055158615,
-    (TSample)-0.15066982805728912,
-    (TSample)-0.14719825983047485,
-    (TSample)-0.14888520538806915,
-    (TSample)-0.14927400648593903,
-    (TSample)-0.15241728723049164,
-    (TSample)-0.15206290781497955,
-    (TSample)-0.15510563552379608,
-    (TSample)-0.15381209552288055,
-    (TSample)-0.15849918127059937,
-    (TSample)-0.15908882021903992,
-    (TSample)-0.1672419309616089,
-    (TSample)-0.1667497456073761,
-    (TSample)-0.16955870389938354,
-    (TSample)-0.17330555617809296,
-    (TSample)-0.17527282238006592,
-    (TSample)-0.1749834567308426,
-    (TSample)-0.1811438351869583,
-    (TSample)-0.18339763581752777,
-    (TSample)-0.18627391755580902,
-    (TSample)-0.19058048725128174,
-    (TSample)-0.19565770030021667,
-    (TSample)-0.19630540907382965,
-    (TSample)-0.19770881533622742,
-    (TSample)-0.19638951122760773,
-    (TSample)-0.20105044543743134,
-    (TSample)-0.20112714171409607,
-    (TSample)-0.20866866409778595,
-    (TSample)-0.21044409275054932,
-    (TSample)-0.21414388716220856,
-    (TSample)-0.21489842236042023,
-    (TSample)-0.2199772447347641,
-    (TSample)-0.2225860357284546,
-    (TSample)-0.22602145373821259,
-    (TSample)-0.22557222843170166,
-    (TSample)-0.22893096506595612,
-    (TSample)-0.23086069524288177,
-    (TSample)-0.23506203293800354,
-    (TSample)-0.2357613891363144,
-    (TSample)-0.23946110904216766,
-    (TSample)-0.2412387877702713,
-    (TSample)-0.24565714597702026,
-    (TSample)-0.24781343340873718,
-    (TSample)-0.25236231088638306,
-    (TSample)-0.25270307064056396,
-    (TSample)-0.2568438947200775,
-    (TSample)-0.25915220379829407,
-    (TSample)-0.2630951702594757,
-    (TSample)-0.2667573094367981,
-    (TSample)-0.2712041139602661,
-    (TSample)-0.27543601393699646,
-    (TSample)-0.2806479334831238,
-    (TSample)-0.28259679675102234,
-    (TSample)-0.28830575942993164,
-    (TSample)-0.29038166999816895,
-    (TSample)-0.2955043315887451,
-    (TSample)-0.2981780767440796,
-    (TSample)-0.30203112959861755,
-    (TSample)-0.30314087867736816,
-    (TSample)-0.30915743112564087,
-    (TSample)-0.31397855281829834,
-    (TSample)-0.31947606801986694,
-    (TSample)-0.32343795895576477,
-    (TSample)-0.32450008392333984,
-    (TSample)-0.330777645111084,
-    (TSample)-0.33438166975975037,
-    (TSample)-0.338162899017334,
-    (TSample)-0.3418269455432892,
-    (TSample)-0.34451496601104736,
-    (TSample)-0.34707215428352356,
-    (TSample)-0.35268354415893555,
-    (TSample)-0.35500210523605347,
-    (TSample)-0.3573606014251709,
-    (TSample)-0.35788848996162415,
-    (TSample)-0.36085158586502075,
-    (TSample)-0.364170640707016,
-    (TSample)-0.3685257136821747,
-    (TSample)-0.36950913071632385,
-    (TSample)-0.37342727184295654,
-    (TSample)-0.37576422095298767,
-    (TSample)-0.38124316930770874,
-    (TSample)-0.38525888323783875,
-    (TSample)-0.3888086974620819,
-    (TSample)-0.39026525616645813,
-    (TSample)-0.3936375677585602,
-    (TSample)-0.39492613077163696,
-    (TSample)-0.3975064158439636,
-    (TSample)-0.3963993489742279,
-    (TSample)-0.397246390581131,
-    (TSample)-0.39707404375076294,
-    (TSample)-0.40187129378318787,
-    (TSample)-0.40297064185142517,
-    (TSample)-0.40415963530540466,
-    (TSample)-0.4048372209072113,
-    (TSample)-0.40870434045791626,
-    (TSample)-0.4089066982269287,
-    (TSample)-0.413055956363678,
-    (TSample)-0.4154028594493866,
-    (TSample)-0.4188339114189148,
-    (TSample)-0.420019268989563,
-    (TSample)-0.422979474067688,
-    (TSample)-0.4220368564128876,
-    (TSample)-0.4250940978527069,
-    (TSample)-0.4320174753665924,
-    (TSample)-0.4331418573856354,
-    (TSample)-0.43258902430534363,
-    (TSample)-0.43233224749565125,
-    (TSample)-0.4312022030353546,
-    (TSample)-0.4324096143245697,
-    (TSample)-0.43120166659355164,
-    (TSample)-0.4329655170440674,
-    (TSample)-0.43143969774246216,
-    (TSample)-0.4315469563007355,
-    (TSample)-0.4307435154914856,
-    (TSample)-0.43314188718795776,
-    (TSample)-0.42688748240470886,
-    (TSample)-0.42423224449157715,
-    (TSample)-0.4196944832801819,
-    (TSample)-0.4140858054161072,
-    (TSample)-0.40591543912887573,
-    (TSample)-0.3983636796474457,
-    (TSample)-0.38861048221588135,
-    (TSample)-0.380551278591156,
-    (TSample)-0.36975666880607605,
-    (TSample)-0.36045053601264954,
-    (TSample)-0.348029226064682,
-    (TSample)-0.33798909187316895,
-    (TSample)-0.3224082887172699,
-    (TSample)-0.3083302974700928,
-    (TSample)-0.28899961709976196,
-    (TSample)-0.271828293800354,
-    (TSample)-0.25173163414001465,
-    (TSample)-0.23061813414096832,
-    (TSample)-0.20581161975860596,
-    (TSample)-0.18092690408229828,
-    (TSample)-0.1386886090040207,
-    (TSample)-0.08220451325178146
-   };
-};
-   
-
-}
-
-#endif // NEURALWAVE_H_
+/******************************************************************************
+Copyright (c) 2023-2026 Valerio Orlandini
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef NEURALWAVE_H_
+#define NEURALWAVE_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "interp.h"
+#include "utils.h"
+#include "wtosc.h"
+
+#if __cplusplus >= 202002L
+#include<concepts>
+#endif
+
+namespace soutel
+{
+
+// The decoder parameters, stored once in float, the precision they were
+// trained in, and shared by every NeuralWave whatever its sample type. The
+// weights are also kept transposed, one row of 600 values per latent
+// dimension, computed at compile time.
+constexpr std::array<std::array<float, 600>, 8> transpose_weights(const std::array<std::array<float, 8>, 600> &weights)
+{
+    std::array<std::array<float, 600>, 8> columns{};
+
+    for (std::size_t s = 0; s < 600; s++)
+    {
+        for (std::size_t l = 0; l < 8; l++)
+        {
+            columns[l][s] = weights[s][l];
+        }
+    }
+
+    return columns;
+}
+
+class NeuralWeights
+{
+public:
+static constexpr std::array<std::array<float, 8>, 600> weights = {{
+    {0.03722768276929855f, 0.08576939254999161f, -0.11918995529413223f, -0.1025790125131607f, 0.1920522004365921f, 0.17667576670646667f, -0.10470889508724213f, 0.00217429525218904f},
+    {0.0972549170255661f, 0.13069918751716614f, -0.14646492898464203f, -0.15825383365154266f, 0.25371089577674866f, 0.2845610976219177f, -0.18034620583057404f, 0.03562922403216362f},
+    {0.13089443743228912f, 0.15183940529823303f, -0.14255747199058533f, -0.17040781676769257f, 0.2996736466884613f, 0.31931647658348083f, -0.20758499205112457f, 0.051433466374874115f},
+    {0.15546107292175293f, 0.16297124326229095f, -0.14510954916477203f, -0.17339587211608887f, 0.3361959159374237f, 0.3471187651157379f, -0.23174962401390076f, 0.06912849843502045f},
+    {0.1677856594324112f, 0.16933739185333252f, -0.1456346958875656f, -0.1822192519903183f, 0.3609094023704529f, 0.3679724335670471f, -0.2501020133495331f, 0.08899154514074326f},
+    {0.17967332899570465f, 0.17205604910850525f, -0.14901646971702576f, -0.1956704705953598f, 0.3860374391078949f, 0.38922086358070374f, -0.26923617720603943f, 0.10614918172359467f},
+    {0.1914789229631424f, 0.17256872355937958f, -0.14972291886806488f, -0.21287456154823303f, 0.40493258833885193f, 0.4012327790260315f, -0.2837647795677185f, 0.12195420265197754f},
+    {0.2007138580083847f, 0.16877605020999908f, -0.15211543440818787f, -0.2303476333618164f, 0.4285360872745514f, 0.41268250346183777f, -0.30390483140945435f, 0.1357208639383316f},
+    {0.21105632185935974f, 0.17194508016109467f, -0.15091149508953094f, -0.24754062294960022f, 0.4457527697086334f, 0.4248638153076172f, -0.3178124725818634f, 0.157048761844635f},
+    {0.22184741497039795f, 0.16718174517154694f, -0.1522921770811081f, -0.2664519250392914f, 0.4626850187778473f, 0.44211143255233765f, -0.33240506052970886f, 0.1759866625070572f},
+    {0.23178385198116302f, 0.17027465999126434f, -0.14850668609142303f, -0.2870591878890991f, 0.47869375348091125f, 0.45629093050956726f, -0.3455565571784973f, 0.20083333551883698f},
+    {0.23696616291999817f, 0.16570402681827545f, -0.14409583806991577f, -0.3093441128730774f, 0.49260661005973816f, 0.46906745433807373f, -0.3565934896469116f, 0.22035135328769684f},
+    {0.2448788434267044f, 0.16418324410915375f, -0.13616207242012024f, -0.32688412070274353f, 0.5044630169868469f, 0.4792962670326233f, -0.3646964132785797f, 0.24068856239318848f},
+    {0.25128424167633057f, 0.15790186822414398f, -0.13617798686027527f, -0.3546062409877777f, 0.5202478170394897f, 0.4935314357280731f, -0.3772616982460022f, 0.2639445960521698f},
+    {0.25805994868278503f, 0.15488623082637787f, -0.12838713824748993f, -0.3764128088951111f, 0.5280241370201111f, 0.5050625205039978f, -0.385288268327713f, 0.28662818670272827f},
+    {0.2581583857536316f, 0.14868052303791046f, -0.1262192726135254f, -0.4063413739204407f, 0.539858877658844f, 0.5220643281936646f, -0.39562347531318665f, 0.3103013336658478f},
+    {0.2659781575202942f, 0.14761637151241302f, -0.11703971773386002f, -0.4315902590751648f, 0.5444896221160889f, 0.5389629006385803f, -0.40075457096099854f, 0.3389660716056824f},
+    {0.26741740107536316f, 0.13604377210140228f, -0.1122252568602562f, -0.4630647599697113f, 0.5485522150993347f, 0.5509952306747437f, -0.41002804040908813f, 0.36151525378227234f},
+    {0.2728423476219177f, 0.1300976574420929f, -0.10238014161586761f, -0.49103841185569763f, 0.5506608486175537f, 0.560591459274292f, -0.4143100082874298f, 0.38398319482803345f},
+    {0.2789401412010193f, 0.11625171452760696f, -0.09918873757123947f, -0.5230275392532349f, 0.5488016605377197f, 0.5723495483398438f, -0.41879552602767944f, 0.4069932699203491f},
+    {0.2851448655128479f, 0.1110655814409256f, -0.09251870959997177f, -0.5454465746879578f, 0.5480010509490967f, 0.5825434327125549f, -0.42099514603614807f, 0.4316173195838928f},
+    {0.28143733739852905f, 0.09807354211807251f, -0.09055517613887787f, -0.5725618004798889f, 0.5495537519454956f, 0.5918247699737549f, -0.427357017993927f, 0.4474782645702362f},
+    {0.2807825207710266f, 0.09029264748096466f, -0.08563131093978882f, -0.5958317518234253f, 0.5461543202400208f, 0.6001181602478027f, -0.4272419214248657f, 0.4655302166938782f},
+    {0.2757193148136139f, 0.07900624722242355f, -0.08084757626056671f, -0.6254136562347412f, 0.5470272302627563f, 0.6117352843284607f, -0.4287865459918976f, 0.4814930558204651f},
+    {0.27665191888809204f, 0.06970790028572083f, -0.07323900610208511f, -0.642747700214386f, 0.5387697815895081f, 0.614139974117279f, -0.4265926778316498f, 0.498853862285614f},
+    {0.27094411849975586f, 0.05495437979698181f, -0.07262659817934036f, -0.6703249216079712f, 0.5402239561080933f, 0.6231212615966797f, -0.43031957745552063f, 0.5092646479606628f},
+    {0.27100899815559387f, 0.04177384078502655f, -0.06264147907495499f, -0.6888906359672546f, 0.5281728506088257f, 0.6265552639961243f, -0.42779234051704407f, 0.5227465629577637f},
+    {0.263859361410141f, 0.021977467462420464f, -0.05403737351298332f, -0.7162022590637207f, 0.5181882977485657f, 0.6344521045684814f, -0.4277665615081787f, 0.5327007174491882f},
+    {0.258114755153656f, -0.0007743092719465494f, -0.03335604816675186f, -0.7391188740730286f, 0.4917655885219574f, 0.6372618079185486f, -0.42462724447250366f, 0.5421952605247498f},
+    {0.25398391485214233f, -0.01757664419710636f, -0.027140483260154724f, -0.7638333439826965f, 0.48193657398223877f, 0.6448487639427185f, -0.4229181110858917f, 0.5534819960594177f},
+    {0.25023844838142395f, -0.03417978063225746f, -0.01648435927927494f, -0.7815008163452148f, 0.46486717462539673f, 0.6494631171226501f, -0.41486310958862305f, 0.5638054609298706f},
+    {0.23654858767986298f, -0.05562420189380646f, -0.007296427618712187f, -0.807325005531311f, 0.44352808594703674f, 0.6537644267082214f, -0.40964195132255554f, 0.5728587508201599f},
+    {0.22783656418323517f, -0.07612714916467667f, 0.008266065269708633f, -0.8323490023612976f, 0.4200550615787506f, 0.6568822860717773f, -0.4052889049053192f, 0.5794434547424316f},
+    {0.22070331871509552f, -0.09379346668720245f, 0.01336259488016367f, -0.8575727343559265f, 0.4042385220527649f, 0.6631386876106262f, -0.4014759361743927f, 0.5922774076461792f},
+    {0.21302521228790283f, -0.10820511728525162f, 0.02311854064464569f, -0.8757885694503784f, 0.3824121654033661f, 0.6630949378013611f, -0.39246299862861633f, 0.5997169613838196f},
+    {0.2007143795490265f, -0.12519772350788116f, 0.02425766922533512f, -0.8995097875595093f, 0.3658526539802551f, 0.6677739024162292f, -0.38450324535369873f, 0.605384886264801f},
+    {0.1862889677286148f, -0.14225055277347565f, 0.033169958740472794f, -0.9239935874938965f, 0.33944353461265564f, 0.6641716957092285f, -0.371440589427948f, 0.6106776595115662f},
+    {0.16885623335838318f, -0.16607151925563812f, 0.030980553478002548f, -0.9544861316680908f, 0.32409054040908813f, 0.6622780561447144f, -0.3577074408531189f, 0.6082378625869751f},
+    {0.16101229190826416f, -0.18198072910308838f, 0.035252366214990616f, -0.9796109199523926f, 0.2973020374774933f, 0.6553195118904114f, -0.3426322340965271f, 0.6181649565696716f},
+    {0.1419297605752945f, -0.19340963661670685f, 0.0318075530230999f, -1.0060375928878784f, 0.28402307629585266f, 0.6614506840705872f, -0.3324960470199585f, 0.6214855909347534f},
+    {0.1332951933145523f, -0.2032729536294937f, 0.03505108505487442f, -1.0176695585250854f, 0.263765424489975f, 0.6586663126945496f, -0.3189895451068878f, 0.6268631815910339f},
+    {0.11687712371349335f, -0.22126737236976624f, 0.03610939532518387f, -1.0391218662261963f, 0.24412845075130463f, 0.6623427867889404f, -0.3083907663822174f, 0.6283758282661438f},
+    {0.10640846192836761f, -0.23453101515769958f, 0.0421675480902195f, -1.0529369115829468f, 0.2212752103805542f, 0.656545102596283f, -0.29402339458465576f, 0.630828320980072f},
+    {0.06539793312549591f, -0.2648317813873291f, 0.030009053647518158f, -1.0948143005371094f, 0.20965078473091125f, 0.6482009887695312f, -0.28112316131591797f, 0.6146546602249146f},
+    {0.044273290783166885f, -0.27950918674468994f, 0.03738660737872124f, -1.113057017326355f, 0.18187816441059113f, 0.6422893404960632f, -0.2635560631752014f, 0.6120418310165405f},
+    {0.025055041536688805f, -0.2940157651901245f, 0.0384981669485569f, -1.1299283504486084f, 0.1596231758594513f, 0.6413761973381042f, -0.25007161498069763f, 0.613231897354126f},
+    {0.005417820066213608f, -0.3043511211872101f, 0.053394559770822525f, -1.141844630241394f, 0.1338893622159958f, 0.6372746825218201f, -0.23097379505634308f, 0.6166214942932129f},
+    {-0.011830595321953297f, -0.323337584733963f, 0.051503896713256836f, -1.1610451936721802f, 0.11207153648138046f, 0.6365723013877869f, -0.2148606926202774f, 0.615134060382843f},
+    {-0.02560599334537983f, -0.3348281979560852f, 0.05672186613082886f, -1.1704519987106323f, 0.08606941998004913f, 0.6310898065567017f, -0.19603285193443298f, 0.6154550313949585f},
+    {-0.04601842910051346f, -0.3479980528354645f, 0.057812295854091644f, -1.185126543045044f, 0.06482161581516266f, 0.6250081062316895f, -0.17988255620002747f, 0.6128674745559692f},
+    {-0.0610409751534462f, -0.3592980206012726f, 0.061535075306892395f, -1.195637822151184f, 0.038246702402830124f, 0.619910478591919f, -0.161950945854187f, 0.6131067872047424f},
+    {-0.08041109144687653f, -0.3731135427951813f, 0.06295276433229446f, -1.2112574577331543f, 0.022276485338807106f, 0.6166912913322449f, -0.15063787996768951f, 0.6102409362792969f},
+    {-0.09211835265159607f, -0.38367223739624023f, 0.06812626123428345f, -1.2152689695358276f, -0.005178290419280529f, 0.6085243821144104f, -0.12850311398506165f, 0.607134997844696f},
+    {-0.10990971326828003f, -0.3952421247959137f, 0.06500502675771713f, -1.2254443168640137f, -0.0210881344974041f, 0.6045557856559753f, -0.1124584749341011f, 0.6015327572822571f},
+    {-0.11515061557292938f, -0.3867337107658386f, 0.06183699518442154f, -1.222203254699707f, -0.04170079156756401f, 0.6063485741615295f, -0.08224202692508698f, 0.606452465057373f},
+    {-0.13820436596870422f, -0.3952423334121704f, 0.05089644715189934f, -1.2316231727600098f, -0.05835868418216705f, 0.6109314560890198f, -0.06569627672433853f, 0.5985387563705444f},
+    {-0.15629437565803528f, -0.4031009078025818f, 0.06386788189411163f, -1.2400168180465698f, -0.09103857725858688f, 0.6024961471557617f, -0.03230931982398033f, 0.5956767797470093f},
+    {-0.17711438238620758f, -0.41266170144081116f, 0.0630728080868721f, -1.2518197298049927f, -0.1093233972787857f, 0.5997630953788757f, -0.00903342105448246f, 0.5909678339958191f},
+    {-0.1918606460094452f, -0.4093517065048218f, 0.058762259781360626f, -1.2525969743728638f, -0.11777282506227493f, 0.590539276599884f, 0.007359977811574936f, 0.5871230959892273f},
+    {-0.21406660974025726f, -0.4185243844985962f, 0.050789136439561844f, -1.2602487802505493f, -0.134993314743042f, 0.5875964164733887f, 0.02472943812608719f, 0.5788639783859253f},
+    {-0.2312774807214737f, -0.41948679089546204f, 0.04902444779872894f, -1.2548941373825073f, -0.1601991206407547f, 0.5810341835021973f, 0.046037428081035614f, 0.5747036933898926f},
+    {-0.2552816867828369f, -0.4330155551433563f, 0.03678848221898079f, -1.2646013498306274f, -0.1772729754447937f, 0.57423335313797f, 0.061894871294498444f, 0.5596768260002136f},
+    {-0.2744672894477844f, -0.43371862173080444f, 0.03907603397965431f, -1.2614552974700928f, -0.19823262095451355f, 0.5676767230033875f, 0.08561104536056519f, 0.5565112233161926f},
+    {-0.30450478196144104f, -0.43729889392852783f, 0.03386339917778969f, -1.2672232389450073f, -0.22145844995975494f, 0.5634428858757019f, 0.10902415961027145f, 0.5520298480987549f},
+    {-0.3245229423046112f, -0.43625423312187195f, 0.03350210189819336f, -1.2625888586044312f, -0.2476319968700409f, 0.554530680179596f, 0.13449420034885406f, 0.5500360727310181f},
+    {-0.35150954127311707f, -0.4435702860355377f, 0.029144132509827614f, -1.2611525058746338f, -0.26423120498657227f, 0.547516942024231f, 0.15506671369075775f, 0.5354623198509216f},
+    {-0.37222450971603394f, -0.44317302107810974f, 0.03105725534260273f, -1.2535477876663208f, -0.282967209815979f, 0.5359013676643372f, 0.17893829941749573f, 0.5279161334037781f},
+    {-0.39762064814567566f, -0.4516899585723877f, 0.02415144443511963f, -1.2512325048446655f, -0.30138668417930603f, 0.5288084745407104f, 0.2012912929058075f, 0.5178960561752319f},
+    {-0.42326804995536804f, -0.44485506415367126f, 0.03512182831764221f, -1.248508334159851f, -0.3216826021671295f, 0.5200753211975098f, 0.23425006866455078f, 0.5122400522232056f},
+    {-0.4483073651790619f, -0.44419535994529724f, 0.030031152069568634f, -1.251494288444519f, -0.3325566053390503f, 0.5158873200416565f, 0.2518700361251831f, 0.5036128163337708f},
+    {-0.4666022062301636f, -0.44045335054397583f, 0.032553765922784805f, -1.2454991340637207f, -0.3470340073108673f, 0.5051826238632202f, 0.2781904637813568f, 0.4966764450073242f},
+    {-0.4877375066280365f, -0.4402850866317749f, 0.017899423837661743f, -1.2457020282745361f, -0.3547830283641815f, 0.4996558129787445f, 0.2934688329696655f, 0.48385876417160034f},
+    {-0.511702299118042f, -0.42992502450942993f, 0.019036324694752693f, -1.2471553087234497f, -0.3701929450035095f, 0.48151180148124695f, 0.32728302478790283f, 0.4700562655925751f},
+    {-0.5358154773712158f, -0.41982895135879517f, 0.013211367651820183f, -1.2481845617294312f, -0.3782995045185089f, 0.4741520285606384f, 0.34770694375038147f, 0.4635451138019562f},
+    {-0.5508944988250732f, -0.4126957654953003f, -0.0029087672010064125f, -1.2305796146392822f, -0.3891105055809021f, 0.46411141753196716f, 0.37101680040359497f, 0.45735567808151245f},
+    {-0.5787780284881592f, -0.406935453414917f, -0.03535637632012367f, -1.219253420829773f, -0.391257107257843f, 0.4494580924510956f, 0.38489338755607605f, 0.4455462396144867f},
+    {-0.6034987568855286f, -0.3940974473953247f, -0.06115809082984924f, -1.2050107717514038f, -0.40100568532943726f, 0.43315577507019043f, 0.4084048867225647f, 0.42703181505203247f},
+    {-0.6283010244369507f, -0.3867126405239105f, -0.07838500291109085f, -1.203813910484314f, -0.40469789505004883f, 0.4246070683002472f, 0.4264184832572937f, 0.40854257345199585f},
+    {-0.6430942416191101f, -0.3775133192539215f, -0.08286076039075851f, -1.1957948207855225f, -0.4196094870567322f, 0.41439539194107056f, 0.4502505958080292f, 0.4018993675708771f},
+    {-0.6704401969909668f, -0.3667328655719757f, -0.09953410923480988f, -1.1927727460861206f, -0.4240034520626068f, 0.4141538143157959f, 0.4735962152481079f, 0.3829365670681f},
+    {-0.6907563209533691f, -0.3540031909942627f, -0.10820428282022476f, -1.1781114339828491f, -0.43816253542900085f, 0.4079924523830414f, 0.49972277879714966f, 0.36999213695526123f},
+    {-0.7162814736366272f, -0.3498441278934479f, -0.1272033154964447f, -1.1765813827514648f, -0.4418623149394989f, 0.3999828100204468f, 0.5152624845504761f, 0.35400357842445374f},
+    {-0.7352254390716553f, -0.3461502492427826f, -0.13534577190876007f, -1.1722184419631958f, -0.44954681396484375f, 0.380756676197052f, 0.5260793566703796f, 0.3345234990119934f},
+    {-0.7506081461906433f, -0.33358776569366455f, -0.15357179939746857f, -1.1667931079864502f, -0.4582972228527069f, 0.38141098618507385f, 0.549375593662262f, 0.3156764805316925f},
+    {-0.7623371481895447f, -0.32059183716773987f, -0.16706515848636627f, -1.156356692314148f, -0.4717763066291809f, 0.3746434450149536f, 0.5651869177818298f, 0.3028176426887512f},
+    {-0.7809484004974365f, -0.3087005913257599f, -0.1856299340724945f, -1.1560100317001343f, -0.4789547920227051f, 0.37160724401474f, 0.5799965858459473f, 0.288152813911438f},
+    {-0.788956344127655f, -0.2886681854724884f, -0.20119427144527435f, -1.1398792266845703f, -0.48674505949020386f, 0.36605963110923767f, 0.6028032898902893f, 0.27560296654701233f},
+    {-0.8035144209861755f, -0.2670031189918518f, -0.22297044098377228f, -1.1277402639389038f, -0.4877549707889557f, 0.36363962292671204f, 0.6176655292510986f, 0.2666007876396179f},
+    {-0.8166748881340027f, -0.24719731509685516f, -0.2411797195672989f, -1.1133100986480713f, -0.4932938516139984f, 0.3540765941143036f, 0.6305520534515381f, 0.2599070966243744f},
+    {-0.8385254740715027f, -0.23515143990516663f, -0.266116738319397f, -1.1048338413238525f, -0.48842278122901917f, 0.3479052186012268f, 0.6378009915351868f, 0.2447986602783203f},
+    {-0.8503437042236328f, -0.21726156771183014f, -0.27869096398353577f, -1.0927956104278564f, -0.4964560568332672f, 0.33765915036201477f, 0.6614519357681274f, 0.2309918999671936f},
+    {-0.8680289387702942f, -0.1999778151512146f, -0.29888179898262024f, -1.0877504348754883f, -0.4925752282142639f, 0.3260335624217987f, 0.6751288175582886f, 0.21471568942070007f},
+    {-0.8824631571769714f, -0.18651838600635529f, -0.32356250286102295f, -1.0728281736373901f, -0.4917936325073242f, 0.32328617572784424f, 0.6869760751724243f, 0.19753487408161163f},
+    {-0.9054543972015381f, -0.1756826490163803f, -0.357400119304657f, -1.0733672380447388f, -0.4844416677951813f, 0.31590843200683594f, 0.6975316405296326f, 0.17092210054397583f},
+    {-0.9162653684616089f, -0.14996938407421112f, -0.3787086009979248f, -1.0561414957046509f, -0.4873177409172058f, 0.30528828501701355f, 0.7113054990768433f, 0.1611558496952057f},
+    {-0.9320928454399109f, -0.12855251133441925f, -0.4139630198478699f, -1.0463448762893677f, -0.4784524738788605f, 0.29930421710014343f, 0.7189985513687134f, 0.14615125954151154f},
+    {-0.9383507370948792f, -0.10311300307512283f, -0.43860065937042236f, -1.0266132354736328f, -0.48143285512924194f, 0.2952536344528198f, 0.7349682450294495f, 0.13696525990962982f},
+    {-0.9530535340309143f, -0.08504384756088257f, -0.4645932912826538f, -1.0222841501235962f, -0.4791855216026306f, 0.29136696457862854f, 0.7520619034767151f, 0.11983446776866913f},
+    {-0.9607841372489929f, -0.06026512384414673f, -0.4772845506668091f, -1.0066628456115723f, -0.4843149483203888f, 0.28774121403694153f, 0.7646082043647766f, 0.1133558377623558f},
+    {-0.9688698053359985f, -0.0399937778711319f, -0.5060282349586487f, -0.9931144118309021f, -0.4718201458454132f, 0.2786323130130768f, 0.7793838381767273f, 0.10744761675596237f},
+    {-0.9943961501121521f, -0.015996480360627174f, -0.5486413240432739f, -0.9914821982383728f, -0.4459502398967743f, 0.2672072649002075f, 0.7887229919433594f, 0.07189176231622696f},
+    {-1.0023071765899658f, -0.0007373729022219777f, -0.5741376876831055f, -0.9791314005851746f, -0.4401194155216217f, 0.2653931677341461f, 0.7929301261901855f, 0.05716800317168236f},
+    {-1.0126290321350098f, 0.022519776597619057f, -0.5937225818634033f, -0.9670047760009766f, -0.43586692214012146f, 0.2664474546909332f, 0.8068057894706726f, 0.044540129601955414f},
+    {-1.021078109741211f, 0.04137924313545227f, -0.6138026714324951f, -0.9569726586341858f, -0.43239203095436096f, 0.2682531476020813f, 0.8130117654800415f, 0.03465552628040314f},
+    {-1.0290030241012573f, 0.06648091971874237f, -0.6314289569854736f, -0.9384577870368958f, -0.4249653220176697f, 0.2697593867778778f, 0.8136815428733826f, 0.027202608063817024f},
+    {-1.0399867296218872f, 0.08517251908779144f, -0.6530010104179382f, -0.9279736280441284f, -0.41510704159736633f, 0.2689940333366394f, 0.82057124376297f, 0.00801972858607769f},
+    {-1.0453675985336304f, 0.10453597456216812f, -0.6668663620948792f, -0.9102023243904114f, -0.41540759801864624f, 0.2684658467769623f, 0.8273914456367493f, 0.00036757878842763603f},
+    {-1.0437613725662231f, 0.13861629366874695f, -0.6872326731681824f, -0.8932904601097107f, -0.40839388966560364f, 0.27371346950531006f, 0.8390640616416931f, -0.001999368891119957f},
+    {-1.042535424232483f, 0.16019316017627716f, -0.7029457688331604f, -0.8729848265647888f, -0.4022520184516907f, 0.2723332941532135f, 0.8383750319480896f, -0.004324411042034626f},
+    {-1.049134612083435f, 0.1790362000465393f, -0.7244904041290283f, -0.8577753901481628f, -0.3918730914592743f, 0.2686278223991394f, 0.838660717010498f, -0.01726273074746132f},
+    {-1.0406335592269897f, 0.20840148627758026f, -0.7474652528762817f, -0.8331089019775391f, -0.3902151882648468f, 0.2767137289047241f, 0.842542827129364f, -0.01724429614841938f},
+    {-1.0362269878387451f, 0.2308877557516098f, -0.7702065706253052f, -0.8135775923728943f, -0.3805364668369293f, 0.27792486548423767f, 0.8390768766403198f, -0.022624969482421875f},
+    {-1.0311942100524902f, 0.25642451643943787f, -0.7848343849182129f, -0.7929328083992004f, -0.3690203130245209f, 0.2726901173591614f, 0.8286216259002686f, -0.023919101804494858f},
+    {-1.0191398859024048f, 0.28968939185142517f, -0.8068670630455017f, -0.7698177695274353f, -0.3503566086292267f, 0.2684131860733032f, 0.817875862121582f, -0.027738207951188087f},
+    {-1.0165494680404663f, 0.3190118670463562f, -0.8312823176383972f, -0.7544839382171631f, -0.33466237783432007f, 0.26253411173820496f, 0.8143517971038818f, -0.0407291054725647f},
+    {-1.0090411901474f, 0.34462305903434753f, -0.8526413440704346f, -0.737805962562561f, -0.32299938797950745f, 0.2620203197002411f, 0.8123136162757874f, -0.044527485966682434f},
+    {-1.0043480396270752f, 0.3674425184726715f, -0.8796398043632507f, -0.7261889576911926f, -0.30916041135787964f, 0.25630632042884827f, 0.8081929683685303f, -0.055160194635391235f},
+    {-0.9971083998680115f, 0.39372557401657104f, -0.9055824279785156f, -0.7154598832130432f, -0.2960060238838196f, 0.24924318492412567f, 0.8034451007843018f, -0.06357000023126602f},
+    {-0.9905416965484619f, 0.41923874616622925f, -0.9176761507987976f, -0.7000995874404907f, -0.29057776927948f, 0.24919423460960388f, 0.798416256904602f, -0.05771619454026222f},
+    {-0.9831255674362183f, 0.44663217663764954f, -0.9384636282920837f, -0.6869600415229797f, -0.27873489260673523f, 0.24305188655853271f, 0.7923693656921387f, -0.06145044043660164f},
+    {-0.9704455137252808f, 0.4711458086967468f, -0.9620858430862427f, -0.6707777380943298f, -0.27096307277679443f, 0.24152374267578125f, 0.7809037566184998f, -0.061115968972444534f},
+    {-0.9594600796699524f, 0.4911908507347107f, -0.9887144565582275f, -0.6529413461685181f, -0.2593391537666321f, 0.2405870258808136f, 0.7759822010993958f, -0.0665816143155098f},
+    {-0.9439464807510376f, 0.5131272673606873f, -1.0049136877059937f, -0.632461428642273f, -0.25444772839546204f, 0.23789379000663757f, 0.7663901448249817f, -0.059444062411785126f},
+    {-0.9300326704978943f, 0.5433030724525452f, -1.0336475372314453f, -0.6161623597145081f, -0.24079325795173645f, 0.2396877259016037f, 0.7598159313201904f, -0.0610438734292984f},
+    {-0.9198710918426514f, 0.570784866809845f, -1.0531328916549683f, -0.6006017923355103f, -0.23170976340770721f, 0.23597301542758942f, 0.7507544159889221f, -0.061841659247875214f},
+    {-0.910785973072052f, 0.5970878601074219f, -1.075360894203186f, -0.5868452191352844f, -0.2178373634815216f, 0.23381774127483368f, 0.744076669216156f, -0.06750209629535675f},
+    {-0.8978079557418823f, 0.6170775294303894f, -1.091691255569458f, -0.5719087719917297f, -0.20657330751419067f, 0.23508009314537048f, 0.7333949208259583f, -0.063510961830616f},
+    {-0.8900688886642456f, 0.6369425058364868f, -1.1092783212661743f, -0.5605000257492065f, -0.19283458590507507f, 0.23348568379878998f, 0.7311038374900818f, -0.0678117647767067f},
+    {-0.8788347840309143f, 0.6546816825866699f, -1.1222580671310425f, -0.5477848052978516f, -0.1890927106142044f, 0.23327812552452087f, 0.7203986048698425f, -0.0643109679222107f},
+    {-0.8694089651107788f, 0.6703903079032898f, -1.151092767715454f, -0.5349651575088501f, -0.1748061329126358f, 0.22584548592567444f, 0.7091071605682373f, -0.06667786091566086f},
+    {-0.8572149276733398f, 0.6867033839225769f, -1.1675570011138916f, -0.5228853821754456f, -0.16870945692062378f, 0.22250407934188843f, 0.6953645348548889f, -0.06374277174472809f},
+    {-0.8453888893127441f, 0.7065454721450806f, -1.1948503255844116f, -0.5071737170219421f, -0.1591988056898117f, 0.21261635422706604f, 0.6795013546943665f, -0.061524029821157455f},
+    {-0.8326618075370789f, 0.7297658324241638f, -1.2145003080368042f, -0.48787614703178406f, -0.15307006239891052f, 0.20439596474170685f, 0.6556093096733093f, -0.051133133471012115f},
+    {-0.8208717107772827f, 0.7451211214065552f, -1.2345912456512451f, -0.473672091960907f, -0.14163091778755188f, 0.19850175082683563f, 0.640947699546814f, -0.05821061134338379f},
+    {-0.8081892132759094f, 0.7580798268318176f, -1.2473340034484863f, -0.4635555148124695f, -0.140059694647789f, 0.1962776482105255f, 0.6254367828369141f, -0.055520690977573395f},
+    {-0.8013458847999573f, 0.7749575972557068f, -1.2586427927017212f, -0.4606873691082001f, -0.12902256846427917f, 0.18499411642551422f, 0.6122084259986877f, -0.06277985870838165f},
+    {-0.7864487171173096f, 0.7836278080940247f, -1.2771881818771362f, -0.4490738809108734f, -0.12517544627189636f, 0.1747906357049942f, 0.5862456560134888f, -0.05658873915672302f},
+    {-0.767401397228241f, 0.7978171706199646f, -1.2925184965133667f, -0.44025343656539917f, -0.12176018208265305f, 0.16941481828689575f, 0.5642200708389282f, -0.05237162485718727f},
+    {-0.7524996399879456f, 0.8124901652336121f, -1.307297945022583f, -0.42742523550987244f, -0.11922411620616913f, 0.16872453689575195f, 0.540915310382843f, -0.04202691465616226f},
+    {-0.7330335974693298f, 0.8213121294975281f, -1.3205153942108154f, -0.42243245244026184f, -0.11324834823608398f, 0.16261538863182068f, 0.5149064660072327f, -0.04437384381890297f},
+    {-0.7090383768081665f, 0.8266876935958862f, -1.3376522064208984f, -0.40982526540756226f, -0.10967499762773514f, 0.16365943849086761f, 0.4879148006439209f, -0.040843330323696136f},
+    {-0.6941297650337219f, 0.8297657370567322f, -1.3520336151123047f, -0.40274977684020996f, -0.10552111268043518f, 0.1571832150220871f, 0.4662874937057495f, -0.04359821230173111f},
+    {-0.6800395846366882f, 0.8465524315834045f, -1.362237572669983f, -0.3937894403934479f, -0.09636881202459335f, 0.15166155993938446f, 0.4451589286327362f, -0.038160379976034164f},
+    {-0.6650757789611816f, 0.8499029874801636f, -1.3773423433303833f, -0.3905123770236969f, -0.09306517243385315f, 0.14380387961864471f, 0.4244486093521118f, -0.039362501353025436f},
+    {-0.6445392966270447f, 0.8542067408561707f, -1.3856024742126465f, -0.3866710662841797f, -0.09445469081401825f, 0.13828760385513306f, 0.4040312170982361f, -0.03670785576105118f},
+    {-0.6282218098640442f, 0.8554527759552002f, -1.3959447145462036f, -0.3830977976322174f, -0.08921020478010178f, 0.1277691125869751f, 0.3856058716773987f, -0.04099535197019577f},
+    {-0.6078499555587769f, 0.8624602556228638f, -1.4059820175170898f, -0.3797161877155304f, -0.08192219585180283f, 0.11149276047945023f, 0.36392727494239807f, -0.04070951044559479f},
+    {-0.5925489068031311f, 0.8621026873588562f, -1.4200541973114014f, -0.3685578405857086f, -0.07502756267786026f, 0.09930697828531265f, 0.33742406964302063f, -0.04068794474005699f},
+    {-0.5671801567077637f, 0.8675862550735474f, -1.427237629890442f, -0.37211230397224426f, -0.06571801006793976f, 0.08387158811092377f, 0.30412110686302185f, -0.03259441256523132f},
+    {-0.544828474521637f, 0.8772177696228027f, -1.4485148191452026f, -0.37606924772262573f, -0.056201495230197906f, 0.05879686772823334f, 0.26816701889038086f, -0.031807154417037964f},
+    {-0.4867449998855591f, 0.8892163038253784f, -1.4763598442077637f, -0.37755268812179565f, -0.045526809990406036f, 0.0009668858256191015f, 0.17697079479694366f, -0.03171144798398018f},
+    {-0.4612632691860199f, 0.8897409439086914f, -1.497183084487915f, -0.3797198534011841f, -0.023344483226537704f, -0.026648184284567833f, 0.1372605264186859f, -0.0337691456079483f},
+    {-0.4396291971206665f, 0.8860441446304321f, -1.5031489133834839f, -0.36859583854675293f, -0.028047626838088036f, -0.03870612755417824f, 0.11033478379249573f, -0.02962796948850155f},
+    {-0.4280265271663666f, 0.8795345425605774f, -1.5138537883758545f, -0.36579546332359314f, -0.021573957055807114f, -0.05994277447462082f, 0.07924839109182358f, -0.03694678097963333f},
+    {-0.4088708460330963f, 0.8779052495956421f, -1.5146713256835938f, -0.3682839274406433f, -0.017878849059343338f, -0.07227092981338501f, 0.05080850422382355f, -0.037289850413799286f},
+    {-0.39304104447364807f, 0.8688115477561951f, -1.5186986923217773f, -0.3705058991909027f, -0.015099750831723213f, -0.08833176642656326f, 0.026306767016649246f, -0.043685462325811386f},
+    {-0.3743433952331543f, 0.8660032749176025f, -1.5221978425979614f, -0.36859819293022156f, -0.01737982966005802f, -0.10232853144407272f, -0.0015884794993326068f, -0.03935941308736801f},
+    {-0.3501710295677185f, 0.8614689111709595f, -1.529524564743042f, -0.37715157866477966f, -0.015533172525465488f, -0.129430890083313f, -0.032428521662950516f, -0.04593343660235405f},
+    {-0.33289769291877747f, 0.858235239982605f, -1.5296709537506104f, -0.3772496283054352f, -0.021833086386322975f, -0.14256809651851654f, -0.06107185781002045f, -0.047092504799366f},
+    {-0.32342612743377686f, 0.8529979586601257f, -1.5341005325317383f, -0.38033393025398254f, -0.022939074784517288f, -0.15887326002120972f, -0.08748657256364822f, -0.05300796031951904f},
+    {-0.30712419748306274f, 0.8399912714958191f, -1.5329290628433228f, -0.37846899032592773f, -0.03474288806319237f, -0.1700277030467987f, -0.11857559531927109f, -0.052597884088754654f},
+    {-0.29459643363952637f, 0.8321632146835327f, -1.5326236486434937f, -0.38204389810562134f, -0.04176977276802063f, -0.17344027757644653f, -0.14833982288837433f, -0.056883253157138824f},
+    {-0.28185805678367615f, 0.8244718909263611f, -1.5285001993179321f, -0.3818710744380951f, -0.0499354787170887f, -0.18154309689998627f, -0.1779477298259735f, -0.06108536571264267f},
+    {-0.2721133530139923f, 0.8138874173164368f, -1.524221658706665f, -0.38933125138282776f, -0.052161525934934616f, -0.1929135024547577f, -0.20738589763641357f, -0.06664213538169861f},
+    {-0.2581935524940491f, 0.8035352826118469f, -1.5170881748199463f, -0.38660046458244324f, -0.06785892695188522f, -0.19926179945468903f, -0.22946859896183014f, -0.06453189253807068f},
+    {-0.251267671585083f, 0.793985903263092f, -1.5101697444915771f, -0.3913072943687439f, -0.06230473890900612f, -0.217937171459198f, -0.26744869351387024f, -0.06531413644552231f},
+    {-0.24176211655139923f, 0.7813085317611694f, -1.5044174194335938f, -0.3870070278644562f, -0.07286205887794495f, -0.22977976500988007f, -0.29545125365257263f, -0.06719071418046951f},
+    {-0.2296186089515686f, 0.7644115686416626f, -1.5061973333358765f, -0.3875875771045685f, -0.07703595608472824f, -0.23698396980762482f, -0.32474657893180847f, -0.07790541648864746f},
+    {-0.20610015094280243f, 0.7567868232727051f, -1.5006625652313232f, -0.38765907287597656f, -0.07728616148233414f, -0.25880882143974304f, -0.3552563786506653f, -0.07819284498691559f},
+    {-0.18998241424560547f, 0.7358056902885437f, -1.495422601699829f, -0.3978525996208191f, -0.08109468966722488f, -0.27684441208839417f, -0.39192622900009155f, -0.0826895609498024f},
+    {-0.16948984563350677f, 0.7145149111747742f, -1.4880529642105103f, -0.4008964002132416f, -0.08909068256616592f, -0.30215343832969666f, -0.42523762583732605f, -0.08693012595176697f},
+    {-0.15611405670642853f, 0.696911096572876f, -1.4886596202850342f, -0.4002878963947296f, -0.09525278955698013f, -0.31114462018013f, -0.449566125869751f, -0.09447141736745834f},
+    {-0.1440349668264389f, 0.6823813915252686f, -1.4782440662384033f, -0.3993932902812958f, -0.10745903104543686f, -0.32079190015792847f, -0.47127866744995117f, -0.10375987738370895f},
+    {-0.13762101531028748f, 0.656275749206543f, -1.4724010229110718f, -0.40875938534736633f, -0.12011881172657013f, -0.3284130096435547f, -0.5020576119422913f, -0.11272647976875305f},
+    {-0.11928561329841614f, 0.6304938197135925f, -1.458254337310791f, -0.40349483489990234f, -0.14816679060459137f, -0.3355288803577423f, -0.5359315276145935f, -0.10884594917297363f},
+    {-0.12076351046562195f, 0.6069595813751221f, -1.4450138807296753f, -0.4022257924079895f, -0.1594463735818863f, -0.3524596095085144f, -0.5688859820365906f, -0.11961732059717178f},
+    {-0.11923839896917343f, 0.5732847452163696f, -1.4360095262527466f, -0.4064415395259857f, -0.16963256895542145f, -0.378076434135437f, -0.5994014739990234f, -0.14716248214244843f},
+    {-0.11126910895109177f, 0.554054856300354f, -1.423869252204895f, -0.41353878378868103f, -0.1869380921125412f, -0.3889522850513458f, -0.629112184047699f, -0.16537339985370636f},
+    {-0.09944973140954971f, 0.5382864475250244f, -1.411216139793396f, -0.4099332094192505f, -0.20432442426681519f, -0.4006675183773041f, -0.6502147316932678f, -0.1714082807302475f},
+    {-0.09344650059938431f, 0.5220898985862732f, -1.404129981994629f, -0.40784600377082825f, -0.21406331658363342f, -0.4078458249568939f, -0.6724077463150024f, -0.17963339388370514f},
+    {-0.08340861648321152f, 0.5088905096054077f, -1.3874415159225464f, -0.4042387902736664f, -0.22955858707427979f, -0.4170910120010376f, -0.6954156756401062f, -0.18340946733951569f},
+    {-0.08427213877439499f, 0.4925520122051239f, -1.3780146837234497f, -0.4092544615268707f, -0.23495501279830933f, -0.42027318477630615f, -0.7188441753387451f, -0.1929158717393875f},
+    {-0.07945407927036285f, 0.47323372960090637f, -1.359142541885376f, -0.41026756167411804f, -0.2505912184715271f, -0.4289443790912628f, -0.741513729095459f, -0.1957433968782425f},
+    {-0.06857424229383469f, 0.46216368675231934f, -1.3500564098358154f, -0.41606125235557556f, -0.26798737049102783f, -0.4234573245048523f, -0.764385998249054f, -0.18900960683822632f},
+    {-0.0586799681186676f, 0.4453248679637909f, -1.3369981050491333f, -0.4158233404159546f, -0.28575509786605835f, -0.4308736324310303f, -0.7868795394897461f, -0.1927381306886673f},
+    {-0.057403381913900375f, 0.4227440655231476f, -1.3290449380874634f, -0.422651469707489f, -0.2955218553543091f, -0.4363759160041809f, -0.8111776113510132f, -0.20455394685268402f},
+    {-0.0550067238509655f, 0.4000428020954132f, -1.308741569519043f, -0.42669177055358887f, -0.311387300491333f, -0.4420304596424103f, -0.8351722955703735f, -0.21038366854190826f},
+    {-0.05789797380566597f, 0.3821428716182709f, -1.2921968698501587f, -0.4299619495868683f, -0.31839290261268616f, -0.4339148700237274f, -0.8728106021881104f, -0.21574755012989044f},
+    {-0.051339663565158844f, 0.3678677976131439f, -1.2748152017593384f, -0.43128326535224915f, -0.32936224341392517f, -0.43890008330345154f, -0.8923842310905457f, -0.22301387786865234f},
+    {-0.05980174243450165f, 0.34416526556015015f, -1.2613675594329834f, -0.4385989010334015f, -0.33174559473991394f, -0.4424101710319519f, -0.9135324954986572f, -0.24022270739078522f},
+    {-0.06323986500501633f, 0.33379170298576355f, -1.243965744972229f, -0.44029712677001953f, -0.3382071554660797f, -0.4409715235233307f, -0.9314894676208496f, -0.25445714592933655f},
+    {-0.06565830111503601f, 0.31273290514945984f, -1.2351715564727783f, -0.4429764151573181f, -0.3501431345939636f, -0.4362063407897949f, -0.9518994092941284f, -0.2677592933177948f},
+    {-0.060453690588474274f, 0.28362393379211426f, -1.2204854488372803f, -0.44894906878471375f, -0.3651389181613922f, -0.451199471950531f, -0.9806361794471741f, -0.2869327962398529f},
+    {-0.058093391358852386f, 0.262908399105072f, -1.1964471340179443f, -0.4549253582954407f, -0.39008650183677673f, -0.45456793904304504f, -1.0091373920440674f, -0.2896054983139038f},
+    {-0.05322130396962166f, 0.2469651997089386f, -1.1762027740478516f, -0.4595472514629364f, -0.4073285758495331f, -0.4576609134674072f, -1.0325038433074951f, -0.29581302404403687f},
+    {-0.05482823774218559f, 0.22348652780056f, -1.1658419370651245f, -0.4718974530696869f, -0.42333081364631653f, -0.46026939153671265f, -1.0614930391311646f, -0.3068380653858185f},
+    {-0.05907805636525154f, 0.20578067004680634f, -1.1440088748931885f, -0.4771571457386017f, -0.4493931829929352f, -0.46066978573799133f, -1.0841987133026123f, -0.31366270780563354f},
+    {-0.0692702978849411f, 0.1718859225511551f, -1.1249322891235352f, -0.48681744933128357f, -0.4659661054611206f, -0.4686853587627411f, -1.1134958267211914f, -0.334915429353714f},
+    {-0.07105427980422974f, 0.15268228948116302f, -1.1053680181503296f, -0.48343366384506226f, -0.48319777846336365f, -0.46953755617141724f, -1.1290242671966553f, -0.34395989775657654f},
+    {-0.07876714318990707f, 0.13413958251476288f, -1.092598795890808f, -0.48661357164382935f, -0.49346745014190674f, -0.4633989930152893f, -1.1507307291030884f, -0.35870811343193054f},
+    {-0.08295052498579025f, 0.11982540041208267f, -1.0696847438812256f, -0.48860839009284973f, -0.5064811706542969f, -0.4549049139022827f, -1.1709741353988647f, -0.374801367521286f},
+    {-0.09252768754959106f, 0.09924879670143127f, -1.05479896068573f, -0.49715542793273926f, -0.5145636200904846f, -0.4520185589790344f, -1.1860980987548828f, -0.39606279134750366f},
+    {-0.1026894822716713f, 0.07676862180233002f, -1.0263254642486572f, -0.49648383259773254f, -0.5324512720108032f, -0.45816105604171753f, -1.2064814567565918f, -0.4152738153934479f},
+    {-0.10345915704965591f, 0.04927875101566315f, -1.004879355430603f, -0.5021334290504456f, -0.553217887878418f, -0.4622242748737335f, -1.2254416942596436f, -0.43023672699928284f},
+    {-0.10689050704240799f, 0.039855800569057465f, -0.9804550409317017f, -0.4996125400066376f, -0.5672340989112854f, -0.45953255891799927f, -1.2376607656478882f, -0.43767955899238586f},
+    {-0.11162928491830826f, 0.01734377257525921f, -0.9595845341682434f, -0.5019515156745911f, -0.5853681564331055f, -0.45568397641181946f, -1.255637764930725f, -0.45396628975868225f},
+    {-0.12530168890953064f, -0.0024380667600780725f, -0.9323602914810181f, -0.5021039843559265f, -0.5955336093902588f, -0.45157337188720703f, -1.2662206888198853f, -0.47160768508911133f},
+    {-0.1380903422832489f, -0.020039027556777f, -0.904148280620575f, -0.49599432945251465f, -0.6036425828933716f, -0.43956613540649414f, -1.2846328020095825f, -0.4788322150707245f},
+    {-0.14123255014419556f, -0.03155761957168579f, -0.8682658076286316f, -0.4916479289531708f, -0.6169910430908203f, -0.43406742811203003f, -1.3010057210922241f, -0.4851362109184265f},
+    {-0.1534499078989029f, -0.04410696402192116f, -0.8558865785598755f, -0.49290356040000916f, -0.6196786761283875f, -0.4246607720851898f, -1.3093805313110352f, -0.5011104345321655f},
+    {-0.16157424449920654f, -0.04989110305905342f, -0.8318910598754883f, -0.48745906352996826f, -0.627837598323822f, -0.4173661768436432f, -1.3170417547225952f, -0.5090957880020142f},
+    {-0.1726813167333603f, -0.06336318701505661f, -0.8152874112129211f, -0.4871473014354706f, -0.6353191137313843f, -0.41012173891067505f, -1.3260105848312378f, -0.5226148366928101f},
+    {-0.1840272694826126f, -0.07382646203041077f, -0.7886335253715515f, -0.4773319363594055f, -0.6460228562355042f, -0.4066731333732605f, -1.3307430744171143f, -0.5291009545326233f},
+    {-0.1985275000333786f, -0.08987759053707123f, -0.7705191969871521f, -0.47819361090660095f, -0.6488856077194214f, -0.40179377794265747f, -1.3419253826141357f, -0.5476193428039551f},
+    {-0.20714612305164337f, -0.09738742560148239f, -0.7471879124641418f, -0.46912655234336853f, -0.6591484546661377f, -0.39875736832618713f, -1.349908709526062f, -0.5590838193893433f},
+    {-0.22127901017665863f, -0.10636147856712341f, -0.7243164777755737f, -0.4649021327495575f, -0.6661971807479858f, -0.3868466019630432f, -1.3548364639282227f, -0.5730950832366943f},
+    {-0.23791596293449402f, -0.11297916620969772f, -0.7017259001731873f, -0.4546574056148529f, -0.6718251705169678f, -0.37507757544517517f, -1.361282229423523f, -0.5824500918388367f},
+    {-0.2517009377479553f, -0.12806306779384613f, -0.6842226386070251f, -0.44583627581596375f, -0.6807886362075806f, -0.3603445589542389f, -1.3649406433105469f, -0.5913149118423462f},
+    {-0.26518920063972473f, -0.13054415583610535f, -0.6597643494606018f, -0.441723495721817f, -0.6852826476097107f, -0.3447590470314026f, -1.3651096820831299f, -0.5998303294181824f},
+    {-0.28683680295944214f, -0.1394246518611908f, -0.6361165642738342f, -0.4412583112716675f, -0.6855151653289795f, -0.32966548204421997f, -1.3696268796920776f, -0.6088979840278625f},
+    {-0.30050021409988403f, -0.14226588606834412f, -0.6103248000144958f, -0.4312785565853119f, -0.6895566582679749f, -0.31925076246261597f, -1.3710070848464966f, -0.6160376667976379f},
+    {-0.31928613781929016f, -0.1502646654844284f, -0.582880437374115f, -0.42681851983070374f, -0.6988216042518616f, -0.3026443123817444f, -1.3820104598999023f, -0.6190407872200012f},
+    {-0.34289729595184326f, -0.15438205003738403f, -0.5517135262489319f, -0.41474390029907227f, -0.7003946304321289f, -0.2882643938064575f, -1.3836857080459595f, -0.6274291276931763f},
+    {-0.3673221468925476f, -0.16193856298923492f, -0.5306168794631958f, -0.4097042977809906f, -0.6998358964920044f, -0.2808266580104828f, -1.3908179998397827f, -0.6310250759124756f},
+    {-0.388079434633255f, -0.16400016844272614f, -0.49636977910995483f, -0.3993511199951172f, -0.7022842168807983f, -0.2701174020767212f, -1.3958128690719604f, -0.6359946131706238f},
+    {-0.4086408317089081f, -0.17294207215309143f, -0.4722760021686554f, -0.3953358829021454f, -0.6967018246650696f, -0.25361868739128113f, -1.4045865535736084f, -0.6473443508148193f},
+    {-0.42632824182510376f, -0.17326682806015015f, -0.44962024688720703f, -0.38447868824005127f, -0.6882269978523254f, -0.24391914904117584f, -1.4057344198226929f, -0.6572747826576233f},
+    {-0.4470290243625641f, -0.1783583164215088f, -0.4316478371620178f, -0.3794557452201843f, -0.6856275796890259f, -0.22873133420944214f, -1.4054135084152222f, -0.6683518290519714f},
+    {-0.4593093693256378f, -0.18169818818569183f, -0.40798312425613403f, -0.37006235122680664f, -0.6935003399848938f, -0.21813207864761353f, -1.3988515138626099f, -0.6717175245285034f},
+    {-0.47953662276268005f, -0.1851085126399994f, -0.3896728754043579f, -0.36292174458503723f, -0.6930606365203857f, -0.1989475041627884f, -1.3954048156738281f, -0.6794785857200623f},
+    {-0.5023229122161865f, -0.1834479123353958f, -0.36038070917129517f, -0.35171574354171753f, -0.6933242678642273f, -0.17893333733081818f, -1.3887255191802979f, -0.6764735579490662f},
+    {-0.5228654146194458f, -0.1902942657470703f, -0.34241801500320435f, -0.34411072731018066f, -0.689352810382843f, -0.16348429024219513f, -1.3877723217010498f, -0.6854600310325623f},
+    {-0.5466770529747009f, -0.18227672576904297f, -0.31354156136512756f, -0.3390905559062958f, -0.6810490489006042f, -0.13607986271381378f, -1.379765272140503f, -0.689866840839386f},
+    {-0.5740824341773987f, -0.18547113239765167f, -0.2942630648612976f, -0.3309137225151062f, -0.6765332818031311f, -0.1144699975848198f, -1.3788886070251465f, -0.7096876502037048f},
+    {-0.5948939323425293f, -0.17974558472633362f, -0.2679343521595001f, -0.3227798640727997f, -0.6759464144706726f, -0.10568385571241379f, -1.3708423376083374f, -0.7165645956993103f},
+    {-0.6211302876472473f, -0.18331214785575867f, -0.2488657683134079f, -0.3158622682094574f, -0.6707168221473694f, -0.0856141597032547f, -1.3662477731704712f, -0.7219098806381226f},
+    {-0.6421663165092468f, -0.17976517975330353f, -0.22930575907230377f, -0.29337260127067566f, -0.6662009954452515f, -0.0603976771235466f, -1.3616198301315308f, -0.7289315462112427f},
+    {-0.6628856658935547f, -0.18034493923187256f, -0.2143191397190094f, -0.2890143394470215f, -0.6613995432853699f, -0.0423903726041317f, -1.3559346199035645f, -0.7335928082466125f},
+    {-0.6800454258918762f, -0.1718631535768509f, -0.1900206208229065f, -0.27789923548698425f, -0.653401255607605f, -0.025522859767079353f, -1.3473559617996216f, -0.7346412539482117f},
+    {-0.7001122236251831f, -0.1627485603094101f, -0.1740695983171463f, -0.2699699103832245f, -0.635779857635498f, -0.005033668130636215f, -1.339754581451416f, -0.7379024624824524f},
+    {-0.7214804291725159f, -0.15735328197479248f, -0.15486378967761993f, -0.2590418756008148f, -0.6260807514190674f, 0.009609282948076725f, -1.3311197757720947f, -0.746224045753479f},
+    {-0.7411704659461975f, -0.15918950736522675f, -0.12591266632080078f, -0.2405119687318802f, -0.6267355680465698f, 0.040005940943956375f, -1.3135391473770142f, -0.7688944935798645f},
+    {-0.7636265754699707f, -0.1472148299217224f, -0.09735932946205139f, -0.227006196975708f, -0.6206703782081604f, 0.057628028094768524f, -1.301182746887207f, -0.7670865654945374f},
+    {-0.784299910068512f, -0.13789412379264832f, -0.07400726526975632f, -0.22165827453136444f, -0.6125327944755554f, 0.07891213893890381f, -1.290684700012207f, -0.769648015499115f},
+    {-0.7998216152191162f, -0.11992472410202026f, -0.048663824796676636f, -0.21109981834888458f, -0.5958113670349121f, 0.0994710922241211f, -1.2788487672805786f, -0.7695429921150208f},
+    {-0.8300006985664368f, -0.11236734688282013f, -0.024012409150600433f, -0.2017892599105835f, -0.577147364616394f, 0.1194077730178833f, -1.276599645614624f, -0.773827314376831f},
+    {-0.8539229035377502f, -0.10099692642688751f, -0.0015399932162836194f, -0.19187265634536743f, -0.5592442154884338f, 0.13584886491298676f, -1.2697426080703735f, -0.7806219458580017f},
+    {-0.881492018699646f, -0.09992941468954086f, 0.014131174422800541f, -0.18861298263072968f, -0.5409069061279297f, 0.14729362726211548f, -1.2604174613952637f, -0.7944480776786804f},
+    {-0.9009021520614624f, -0.08702744543552399f, 0.040668752044439316f, -0.17345012724399567f, -0.53190678358078f, 0.157004714012146f, -1.2477444410324097f, -0.7931485176086426f},
+    {-0.9182018637657166f, -0.07610061019659042f, 0.05477539822459221f, -0.16675883531570435f, -0.5163500308990479f, 0.17345678806304932f, -1.2404561042785645f, -0.7946479320526123f},
+    {-0.9356883764266968f, -0.0639343112707138f, 0.07846525311470032f, -0.15485908091068268f, -0.5061482787132263f, 0.18891127407550812f, -1.2276381254196167f, -0.7929695248603821f},
+    {-0.9566844701766968f, -0.047845322638750076f, 0.10133577883243561f, -0.15040834248065948f, -0.4839390516281128f, 0.19230911135673523f, -1.2264575958251953f, -0.7913374304771423f},
+    {-0.978143572807312f, -0.024961983785033226f, 0.12785644829273224f, -0.14110656082630157f, -0.47282832860946655f, 0.20791661739349365f, -1.2093570232391357f, -0.7922471761703491f},
+    {-0.9937758445739746f, -0.012853213585913181f, 0.14262989163398743f, -0.1331050544977188f, -0.46196889877319336f, 0.224595308303833f, -1.1918479204177856f, -0.7933669090270996f},
+    {-1.019405722618103f, 0.020045345649123192f, 0.15880300104618073f, -0.12473266571760178f, -0.42322003841400146f, 0.2404565066099167f, -1.1689409017562866f, -0.7897149920463562f},
+    {-1.0378168821334839f, 0.03462732210755348f, 0.17236360907554626f, -0.11841293424367905f, -0.4030137062072754f, 0.2526737153530121f, -1.1506071090698242f, -0.7973372340202332f},
+    {-1.0615051984786987f, 0.046180542558431625f, 0.18928781151771545f, -0.10539243370294571f, -0.38785290718078613f, 0.2718694806098938f, -1.1324387788772583f, -0.8004966974258423f},
+    {-1.0857781171798706f, 0.0682842880487442f, 0.21713627874851227f, -0.08119899034500122f, -0.3741553723812103f, 0.29594993591308594f, -1.1139236688613892f, -0.8071515560150146f},
+    {-1.0979371070861816f, 0.08493609726428986f, 0.23597030341625214f, -0.06971994042396545f, -0.3641224205493927f, 0.3142513930797577f, -1.1015740633010864f, -0.7988713979721069f},
+    {-1.1196552515029907f, 0.10098287463188171f, 0.2539895474910736f, -0.057893332093954086f, -0.3428509831428528f, 0.3331548571586609f, -1.0848839282989502f, -0.8043994307518005f},
+    {-1.1305290460586548f, 0.11815936863422394f, 0.2650376260280609f, -0.047249481081962585f, -0.32929253578186035f, 0.3534007668495178f, -1.0707803964614868f, -0.7998093366622925f},
+    {-1.14769446849823f, 0.12989495694637299f, 0.274795264005661f, -0.03879282996058464f, -0.3094085156917572f, 0.37009197473526f, -1.0561637878417969f, -0.8059799671173096f},
+    {-1.1646802425384521f, 0.1498684138059616f, 0.2879285216331482f, -0.027523379772901535f, -0.2838279604911804f, 0.3949703574180603f, -1.043257713317871f, -0.8056455254554749f},
+    {-1.194128394126892f, 0.17009302973747253f, 0.29382699728012085f, -0.01810322515666485f, -0.2458048015832901f, 0.40811872482299805f, -1.0216968059539795f, -0.8241885900497437f},
+    {-1.2187622785568237f, 0.19537031650543213f, 0.30898517370224f, -0.01404986996203661f, -0.2132856696844101f, 0.4158593416213989f, -0.9987205266952515f, -0.828459620475769f},
+    {-1.2393913269042969f, 0.2161329686641693f, 0.3222404718399048f, -0.009284373372793198f, -0.18523751199245453f, 0.4388461410999298f, -0.9791806936264038f, -0.8260785341262817f},
+    {-1.2571712732315063f, 0.23318366706371307f, 0.3293653428554535f, -0.0028902923222631216f, -0.1633560061454773f, 0.45453596115112305f, -0.9651709198951721f, -0.8226833939552307f},
+    {-1.2725262641906738f, 0.24484050273895264f, 0.34105080366134644f, 0.00810543168336153f, -0.1431475579738617f, 0.46501725912094116f, -0.9487510323524475f, -0.8267903327941895f},
+    {-1.283431887626648f, 0.2645656168460846f, 0.35281890630722046f, 0.014134007506072521f, -0.12699753046035767f, 0.47385984659194946f, -0.9333575963973999f, -0.8170013427734375f},
+    {-1.2928318977355957f, 0.28327032923698425f, 0.3624774217605591f, 0.024429498240351677f, -0.10464537143707275f, 0.48255228996276855f, -0.914718747138977f, -0.8050439357757568f},
+    {-1.306615948677063f, 0.29351547360420227f, 0.3720523715019226f, 0.034585174173116684f, -0.0921291932463646f, 0.49285805225372314f, -0.899391770362854f, -0.7995709776878357f},
+    {-1.3182554244995117f, 0.3011258542537689f, 0.3784323036670685f, 0.044728685170412064f, -0.0746040791273117f, 0.5009688138961792f, -0.8819555640220642f, -0.7960778474807739f},
+    {-1.3248169422149658f, 0.30906668305397034f, 0.3807036578655243f, 0.053856778889894485f, -0.05540404096245766f, 0.5090433955192566f, -0.8683981895446777f, -0.7877470254898071f},
+    {-1.3323440551757812f, 0.31587204337120056f, 0.3828780949115753f, 0.06581394374370575f, -0.03671176731586456f, 0.5137243866920471f, -0.8540139198303223f, -0.783608078956604f},
+    {-1.3409911394119263f, 0.3249596059322357f, 0.39190277457237244f, 0.0735844075679779f, -0.01878984272480011f, 0.5214584469795227f, -0.8401733040809631f, -0.7773905992507935f},
+    {-1.348060131072998f, 0.3299732208251953f, 0.39291059970855713f, 0.08471477776765823f, 0.0014322970528155565f, 0.5226640701293945f, -0.8233869075775146f, -0.7737426161766052f},
+    {-1.3511719703674316f, 0.34207141399383545f, 0.40384441614151f, 0.0926113948225975f, 0.022688737139105797f, 0.5355185270309448f, -0.8090621829032898f, -0.7625581622123718f},
+    {-1.3586719036102295f, 0.3484385013580322f, 0.4065925180912018f, 0.10127387940883636f, 0.0445975624024868f, 0.5424092411994934f, -0.7944062352180481f, -0.7610546350479126f},
+    {-1.3593648672103882f, 0.35288235545158386f, 0.41086122393608093f, 0.10725372284650803f, 0.06097513809800148f, 0.544265627861023f, -0.7817230820655823f, -0.7495309710502625f},
+    {-1.3614599704742432f, 0.35396328568458557f, 0.41338101029396057f, 0.11250722408294678f, 0.07963306456804276f, 0.5398498177528381f, -0.7677514553070068f, -0.7430086135864258f},
+    {-1.3723934888839722f, 0.373983234167099f, 0.43132850527763367f, 0.11610910296440125f, 0.11270679533481598f, 0.5326752066612244f, -0.74675452709198f, -0.7173764705657959f},
+    {-1.3998613357543945f, 0.3977745771408081f, 0.46396082639694214f, 0.12984301149845123f, 0.16277754306793213f, 0.5118085145950317f, -0.7134875655174255f, -0.6797211766242981f},
+    {-1.4119665622711182f, 0.40650293231010437f, 0.48140373826026917f, 0.1473836600780487f, 0.20572739839553833f, 0.5002527236938477f, -0.6920607686042786f, -0.6543360948562622f},
+    {-1.4136639833450317f, 0.40652191638946533f, 0.47752562165260315f, 0.15615136921405792f, 0.23324382305145264f, 0.4931972324848175f, -0.6784539222717285f, -0.6480588316917419f},
+    {-1.4128985404968262f, 0.41199564933776855f, 0.481342613697052f, 0.15948233008384705f, 0.26101136207580566f, 0.47203463315963745f, -0.660345733165741f, -0.6216374039649963f},
+    {-1.4108712673187256f, 0.4053284525871277f, 0.48061707615852356f, 0.16248798370361328f, 0.28341999650001526f, 0.46213096380233765f, -0.6450574994087219f, -0.6067481637001038f},
+    {-1.4069513082504272f, 0.4004027247428894f, 0.4833635091781616f, 0.1674635410308838f, 0.3075346350669861f, 0.4496154487133026f, -0.6357213854789734f, -0.5895959734916687f},
+    {-1.406070351600647f, 0.3936786651611328f, 0.48298922181129456f, 0.17221559584140778f, 0.33505237102508545f, 0.4379118084907532f, -0.6232596635818481f, -0.577330470085144f},
+    {-1.400783896446228f, 0.3900909125804901f, 0.48589667677879333f, 0.17863675951957703f, 0.35962021350860596f, 0.42576491832733154f, -0.6133404970169067f, -0.5558828115463257f},
+    {-1.3955479860305786f, 0.38051342964172363f, 0.4845035970211029f, 0.17942769825458527f, 0.38909098505973816f, 0.40725934505462646f, -0.5987151861190796f, -0.5436192154884338f},
+    {-1.3874402046203613f, 0.37188589572906494f, 0.48173579573631287f, 0.1786397099494934f, 0.42412951588630676f, 0.3865068554878235f, -0.5856342911720276f, -0.5113469362258911f},
+    {-1.3875657320022583f, 0.35830917954444885f, 0.47750556468963623f, 0.17798559367656708f, 0.4611489176750183f, 0.35885682702064514f, -0.5731545090675354f, -0.4945771396160126f},
+    {-1.3798189163208008f, 0.3457726538181305f, 0.47572505474090576f, 0.17686937749385834f, 0.4880789518356323f, 0.34252095222473145f, -0.5630565285682678f, -0.466105192899704f},
+    {-1.3692103624343872f, 0.3264669179916382f, 0.47131583094596863f, 0.17385557293891907f, 0.5195466876029968f, 0.3112787902355194f, -0.5481694340705872f, -0.4485255181789398f},
+    {-1.3547751903533936f, 0.31134530901908875f, 0.4711286425590515f, 0.17036603391170502f, 0.5446215867996216f, 0.2826140820980072f, -0.534656822681427f, -0.41978558897972107f},
+    {-1.338546633720398f, 0.2903044819831848f, 0.4616295099258423f, 0.1690998524427414f, 0.5796570777893066f, 0.24787579476833344f, -0.5205453038215637f, -0.3981609344482422f},
+    {-1.3177886009216309f, 0.2684396505355835f, 0.45530402660369873f, 0.16129320859909058f, 0.613754391670227f, 0.2122008502483368f, -0.5112026929855347f, -0.35639292001724243f},
+    {-1.2972582578659058f, 0.24107098579406738f, 0.44361385703086853f, 0.1576254665851593f, 0.6462886333465576f, 0.15979692339897156f, -0.497839093208313f, -0.33502721786499023f},
+    {-1.272657871246338f, 0.21643614768981934f, 0.4341278076171875f, 0.1556616872549057f, 0.6766830682754517f, 0.10340344160795212f, -0.4824681282043457f, -0.3108791708946228f},
+    {-1.2298898696899414f, 0.10827557742595673f, 0.39205610752105713f, 0.10614702105522156f, 0.767467200756073f, -0.07863979041576385f, -0.41534993052482605f, -0.27993765473365784f},
+    {-1.1960408687591553f, -0.07144135236740112f, 0.3233892321586609f, 0.023746991530060768f, 0.9457306265830994f, -0.35357630252838135f, -0.3031213879585266f, -0.17009226977825165f},
+    {-1.1878303289413452f, -0.15555453300476074f, 0.29117825627326965f, 0.029736291617155075f, 1.0159791707992554f, -0.47279104590415955f, -0.2595846354961395f, -0.14086568355560303f},
+    {-1.1745045185089111f, -0.1796494871377945f, 0.28642627596855164f, 0.030231323093175888f, 1.0416185855865479f, -0.5121520757675171f, -0.25100377202033997f, -0.12856975197792053f},
+    {-1.165754795074463f, -0.2061070203781128f, 0.27628931403160095f, 0.025341475382447243f, 1.0730925798416138f, -0.5477008819580078f, -0.2441297322511673f, -0.11574655026197433f},
+    {-1.1493486166000366f, -0.23379841446876526f, 0.2681243419647217f, 0.0251513309776783f, 1.0929824113845825f, -0.5819739699363708f, -0.23656776547431946f, -0.09705637395381927f},
+    {-1.134466290473938f, -0.26001036167144775f, 0.2545241713523865f, 0.024992499500513077f, 1.1198707818984985f, -0.614087700843811f, -0.22377589344978333f, -0.08795282989740372f},
+    {-1.1184253692626953f, -0.27623850107192993f, 0.2546485364437103f, 0.026654118672013283f, 1.1417759656906128f, -0.6392651796340942f, -0.21743638813495636f, -0.06317383050918579f},
+    {-1.1018543243408203f, -0.293124794960022f, 0.24452871084213257f, 0.026564013212919235f, 1.160927414894104f, -0.6607867479324341f, -0.2085607349872589f, -0.052098598331213f},
+    {-1.0868252515792847f, -0.30841588973999023f, 0.2378147840499878f, 0.026844151318073273f, 1.1730914115905762f, -0.6774791479110718f, -0.20221742987632751f, -0.0359451025724411f},
+    {-1.070322871208191f, -0.3306422531604767f, 0.2264215499162674f, 0.02348584681749344f, 1.19088613986969f, -0.697745680809021f, -0.19406510889530182f, -0.026171818375587463f},
+    {-1.0423333644866943f, -0.35069313645362854f, 0.2181536704301834f, 0.02044696919620037f, 1.1979327201843262f, -0.720642626285553f, -0.19273321330547333f, 0.0066056028008461f},
+    {-1.0173146724700928f, -0.37725862860679626f, 0.20881852507591248f, 0.02376813255250454f, 1.2058162689208984f, -0.7432448863983154f, -0.18053603172302246f, 0.024473082274198532f},
+    {-0.990912914276123f, -0.39475688338279724f, 0.19936396181583405f, 0.02334376983344555f, 1.210117220878601f, -0.7610073089599609f, -0.17540103197097778f, 0.05936981365084648f},
+    {-0.9538747668266296f, -0.41877031326293945f, 0.18589992821216583f, 0.021761616691946983f, 1.224524974822998f, -0.7880861759185791f, -0.16791898012161255f, 0.07467477768659592f},
+    {-0.9337450861930847f, -0.4298725128173828f, 0.17641542851924896f, 0.023100409656763077f, 1.2366082668304443f, -0.8018790483474731f, -0.16055957973003387f, 0.0972926989197731f},
+    {-0.9137125015258789f, -0.44683048129081726f, 0.16183917224407196f, 0.02625959925353527f, 1.248378872871399f, -0.8163448572158813f, -0.15094740688800812f, 0.11160019040107727f},
+    {-0.8911211490631104f, -0.4657262861728668f, 0.14783954620361328f, 0.024857407435774803f, 1.253320574760437f, -0.8361530900001526f, -0.1432950347661972f, 0.12995578348636627f},
+    {-0.8643100261688232f, -0.487772673368454f, 0.13511569797992706f, 0.03504207730293274f, 1.2569540739059448f, -0.8508943319320679f, -0.13113240897655487f, 0.14041933417320251f},
+    {-0.8215925693511963f, -0.5043143630027771f, 0.12087500095367432f, 0.04571704939007759f, 1.2596526145935059f, -0.868832528591156f, -0.11865683645009995f, 0.16577278077602386f},
+    {-0.7914248704910278f, -0.5303768515586853f, 0.10004539787769318f, 0.052033644169569016f, 1.2595902681350708f, -0.8851606249809265f, -0.10149963945150375f, 0.1828293651342392f},
+    {-0.7595826983451843f, -0.545138418674469f, 0.08619335293769836f, 0.05814042314887047f, 1.2567082643508911f, -0.8926332592964172f, -0.09072751551866531f, 0.20557644963264465f},
+    {-0.7379304766654968f, -0.5649378299713135f, 0.07618865370750427f, 0.0653366670012474f, 1.2565979957580566f, -0.9047961831092834f, -0.08032012730836868f, 0.21182195842266083f},
+    {-0.7138306498527527f, -0.5788404941558838f, 0.07024352252483368f, 0.07569418102502823f, 1.2499995231628418f, -0.9097661375999451f, -0.0712093934416771f, 0.23086652159690857f},
+    {-0.6907848715782166f, -0.5994401574134827f, 0.0517464205622673f, 0.08654966950416565f, 1.2500989437103271f, -0.9138417840003967f, -0.06761696934700012f, 0.24177207052707672f},
+    {-0.6568489074707031f, -0.6169173121452332f, 0.03608401492238045f, 0.09876271337270737f, 1.2394976615905762f, -0.9179194569587708f, -0.061145469546318054f, 0.26577314734458923f},
+    {-0.6402057409286499f, -0.6306996941566467f, 0.025800010189414024f, 0.10293159633874893f, 1.2406126260757446f, -0.921759307384491f, -0.05274061858654022f, 0.27357587218284607f},
+    {-0.6191622614860535f, -0.6410800814628601f, 0.019635921344161034f, 0.10915092378854752f, 1.2353997230529785f, -0.921394407749176f, -0.04691359028220177f, 0.2873525023460388f},
+    {-0.5986780524253845f, -0.6583181619644165f, 0.014648675918579102f, 0.1218251883983612f, 1.2266932725906372f, -0.925017774105072f, -0.0370212160050869f, 0.294646292924881f},
+    {-0.5746456980705261f, -0.6723225712776184f, 0.009144730865955353f, 0.1349208652973175f, 1.2150938510894775f, -0.9255023002624512f, -0.027729958295822144f, 0.3105778992176056f},
+    {-0.5526899695396423f, -0.6919902563095093f, -0.0012354872887954116f, 0.144931361079216f, 1.210569143295288f, -0.9317236542701721f, -0.015881944447755814f, 0.312911719083786f},
+    {-0.5288323163986206f, -0.7122233510017395f, -0.012706819921731949f, 0.15693320333957672f, 1.19521164894104f, -0.9351395964622498f, 0.000830395903903991f, 0.3242850601673126f},
+    {-0.5112659931182861f, -0.7293508648872375f, -0.02265956625342369f, 0.16532501578330994f, 1.1909801959991455f, -0.9370257258415222f, 0.013384988531470299f, 0.32977789640426636f},
+    {-0.4925331473350525f, -0.7434958219528198f, -0.02783041261136532f, 0.1765119582414627f, 1.1805208921432495f, -0.9324011206626892f, 0.02284477837383747f, 0.3355370759963989f},
+    {-0.4642787575721741f, -0.7693784236907959f, -0.04294264689087868f, 0.1901160180568695f, 1.161726474761963f, -0.9352031350135803f, 0.03847615048289299f, 0.3321775197982788f},
+    {-0.4388774335384369f, -0.7801255583763123f, -0.05522261559963226f, 0.20299606025218964f, 1.1529046297073364f, -0.9371253252029419f, 0.0490383543074131f, 0.33855128288269043f},
+    {-0.422128826379776f, -0.7955344915390015f, -0.06703125685453415f, 0.2124772071838379f, 1.1467907428741455f, -0.9373267889022827f, 0.056714627891778946f, 0.3372313678264618f},
+    {-0.3814680278301239f, -0.8079211711883545f, -0.06364968419075012f, 0.24080757796764374f, 1.1170599460601807f, -0.9320525527000427f, 0.07096511125564575f, 0.3725782632827759f},
+    {-0.35554489493370056f, -0.8353648781776428f, -0.08101685345172882f, 0.2472516894340515f, 1.108793020248413f, -0.9348917007446289f, 0.08544222265481949f, 0.3614145815372467f},
+    {-0.31599441170692444f, -0.8606600761413574f, -0.0856204554438591f, 0.2586958408355713f, 1.0938599109649658f, -0.9407995939254761f, 0.10416760295629501f, 0.3643423914909363f},
+    {-0.29673948884010315f, -0.8787059187889099f, -0.09435007721185684f, 0.2645524740219116f, 1.083790898323059f, -0.935359537601471f, 0.11574029177427292f, 0.3641335368156433f},
+    {-0.278117835521698f, -0.8959895372390747f, -0.11121583729982376f, 0.26813191175460815f, 1.074461817741394f, -0.92685866355896f, 0.12343153357505798f, 0.3611425459384918f},
+    {-0.25042247772216797f, -0.9214205145835876f, -0.12313076108694077f, 0.2872559428215027f, 1.0493508577346802f, -0.9201252460479736f, 0.12723296880722046f, 0.3654882311820984f},
+    {-0.2306956648826599f, -0.9284310340881348f, -0.12726247310638428f, 0.2977190911769867f, 1.0388953685760498f, -0.913732647895813f, 0.1333811730146408f, 0.36952874064445496f},
+    {-0.2060817927122116f, -0.9316399693489075f, -0.12769068777561188f, 0.3192460238933563f, 1.028480052947998f, -0.9048489332199097f, 0.14444699883460999f, 0.3686612844467163f},
+    {-0.19026023149490356f, -0.939379870891571f, -0.13237695395946503f, 0.3329820930957794f, 1.0112838745117188f, -0.8903726935386658f, 0.15382012724876404f, 0.3627772331237793f},
+    {-0.17122597992420197f, -0.95323646068573f, -0.14889749884605408f, 0.34315216541290283f, 1.0019960403442383f, -0.8717783093452454f, 0.17285431921482086f, 0.3582480251789093f},
+    {-0.14895062148571014f, -0.9660497903823853f, -0.1489071398973465f, 0.3612649142742157f, 0.9786444902420044f, -0.8578583598136902f, 0.1883314847946167f, 0.3546704053878784f},
+    {-0.13995115458965302f, -0.9801234602928162f, -0.15296263992786407f, 0.37324947118759155f, 0.9683606028556824f, -0.8470712900161743f, 0.1978476494550705f, 0.34751278162002563f},
+    {-0.12860660254955292f, -0.989167332649231f, -0.152147576212883f, 0.38474786281585693f, 0.9530829191207886f, -0.8351850509643555f, 0.20729981362819672f, 0.34523481130599976f},
+    {-0.11787256598472595f, -1.0072641372680664f, -0.16061225533485413f, 0.39287564158439636f, 0.9439406991004944f, -0.8259058594703674f, 0.21817275881767273f, 0.33976277709007263f},
+    {-0.10307157784700394f, -1.0159920454025269f, -0.15878546237945557f, 0.4075571894645691f, 0.9290686845779419f, -0.8097007870674133f, 0.2301321029663086f, 0.3307966887950897f},
+    {-0.09602612257003784f, -1.0301028490066528f, -0.1541115939617157f, 0.42224881052970886f, 0.9105339050292969f, -0.788791835308075f, 0.24553270637989044f, 0.30908098816871643f},
+    {-0.08161602169275284f, -1.0400010347366333f, -0.16043218970298767f, 0.43105459213256836f, 0.8979942202568054f, -0.7790427207946777f, 0.25606662034988403f, 0.30177322030067444f},
+    {-0.06434234231710434f, -1.0509824752807617f, -0.16811566054821014f, 0.4380042850971222f, 0.882853627204895f, -0.7611321806907654f, 0.2670719623565674f, 0.2881275713443756f},
+    {-0.04733927920460701f, -1.0586836338043213f, -0.1714639961719513f, 0.44721052050590515f, 0.8667964339256287f, -0.7438206076622009f, 0.28055426478385925f, 0.284429669380188f},
+    {-0.030086565762758255f, -1.0729566812515259f, -0.1771155446767807f, 0.4536280632019043f, 0.8467599153518677f, -0.7249332070350647f, 0.29614827036857605f, 0.2771107852458954f},
+    {-0.00819949246942997f, -1.0843243598937988f, -0.18049854040145874f, 0.4601888656616211f, 0.8244494795799255f, -0.7025876045227051f, 0.31332892179489136f, 0.26965683698654175f},
+    {0.00784354005008936f, -1.093868613243103f, -0.1882593184709549f, 0.469093918800354f, 0.812466025352478f, -0.6805580854415894f, 0.3284289538860321f, 0.2573758065700531f},
+    {0.02177795208990574f, -1.1004313230514526f, -0.19107089936733246f, 0.4766598045825958f, 0.7976239919662476f, -0.6630119681358337f, 0.3419451117515564f, 0.2482244223356247f},
+    {0.028985099866986275f, -1.112039566040039f, -0.19997790455818176f, 0.48501056432724f, 0.7848659157752991f, -0.6489869952201843f, 0.35083892941474915f, 0.2336227148771286f},
+    {0.03739479184150696f, -1.1184024810791016f, -0.20226503908634186f, 0.4934087097644806f, 0.7708989977836609f, -0.633720874786377f, 0.36247044801712036f, 0.22266970574855804f},
+    {0.04637372866272926f, -1.1293597221374512f, -0.21027570962905884f, 0.5016261339187622f, 0.754331648349762f, -0.6152007579803467f, 0.3717940151691437f, 0.20780104398727417f},
+    {0.05266832187771797f, -1.1326650381088257f, -0.21250684559345245f, 0.5103182792663574f, 0.7372386455535889f, -0.5988377332687378f, 0.37803319096565247f, 0.19942612946033478f},
+    {0.05809197202324867f, -1.144281268119812f, -0.22126533091068268f, 0.519538164138794f, 0.7198581099510193f, -0.5772010087966919f, 0.38478508591651917f, 0.18417024612426758f},
+    {0.06747502088546753f, -1.1473259925842285f, -0.22266188263893127f, 0.5320281386375427f, 0.698166012763977f, -0.5582283139228821f, 0.3942412734031677f, 0.1756136566400528f},
+    {0.07659973949193954f, -1.156312346458435f, -0.22822056710720062f, 0.5412171483039856f, 0.677252471446991f, -0.5372006297111511f, 0.4042578339576721f, 0.15873324871063232f},
+    {0.08724325150251389f, -1.1599183082580566f, -0.2314050793647766f, 0.5528672933578491f, 0.6593350172042847f, -0.518057644367218f, 0.4137466251850128f, 0.14533458650112152f},
+    {0.08956706523895264f, -1.1635479927062988f, -0.2374962568283081f, 0.5613758563995361f, 0.6482686400413513f, -0.4952232837677002f, 0.4188302159309387f, 0.12665420770645142f},
+    {0.09390196204185486f, -1.164029836654663f, -0.2382115125656128f, 0.5749517679214478f, 0.6301537752151489f, -0.4733465015888214f, 0.42965424060821533f, 0.1089426726102829f},
+    {0.09944500774145126f, -1.1695581674575806f, -0.24664002656936646f, 0.5842431783676147f, 0.6186519265174866f, -0.4519844949245453f, 0.436172753572464f, 0.09133142232894897f},
+    {0.10642353445291519f, -1.1661690473556519f, -0.25301501154899597f, 0.5962297320365906f, 0.6031006574630737f, -0.42442986369132996f, 0.4482634961605072f, 0.07177664339542389f},
+    {0.11190202832221985f, -1.173548936843872f, -0.2625277042388916f, 0.6045696139335632f, 0.5901800394058228f, -0.40355807542800903f, 0.4569387435913086f, 0.05270160362124443f},
+    {0.12207478284835815f, -1.1758407354354858f, -0.2619813084602356f, 0.619322657585144f, 0.5716887712478638f, -0.3828886151313782f, 0.46605539321899414f, 0.03954716771841049f},
+    {0.12429316341876984f, -1.18171226978302f, -0.2688938081264496f, 0.6251033544540405f, 0.5609355568885803f, -0.3654749393463135f, 0.47192806005477905f, 0.022236069664359093f},
+    {0.1267874538898468f, -1.1817165613174438f, -0.26599186658859253f, 0.6382752656936646f, 0.5471545457839966f, -0.3466782867908478f, 0.4867696166038513f, 0.007080674171447754f},
+    {0.1385580152273178f, -1.1923717260360718f, -0.268970787525177f, 0.6478955149650574f, 0.5362406373023987f, -0.3255351781845093f, 0.4961612820625305f, -0.01480370294302702f},
+    {0.14555002748966217f, -1.1918134689331055f, -0.2669573426246643f, 0.6551020741462708f, 0.5258798003196716f, -0.3079257905483246f, 0.5025250911712646f, -0.03350500762462616f},
+    {0.14524997770786285f, -1.1953890323638916f, -0.27168014645576477f, 0.660591185092926f, 0.5166443586349487f, -0.28941574692726135f, 0.5069922208786011f, -0.05398321896791458f},
+    {0.14916445314884186f, -1.1929374933242798f, -0.270122230052948f, 0.6708278656005859f, 0.503801703453064f, -0.2707943916320801f, 0.5146908164024353f, -0.06971554458141327f},
+    {0.14701122045516968f, -1.1938905715942383f, -0.27135393023490906f, 0.6765490770339966f, 0.49657300114631653f, -0.24443967640399933f, 0.5269182920455933f, -0.09557943046092987f},
+    {0.14655570685863495f, -1.1936906576156616f, -0.2681022882461548f, 0.6876378655433655f, 0.4812757968902588f, -0.22101134061813354f, 0.5353917479515076f, -0.11453966796398163f},
+    {0.1463046669960022f, -1.1978468894958496f, -0.27105483412742615f, 0.6900473237037659f, 0.47285082936286926f, -0.1987304538488388f, 0.5404934883117676f, -0.1343582421541214f},
+    {0.14670495688915253f, -1.1944653987884521f, -0.26810190081596375f, 0.6980787515640259f, 0.4623338580131531f, -0.1798570454120636f, 0.5466891527175903f, -0.15535923838615417f},
+    {0.1438814252614975f, -1.1944141387939453f, -0.2695249021053314f, 0.6998168230056763f, 0.453092098236084f, -0.15746426582336426f, 0.5525976419448853f, -0.177029550075531f},
+    {0.14002551138401031f, -1.1836987733840942f, -0.2621530294418335f, 0.7079490423202515f, 0.4406818151473999f, -0.1312035620212555f, 0.5606634616851807f, -0.19907520711421967f},
+    {0.13851462304592133f, -1.1808366775512695f, -0.2628336548805237f, 0.7095407247543335f, 0.43059030175209045f, -0.10738757252693176f, 0.569208562374115f, -0.22326183319091797f},
+    {0.14024445414543152f, -1.1700612306594849f, -0.2579936683177948f, 0.7138567566871643f, 0.4188753068447113f, -0.08378542214632034f, 0.5849936604499817f, -0.2452537715435028f},
+    {0.14079807698726654f, -1.1660854816436768f, -0.2590726315975189f, 0.7136877775192261f, 0.4128679037094116f, -0.05594583600759506f, 0.5910254120826721f, -0.2713471055030823f},
+    {0.1419435292482376f, -1.1604424715042114f, -0.2573198676109314f, 0.7182210087776184f, 0.4063040316104889f, -0.03446315973997116f, 0.5986002087593079f, -0.2906053364276886f},
+    {0.1400480419397354f, -1.1639231443405151f, -0.25886642932891846f, 0.7187345623970032f, 0.40292975306510925f, -0.016738375648856163f, 0.60349041223526f, -0.30972903966903687f},
+    {0.13886967301368713f, -1.1619188785552979f, -0.25548380613327026f, 0.7228376269340515f, 0.3972720801830292f, -7.720007852185518e-05f, 0.6095749735832214f, -0.3274965286254883f},
+    {0.12915614247322083f, -1.1564007997512817f, -0.2546955943107605f, 0.7189083695411682f, 0.4000021517276764f, 0.019692441448569298f, 0.6176577806472778f, -0.3531847894191742f},
+    {0.13395297527313232f, -1.1514651775360107f, -0.2527386546134949f, 0.7252303957939148f, 0.39054277539253235f, 0.03955284506082535f, 0.6249310970306396f, -0.37085652351379395f},
+    {0.13295027613639832f, -1.1490154266357422f, -0.2538995146751404f, 0.7231497168540955f, 0.38551342487335205f, 0.0653083473443985f, 0.6365631222724915f, -0.3973473310470581f},
+    {0.13573375344276428f, -1.1379162073135376f, -0.24594436585903168f, 0.7213712930679321f, 0.38089144229888916f, 0.08710291236639023f, 0.6501246094703674f, -0.42105716466903687f},
+    {0.13644835352897644f, -1.1316150426864624f, -0.24411655962467194f, 0.7168395519256592f, 0.3757791817188263f, 0.108749158680439f, 0.6585588455200195f, -0.447580486536026f},
+    {0.13630613684654236f, -1.1204564571380615f, -0.23963132500648499f, 0.7211284637451172f, 0.37191134691238403f, 0.12921375036239624f, 0.6688366532325745f, -0.46782591938972473f},
+    {0.1364695280790329f, -1.1196974515914917f, -0.24199740588665009f, 0.7207700610160828f, 0.36551931500434875f, 0.15177345275878906f, 0.6737332344055176f, -0.49127650260925293f},
+    {0.13914252817630768f, -1.1120967864990234f, -0.23457151651382446f, 0.7239704728126526f, 0.3570743203163147f, 0.17189818620681763f, 0.6782848238945007f, -0.5101655721664429f},
+    {0.13131871819496155f, -1.1072702407836914f, -0.23234519362449646f, 0.7201164364814758f, 0.35147595405578613f, 0.20129717886447906f, 0.6799207925796509f, -0.533833920955658f},
+    {0.12688766419887543f, -1.1004722118377686f, -0.22384262084960938f, 0.7131706476211548f, 0.3477139174938202f, 0.22489580512046814f, 0.6833425760269165f, -0.5553693771362305f},
+    {0.12761664390563965f, -1.0972750186920166f, -0.2242518812417984f, 0.708742082118988f, 0.3482401669025421f, 0.2422943413257599f, 0.687750518321991f, -0.5797844529151917f},
+    {0.13230660557746887f, -1.0889508724212646f, -0.21928083896636963f, 0.7078321576118469f, 0.34213370084762573f, 0.25930213928222656f, 0.6864675879478455f, -0.5958377122879028f},
+    {0.12913279235363007f, -1.0866730213165283f, -0.2111341506242752f, 0.6999156475067139f, 0.3446181118488312f, 0.274246484041214f, 0.6904198527336121f, -0.622133731842041f},
+    {0.12955032289028168f, -1.0768156051635742f, -0.20611609518527985f, 0.6936998963356018f, 0.3436603844165802f, 0.2928096652030945f, 0.693075954914093f, -0.6370624899864197f},
+    {0.1316451132297516f, -1.0720497369766235f, -0.20499971508979797f, 0.6879843473434448f, 0.3440452516078949f, 0.3074195683002472f, 0.697355329990387f, -0.6587784290313721f},
+    {0.13040249049663544f, -1.0643097162246704f, -0.19621188938617706f, 0.6826305985450745f, 0.3404265344142914f, 0.32506754994392395f, 0.7000740766525269f, -0.6719698905944824f},
+    {0.12925997376441956f, -1.0595273971557617f, -0.19530639052391052f, 0.6767056584358215f, 0.34179776906967163f, 0.34075090289115906f, 0.7010341286659241f, -0.6921793818473816f},
+    {0.1296573430299759f, -1.0490542650222778f, -0.18840385973453522f, 0.667335569858551f, 0.3394124209880829f, 0.3576391339302063f, 0.7017603516578674f, -0.7035120725631714f},
+    {0.12454657256603241f, -1.0435158014297485f, -0.1802806407213211f, 0.657512366771698f, 0.34251588582992554f, 0.3776203393936157f, 0.7056644558906555f, -0.7279717326164246f},
+    {0.12901228666305542f, -1.0304573774337769f, -0.17715314030647278f, 0.6482789516448975f, 0.34540480375289917f, 0.40030714869499207f, 0.7079943418502808f, -0.7456596493721008f},
+    {0.12827348709106445f, -1.0258829593658447f, -0.16944603621959686f, 0.633926510810852f, 0.3577720820903778f, 0.4064860939979553f, 0.7179935574531555f, -0.7783598899841309f},
+    {0.13463550806045532f, -1.0146915912628174f, -0.16337011754512787f, 0.6209262013435364f, 0.3599720597267151f, 0.42826637625694275f, 0.7175862789154053f, -0.795609176158905f},
+    {0.13732066750526428f, -1.0118355751037598f, -0.1626461148262024f, 0.6105051636695862f, 0.3663192689418793f, 0.44020867347717285f, 0.7191497683525085f, -0.8192371726036072f},
+    {0.13802433013916016f, -0.9995096325874329f, -0.16093245148658752f, 0.5957087874412537f, 0.37149590253829956f, 0.4527635872364044f, 0.7209424376487732f, -0.8388702273368835f},
+    {0.15032321214675903f, -1.0028345584869385f, -0.16604529321193695f, 0.5913938283920288f, 0.3670840263366699f, 0.459671288728714f, 0.7152622938156128f, -0.854523241519928f},
+    {0.14787352085113525f, -0.9932747483253479f, -0.16229236125946045f, 0.578037440776825f, 0.37790974974632263f, 0.4797229766845703f, 0.7177321910858154f, -0.8673826456069946f},
+    {0.15245692431926727f, -0.9918036460876465f, -0.17043401300907135f, 0.5655080080032349f, 0.384121835231781f, 0.4886305630207062f, 0.7155535221099854f, -0.8902833461761475f},
+    {0.1572922170162201f, -0.9835237264633179f, -0.16784104704856873f, 0.551088273525238f, 0.38713082671165466f, 0.5038933157920837f, 0.7151985168457031f, -0.9011538624763489f},
+    {0.1564861387014389f, -0.9760704636573792f, -0.16612747311592102f, 0.5368017554283142f, 0.3912528455257416f, 0.5158131718635559f, 0.7172039151191711f, -0.9231939911842346f},
+    {0.16308525204658508f, -0.9665229320526123f, -0.15925608575344086f, 0.5216121077537537f, 0.3868114948272705f, 0.5249093174934387f, 0.7175679206848145f, -0.9320254921913147f},
+    {0.16445299983024597f, -0.9596880674362183f, -0.15460628271102905f, 0.5136847496032715f, 0.3941307067871094f, 0.5315852761268616f, 0.7209718227386475f, -0.9516218900680542f},
+    {0.15205271542072296f, -0.9553228616714478f, -0.1607130914926529f, 0.48687291145324707f, 0.4084751307964325f, 0.5419679284095764f, 0.714438259601593f, -0.9871180057525635f},
+    {0.15703359246253967f, -0.9460150003433228f, -0.14994916319847107f, 0.47176191210746765f, 0.41276776790618896f, 0.5413547158241272f, 0.7054062485694885f, -1.0132886171340942f},
+    {0.16554924845695496f, -0.9352939128875732f, -0.1481902152299881f, 0.4591158628463745f, 0.4175526797771454f, 0.5457445383071899f, 0.7015323638916016f, -1.0194599628448486f},
+    {0.16993990540504456f, -0.9301342964172363f, -0.14967194199562073f, 0.4418237805366516f, 0.42233017086982727f, 0.535450279712677f, 0.6967492699623108f, -1.0404764413833618f},
+    {0.17448127269744873f, -0.9250472784042358f, -0.14494481682777405f, 0.4253453314304352f, 0.42098018527030945f, 0.5407746434211731f, 0.6880338788032532f, -1.0513947010040283f},
+    {0.17719876766204834f, -0.9229360222816467f, -0.14003436267375946f, 0.41288527846336365f, 0.42964085936546326f, 0.5427095293998718f, 0.6823827028274536f, -1.0698235034942627f},
+    {0.18106798827648163f, -0.914451003074646f, -0.13398030400276184f, 0.4010608494281769f, 0.4334842562675476f, 0.5456289052963257f, 0.679058313369751f, -1.077896237373352f},
+    {0.1819225400686264f, -0.9076011776924133f, -0.13173171877861023f, 0.3907019793987274f, 0.44293105602264404f, 0.5430338978767395f, 0.6774749159812927f, -1.0955759286880493f},
+    {0.19142824411392212f, -0.8943804502487183f, -0.12181295454502106f, 0.3759341537952423f, 0.4585667550563812f, 0.5378989577293396f, 0.6734198331832886f, -1.1051868200302124f},
+    {0.1939401477575302f, -0.8867716789245605f, -0.12005795538425446f, 0.3538348972797394f, 0.4769997298717499f, 0.5361855030059814f, 0.6715788245201111f, -1.1261733770370483f},
+    {0.21850821375846863f, -0.8643383383750916f, -0.10002253949642181f, 0.3336886167526245f, 0.48510223627090454f, 0.5361230969429016f, 0.6711463332176208f, -1.1223978996276855f},
+    {0.23509462177753448f, -0.8482727408409119f, -0.0860186368227005f, 0.32032978534698486f, 0.493609756231308f, 0.5377780795097351f, 0.6727161407470703f, -1.1271430253982544f},
+    {0.24249990284442902f, -0.8387208580970764f, -0.08103825896978378f, 0.3054170608520508f, 0.5008417367935181f, 0.5395303964614868f, 0.6684116721153259f, -1.1299400329589844f},
+    {0.25183165073394775f, -0.8321383595466614f, -0.07573152333498001f, 0.291913241147995f, 0.5081756114959717f, 0.5347602963447571f, 0.666416347026825f, -1.1388230323791504f},
+    {0.25806647539138794f, -0.8229561448097229f, -0.07089465111494064f, 0.27771878242492676f, 0.5151983499526978f, 0.5345123410224915f, 0.6600397229194641f, -1.1395949125289917f},
+    {0.2668640911579132f, -0.8123183250427246f, -0.06874822825193405f, 0.2654326260089874f, 0.5263405442237854f, 0.5283086895942688f, 0.6559193730354309f, -1.1471248865127563f},
+    {0.26908475160598755f, -0.8016982674598694f, -0.06868236511945724f, 0.2512791156768799f, 0.5357850193977356f, 0.5221648812294006f, 0.6448033452033997f, -1.1558074951171875f},
+    {0.2714753746986389f, -0.7906734943389893f, -0.059270285069942474f, 0.23853889107704163f, 0.5435109734535217f, 0.510746419429779f, 0.6318517923355103f, -1.1632180213928223f},
+    {0.2775558829307556f, -0.7796911597251892f, -0.0524572916328907f, 0.21798650920391083f, 0.5531207323074341f, 0.5043440461158752f, 0.6222563982009888f, -1.162188172340393f},
+    {0.2805141806602478f, -0.7728980779647827f, -0.048574693500995636f, 0.19852152466773987f, 0.56621253490448f, 0.4888588786125183f, 0.6176654696464539f, -1.1748545169830322f},
+    {0.2832857370376587f, -0.7587720155715942f, -0.047278597950935364f, 0.1865793913602829f, 0.5816643834114075f, 0.4793298542499542f, 0.6076229214668274f, -1.1780431270599365f},
+    {0.28845974802970886f, -0.7478552460670471f, -0.04487445577979088f, 0.1717032790184021f, 0.597565770149231f, 0.46394073963165283f, 0.6028384566307068f, -1.1876492500305176f},
+    {0.29234281182289124f, -0.7273806929588318f, -0.04179088771343231f, 0.1433144211769104f, 0.6236658692359924f, 0.44926348328590393f, 0.5963664054870605f, -1.1940175294876099f},
+    {0.30096951127052307f, -0.716328501701355f, -0.040281519293785095f, 0.13050296902656555f, 0.6394467353820801f, 0.42908552289009094f, 0.5917401313781738f, -1.2010759115219116f},
+    {0.3107280731201172f, -0.7022226452827454f, -0.0343945249915123f, 0.1094399020075798f, 0.654391348361969f, 0.4166249930858612f, 0.5805544853210449f, -1.201529622077942f},
+    {0.32609161734580994f, -0.6817619800567627f, -0.023764444515109062f, 0.08424994349479675f, 0.6664706468582153f, 0.3950602412223816f, 0.573827862739563f, -1.2109241485595703f},
+    {0.33935779333114624f, -0.6719557046890259f, -0.011836481280624866f, 0.06120859459042549f, 0.6793674826622009f, 0.3767825663089752f, 0.5541637539863586f, -1.207050085067749f},
+    {0.35227730870246887f, -0.6560140252113342f, -0.009373936802148819f, 0.0304190032184124f, 0.7049041986465454f, 0.35263705253601074f, 0.5396402478218079f, -1.2089118957519531f},
+    {0.3883568346500397f, -0.6304199695587158f, -0.007873184978961945f, -0.01199350506067276f, 0.740321934223175f, 0.302697092294693f, 0.5068321824073792f, -1.2080167531967163f},
+    {0.4056171774864197f, -0.6152012348175049f, -0.005456892773509026f, -0.039141979068517685f, 0.7628692984580994f, 0.26699098944664f, 0.4955718517303467f, -1.2114372253417969f},
+    {0.41580507159233093f, -0.599798858165741f, 0.002324070315808058f, -0.056260861456394196f, 0.7771024703979492f, 0.2499220222234726f, 0.4878873825073242f, -1.2114709615707397f},
+    {0.42738503217697144f, -0.5924639701843262f, 0.008721431717276573f, -0.0731692910194397f, 0.7877829074859619f, 0.22801434993743896f, 0.47741496562957764f, -1.216353178024292f},
+    {0.44390544295310974f, -0.5750062465667725f, 0.012425088323652744f, -0.09954846650362015f, 0.8087123036384583f, 0.21352271735668182f, 0.4732775092124939f, -1.2194581031799316f},
+    {0.45603644847869873f, -0.5618584752082825f, 0.013968429528176785f, -0.1177155151963234f, 0.8277963399887085f, 0.18845200538635254f, 0.4652861952781677f, -1.2289772033691406f},
+    {0.46972501277923584f, -0.5431832671165466f, 0.018986843526363373f, -0.1360333412885666f, 0.8374096155166626f, 0.17210036516189575f, 0.45424962043762207f, -1.2276616096496582f},
+    {0.4853624105453491f, -0.52970951795578f, 0.019540663808584213f, -0.15285596251487732f, 0.8512217402458191f, 0.1491430550813675f, 0.4432285726070404f, -1.2370402812957764f},
+    {0.4975396394729614f, -0.5143008232116699f, 0.02245360054075718f, -0.16448350250720978f, 0.8590960502624512f, 0.13460245728492737f, 0.4365009069442749f, -1.2344626188278198f},
+    {0.5075173377990723f, -0.5050898194313049f, 0.023460261523723602f, -0.1808030903339386f, 0.8691145181655884f, 0.11165869235992432f, 0.4304082691669464f, -1.2415471076965332f},
+    {0.5179234147071838f, -0.4924638569355011f, 0.030319394543766975f, -0.190143421292305f, 0.8740334510803223f, 0.10117165744304657f, 0.42325499653816223f, -1.2394391298294067f},
+    {0.5247684717178345f, -0.4846714437007904f, 0.032292939722537994f, -0.19944243133068085f, 0.8797074556350708f, 0.08711627870798111f, 0.41922158002853394f, -1.2449332475662231f},
+    {0.5333658456802368f, -0.4713438153266907f, 0.0384204126894474f, -0.21339747309684753f, 0.8831601142883301f, 0.07474728673696518f, 0.41148707270622253f, -1.2423231601715088f},
+    {0.5392364263534546f, -0.4544188380241394f, 0.04568656161427498f, -0.22996339201927185f, 0.894356906414032f, 0.05654826760292053f, 0.40876877307891846f, -1.2481117248535156f},
+    {0.5497221946716309f, -0.4399307668209076f, 0.052757278084754944f, -0.23566044867038727f, 0.8974955677986145f, 0.04514693096280098f, 0.3957377076148987f, -1.2381470203399658f},
+    {0.5490755438804626f, -0.4266132712364197f, 0.05788052827119827f, -0.24887609481811523f, 0.9188146591186523f, 0.01023061852902174f, 0.37963613867759705f, -1.2429614067077637f},
+    {0.557213306427002f, -0.41330015659332275f, 0.06091716140508652f, -0.2597324848175049f, 0.9223889112472534f, -0.00461594806984067f, 0.37092629075050354f, -1.2372238636016846f},
+    {0.5669457316398621f, -0.39778608083724976f, 0.06794808804988861f, -0.2768901586532593f, 0.931168258190155f, -0.027258966118097305f, 0.36899444460868835f, -1.233449101448059f},
+    {0.5791633129119873f, -0.3766164779663086f, 0.0794123038649559f, -0.2925300896167755f, 0.9388914704322815f, -0.04377064108848572f, 0.35690632462501526f, -1.2172329425811768f},
+    {0.5818027257919312f, -0.36746639013290405f, 0.08761066198348999f, -0.304964542388916f, 0.945619523525238f, -0.06706717610359192f, 0.3519863784313202f, -1.211388349533081f},
+    {0.5904667973518372f, -0.3554099202156067f, 0.09130945801734924f, -0.31230175495147705f, 0.9475339651107788f, -0.08063558489084244f, 0.3458609879016876f, -1.203862190246582f},
+    {0.5920566916465759f, -0.34590068459510803f, 0.09117044508457184f, -0.317997008562088f, 0.9538367390632629f, -0.09451339393854141f, 0.3467424809932709f, -1.2119059562683105f},
+    {0.5997347235679626f, -0.3299926519393921f, 0.09966860711574554f, -0.3238406777381897f, 0.9526501893997192f, -0.10970713943243027f, 0.3401796817779541f, -1.200377106666565f},
+    {0.6054071187973022f, -0.3222705125808716f, 0.0996207594871521f, -0.3343566954135895f, 0.95775306224823f, -0.12828676402568817f, 0.3366325795650482f, -1.2051252126693726f},
+    {0.6184482574462891f, -0.3015589118003845f, 0.11415620148181915f, -0.3506070673465729f, 0.9557544589042664f, -0.1478802114725113f, 0.32936152815818787f, -1.1867640018463135f},
+    {0.6214096546173096f, -0.28956013917922974f, 0.11751142144203186f, -0.35519081354141235f, 0.9597917795181274f, -0.16391818225383759f, 0.32819294929504395f, -1.1897166967391968f},
+    {0.6318453550338745f, -0.27019253373146057f, 0.1253558099269867f, -0.3584211766719818f, 0.95778888463974f, -0.17258162796497345f, 0.3256109356880188f, -1.1812036037445068f},
+    {0.6614296436309814f, -0.25585702061653137f, 0.147603377699852f, -0.3432319462299347f, 0.931652843952179f, -0.19464002549648285f, 0.32591328024864197f, -1.1484400033950806f},
+    {0.6688889265060425f, -0.23814985156059265f, 0.15383782982826233f, -0.34651219844818115f, 0.9318663477897644f, -0.20782706141471863f, 0.32162463665008545f, -1.1419786214828491f},
+    {0.6745370626449585f, -0.22519779205322266f, 0.16132614016532898f, -0.3479483723640442f, 0.9341374635696411f, -0.22700004279613495f, 0.3185844123363495f, -1.139825701713562f},
+    {0.678520143032074f, -0.20820878446102142f, 0.17703884840011597f, -0.3527766466140747f, 0.9290401339530945f, -0.24082985520362854f, 0.30760514736175537f, -1.1259671449661255f},
+    {0.6818071603775024f, -0.18717928230762482f, 0.18614162504673004f, -0.3585153818130493f, 0.9316210150718689f, -0.2583542764186859f, 0.30448251962661743f, -1.1200658082962036f},
+    {0.6857199668884277f, -0.1677883267402649f, 0.1990821212530136f, -0.36186856031417847f, 0.9323726892471313f, -0.2705771028995514f, 0.3000471591949463f, -1.108535885810852f},
+    {0.6916713118553162f, -0.15679922699928284f, 0.20593787729740143f, -0.3636587858200073f, 0.9275887608528137f, -0.2885746359825134f, 0.2945883274078369f, -1.1029483079910278f},
+    {0.6923084259033203f, -0.14556556940078735f, 0.21438123285770416f, -0.36755362153053284f, 0.9206805229187012f, -0.3027241826057434f, 0.29084500670433044f, -1.0940226316452026f},
+    {0.6936512589454651f, -0.13966692984104156f, 0.23034831881523132f, -0.3748075067996979f, 0.9182221293449402f, -0.333181232213974f, 0.280843585729599f, -1.0894839763641357f},
+    {0.7001277208328247f, -0.11740945279598236f, 0.2445555478334427f, -0.3837208151817322f, 0.9209654331207275f, -0.3485129475593567f, 0.28064247965812683f, -1.083243727684021f},
+    {0.7067546248435974f, -0.10326288640499115f, 0.24952740967273712f, -0.39122429490089417f, 0.926110565662384f, -0.364665687084198f, 0.27780935168266296f, -1.0888659954071045f},
+    {0.72920823097229f, -0.08270254731178284f, 0.27160346508026123f, -0.3955594003200531f, 0.9096192121505737f, -0.38286346197128296f, 0.2655603587627411f, -1.0676051378250122f},
+    {0.7238048315048218f, -0.08049937337636948f, 0.26878637075424194f, -0.3986319601535797f, 0.908693790435791f, -0.3994210958480835f, 0.2642170488834381f, -1.0734490156173706f},
+    {0.7392927408218384f, -0.05830255150794983f, 0.29320213198661804f, -0.3929029107093811f, 0.8902313709259033f, -0.4117547571659088f, 0.26162853837013245f, -1.0401772260665894f},
+    {0.7388243675231934f, -0.04810640960931778f, 0.3011249899864197f, -0.3959001898765564f, 0.8894951343536377f, -0.4296509027481079f, 0.26091596484184265f, -1.04103684425354f},
+    {0.7398511171340942f, -0.03501465544104576f, 0.3109659254550934f, -0.39691537618637085f, 0.886032223701477f, -0.44510605931282043f, 0.2579890191555023f, -1.0323069095611572f},
+    {0.7397467494010925f, -0.02930149808526039f, 0.31897035241127014f, -0.39900368452072144f, 0.8823903203010559f, -0.46398526430130005f, 0.25704604387283325f, -1.0319246053695679f},
+    {0.7434690594673157f, -0.016545267775654793f, 0.3301238715648651f, -0.3971395194530487f, 0.8736756443977356f, -0.4787215292453766f, 0.25681719183921814f, -1.020344853401184f},
+    {0.7409002780914307f, -0.007905345410108566f, 0.3499820828437805f, -0.3949953317642212f, 0.8615230321884155f, -0.4987225830554962f, 0.24967755377292633f, -1.0153926610946655f},
+    {0.7379868030548096f, 0.003603186458349228f, 0.3608713448047638f, -0.3921586275100708f, 0.8538063764572144f, -0.5089030861854553f, 0.24599091708660126f, -1.008900761604309f},
+    {0.7324820160865784f, 0.01103760115802288f, 0.36796513199806213f, -0.38979196548461914f, 0.8518257737159729f, -0.524905264377594f, 0.24782226979732513f, -1.0101497173309326f},
+    {0.7297471165657043f, 0.02031129226088524f, 0.37855735421180725f, -0.386076956987381f, 0.8432013988494873f, -0.5370516180992126f, 0.24734321236610413f, -1.0013428926467896f},
+    {0.7244343161582947f, 0.02294057421386242f, 0.3808671534061432f, -0.3780268430709839f, 0.8440499305725098f, -0.5631211400032043f, 0.25687217712402344f, -0.9975627064704895f},
+    {0.7213401794433594f, 0.03213260695338249f, 0.3911755681037903f, -0.3765289783477783f, 0.8323072791099548f, -0.5790435671806335f, 0.25869691371917725f, -0.9898732900619507f},
+    {0.7156904935836792f, 0.036524247378110886f, 0.3953646421432495f, -0.37507888674736023f, 0.826648473739624f, -0.5957142114639282f, 0.2616818845272064f, -0.9929382801055908f},
+    {0.7134342193603516f, 0.04866093769669533f, 0.40287014842033386f, -0.3726317286491394f, 0.8189189434051514f, -0.609019935131073f, 0.263077050447464f, -0.9875653982162476f},
+    {0.7046566009521484f, 0.056062571704387665f, 0.4116218090057373f, -0.36737924814224243f, 0.8084912896156311f, -0.6257032155990601f, 0.26770129799842834f, -0.9947834610939026f},
+    {0.6932355165481567f, 0.06134072318673134f, 0.4192279279232025f, -0.3685902953147888f, 0.8007084727287292f, -0.6436788439750671f, 0.2702922821044922f, -1.0001273155212402f},
+    {0.6855157613754272f, 0.06824560463428497f, 0.4279739558696747f, -0.364018976688385f, 0.7935629487037659f, -0.671445369720459f, 0.27662014961242676f, -0.9969123005867004f},
+    {0.6791782975196838f, 0.08221989125013351f, 0.43721115589141846f, -0.3539661467075348f, 0.7835911512374878f, -0.6981859803199768f, 0.2824499309062958f, -0.9827584624290466f},
+    {0.6674709320068359f, 0.08747770637273788f, 0.44278788566589355f, -0.34242483973503113f, 0.7795795202255249f, -0.7243377566337585f, 0.28825584053993225f, -0.9814456701278687f},
+    {0.6572513580322266f, 0.09451966732740402f, 0.4508163630962372f, -0.3344290554523468f, 0.7709873914718628f, -0.7360143661499023f, 0.28931111097335815f, -0.9747239947319031f},
+    {0.649591326713562f, 0.09532029181718826f, 0.4511072337627411f, -0.3273636996746063f, 0.7619935274124146f, -0.7519212961196899f, 0.29232415556907654f, -0.9784613847732544f},
+    {0.6417925953865051f, 0.10179466009140015f, 0.45831719040870667f, -0.32018977403640747f, 0.7492774128913879f, -0.762373149394989f, 0.29508376121520996f, -0.9724672436714172f},
+    {0.6238650679588318f, 0.10311653465032578f, 0.4706119894981384f, -0.3124602138996124f, 0.7369948029518127f, -0.7878690361976624f, 0.29427841305732727f, -0.9717141389846802f},
+    {0.6153408885002136f, 0.11047927290201187f, 0.4774807393550873f, -0.3031650483608246f, 0.7219088077545166f, -0.7985423803329468f, 0.2997533679008484f, -0.9606253504753113f},
+    {0.6012592315673828f, 0.11548646539449692f, 0.4893893301486969f, -0.2992643713951111f, 0.7069793343544006f, -0.8145359754562378f, 0.3056392967700958f, -0.9556556940078735f},
+    {0.5912320613861084f, 0.12009258568286896f, 0.49656781554222107f, -0.2868020832538605f, 0.688673734664917f, -0.8276790380477905f, 0.31182098388671875f, -0.9490096569061279f},
+    {0.5791719555854797f, 0.12042764574289322f, 0.5000848174095154f, -0.2778741419315338f, 0.6749681830406189f, -0.8419336676597595f, 0.3187982439994812f, -0.9513372182846069f},
+    {0.5776390433311462f, 0.12938044965267181f, 0.5157673358917236f, -0.2647956609725952f, 0.6509432196617126f, -0.849086344242096f, 0.3246934413909912f, -0.934978723526001f},
+    {0.5607432723045349f, 0.13196192681789398f, 0.5263742804527283f, -0.2574300467967987f, 0.6382560729980469f, -0.8575108051300049f, 0.3357209265232086f, -0.9365007877349854f},
+    {0.5469496846199036f, 0.1367405205965042f, 0.5349592566490173f, -0.2472543567419052f, 0.6195804476737976f, -0.8625932931900024f, 0.34604161977767944f, -0.9302864670753479f},
+    {0.5314159989356995f, 0.14194805920124054f, 0.5390857458114624f, -0.23876263201236725f, 0.6055384278297424f, -0.8679433465003967f, 0.3558955192565918f, -0.9301864504814148f},
+    {0.5226829051971436f, 0.15060682594776154f, 0.543781042098999f, -0.22596067190170288f, 0.5897839069366455f, -0.8788403272628784f, 0.35919150710105896f, -0.9198815822601318f},
+    {0.5064907073974609f, 0.1538536697626114f, 0.5432182550430298f, -0.21031488478183746f, 0.5770294666290283f, -0.8864892721176147f, 0.36883220076560974f, -0.9166999459266663f},
+    {0.49828046560287476f, 0.16100004315376282f, 0.5507970452308655f, -0.19313497841358185f, 0.5529130101203918f, -0.8917170763015747f, 0.37538865208625793f, -0.8986372947692871f},
+    {0.4928147494792938f, 0.16485320031642914f, 0.5615742206573486f, -0.18052887916564941f, 0.5286003947257996f, -0.9021633863449097f, 0.38185128569602966f, -0.885258674621582f},
+    {0.4798201620578766f, 0.16968408226966858f, 0.5722017288208008f, -0.16180455684661865f, 0.507032036781311f, -0.9135725498199463f, 0.3848324716091156f, -0.8667475581169128f},
+    {0.4731748700141907f, 0.17651647329330444f, 0.5841799974441528f, -0.14164243638515472f, 0.48427197337150574f, -0.925530195236206f, 0.3912155330181122f, -0.8452202677726746f},
+    {0.4596785604953766f, 0.17513684928417206f, 0.5885255932807922f, -0.12914885580539703f, 0.4663410186767578f, -0.9382025599479675f, 0.39146313071250916f, -0.8337259888648987f},
+    {0.45515525341033936f, 0.18449687957763672f, 0.6041479706764221f, -0.10871852189302444f, 0.4373537600040436f, -0.946768045425415f, 0.40015310049057007f, -0.8121471405029297f},
+    {0.4443954825401306f, 0.18773864209651947f, 0.6048631072044373f, -0.09685063362121582f, 0.4199569821357727f, -0.9512606859207153f, 0.4027659595012665f, -0.8062805533409119f},
+    {0.42986994981765747f, 0.19090819358825684f, 0.6118210554122925f, -0.08297844231128693f, 0.3986753225326538f, -0.9552630186080933f, 0.4147913455963135f, -0.799990713596344f},
+    {0.41156890988349915f, 0.1907045692205429f, 0.6136149168014526f, -0.07323870807886124f, 0.3819156289100647f, -0.9575871825218201f, 0.42588892579078674f, -0.796657145023346f},
+    {0.39912375807762146f, 0.19427935779094696f, 0.6171162128448486f, -0.06143736466765404f, 0.3638094961643219f, -0.9671033024787903f, 0.4323583245277405f, -0.7877110242843628f},
+    {0.3847229480743408f, 0.19258183240890503f, 0.6138420701026917f, -0.05574677884578705f, 0.34991511702537537f, -0.9714246392250061f, 0.4384327828884125f, -0.7867981791496277f},
+    {0.3767988979816437f, 0.1909417062997818f, 0.6154265403747559f, -0.048106905072927475f, 0.32658499479293823f, -0.984817624092102f, 0.44760867953300476f, -0.78202223777771f},
+    {0.35976287722587585f, 0.19167868793010712f, 0.6124296188354492f, -0.04383915662765503f, 0.31359660625457764f, -0.9882723689079285f, 0.4518776535987854f, -0.7817528247833252f},
+    {0.34480586647987366f, 0.1926964521408081f, 0.6084761023521423f, -0.03532535955309868f, 0.29799512028694153f, -0.994748055934906f, 0.45448702573776245f, -0.7761125564575195f},
+    {0.3246847093105316f, 0.19677723944187164f, 0.6039720773696899f, -0.02589466981589794f, 0.28202536702156067f, -0.9919933080673218f, 0.4651813507080078f, -0.7768246531486511f},
+    {0.3101629614830017f, 0.20543120801448822f, 0.6073949337005615f, -0.010417872108519077f, 0.2586287260055542f, -0.9911343455314636f, 0.47810280323028564f, -0.7666401267051697f},
+    {0.3017931580543518f, 0.21439450979232788f, 0.606563925743103f, 0.0037808266934007406f, 0.24119620025157928f, -0.9874089956283569f, 0.48422420024871826f, -0.7560186386108398f},
+    {0.29888907074928284f, 0.2171487957239151f, 0.6047888398170471f, 0.01801871322095394f, 0.21965347230434418f, -0.9922705292701721f, 0.49195000529289246f, -0.7429069876670837f},
+    {0.287533700466156f, 0.213377445936203f, 0.6008843779563904f, 0.02970912680029869f, 0.20703087747097015f, -0.9959444999694824f, 0.4966796040534973f, -0.7381021976470947f},
+    {0.2728133499622345f, 0.21277476847171783f, 0.608015775680542f, 0.03860514983534813f, 0.18676738440990448f, -1.00039541721344f, 0.5002502799034119f, -0.7279958128929138f},
+    {0.2570447027683258f, 0.20740699768066406f, 0.6042336225509644f, 0.04468855634331703f, 0.17301760613918304f, -1.0009137392044067f, 0.5040891766548157f, -0.7244574427604675f},
+    {0.2446710169315338f, 0.20448194444179535f, 0.6112483143806458f, 0.053029946982860565f, 0.14897771179676056f, -1.0046619176864624f, 0.5118999481201172f, -0.7103304862976074f},
+    {0.2308613657951355f, 0.19617855548858643f, 0.6095012426376343f, 0.059622444212436676f, 0.12702080607414246f, -1.0100246667861938f, 0.5184895396232605f, -0.699195384979248f},
+    {0.22020845115184784f, 0.18921887874603271f, 0.6112327575683594f, 0.06864886730909348f, 0.10004723817110062f, -1.0155006647109985f, 0.5251815915107727f, -0.6877475380897522f},
+    {0.20142555236816406f, 0.18296268582344055f, 0.607393741607666f, 0.07347257435321808f, 0.08759426325559616f, -1.0158296823501587f, 0.5300462245941162f, -0.684478223323822f},
+    {0.19108706712722778f, 0.17746412754058838f, 0.6068087220191956f, 0.07732900977134705f, 0.06764789670705795f, -1.0191386938095093f, 0.5358254313468933f, -0.6757482886314392f},
+    {0.17801572382450104f, 0.16907477378845215f, 0.6059879064559937f, 0.08679519593715668f, 0.05094996094703674f, -1.0211079120635986f, 0.5449385046958923f, -0.6711555123329163f},
+    {0.16989929974079132f, 0.1638673096895218f, 0.6067155003547668f, 0.09463877230882645f, 0.030471689999103546f, -1.0241260528564453f, 0.5527578592300415f, -0.6605831980705261f},
+    {0.16165371239185333f, 0.15734021365642548f, 0.6043539643287659f, 0.10164394974708557f, 0.013945079408586025f, -1.020449161529541f, 0.5583705902099609f, -0.6549625992774963f},
+    {0.14920394122600555f, 0.15265895426273346f, 0.6030910015106201f, 0.10824095457792282f, -0.004225636832416058f, -1.0184812545776367f, 0.5625980496406555f, -0.6470614075660706f},
+    {0.1344136744737625f, 0.14311011135578156f, 0.5979260802268982f, 0.11609213054180145f, -0.021756673231720924f, -1.0146418809890747f, 0.5653479695320129f, -0.6404874920845032f},
+    {0.12474368512630463f, 0.14688856899738312f, 0.6026912927627563f, 0.128579244017601f, -0.04736020416021347f, -1.0036238431930542f, 0.5713412165641785f, -0.6177355647087097f},
+    {0.12125831842422485f, 0.14476636052131653f, 0.6015015840530396f, 0.14198414981365204f, -0.06774237006902695f, -1.001067876815796f, 0.5728214383125305f, -0.5990615487098694f},
+    {0.11279436200857162f, 0.14118696749210358f, 0.5958613753318787f, 0.1443643569946289f, -0.07982044667005539f, -1.001526117324829f, 0.5753058195114136f, -0.5923502445220947f},
+    {0.09783531725406647f, 0.1316504329442978f, 0.5886533260345459f, 0.1533745974302292f, -0.0944213718175888f, -0.9977350831031799f, 0.5787523984909058f, -0.5889871716499329f},
+    {0.08632921427488327f, 0.1254454255104065f, 0.5878080129623413f, 0.15707990527153015f, -0.11446453630924225f, -0.998094379901886f, 0.5841337442398071f, -0.578273355960846f},
+    {0.07293137907981873f, 0.1182030662894249f, 0.5746095180511475f, 0.16106706857681274f, -0.12345277518033981f, -0.9939009547233582f, 0.5889644622802734f, -0.5786500573158264f},
+    {0.05803197622299194f, 0.11229026317596436f, 0.5706163048744202f, 0.16679181158542633f, -0.1428879201412201f, -0.9814498424530029f, 0.5902983546257019f, -0.5604240298271179f},
+    {0.051850322633981705f, 0.11174992471933365f, 0.5634028315544128f, 0.17957866191864014f, -0.164511039853096f, -0.967056393623352f, 0.5955756902694702f, -0.5447980761528015f},
+    {0.04952205717563629f, 0.11209888756275177f, 0.5658180713653564f, 0.19381183385849f, -0.1906643509864807f, -0.9549482464790344f, 0.5981831550598145f, -0.5161393284797668f},
+    {0.039831455796957016f, 0.10991907864809036f, 0.5675787925720215f, 0.20840127766132355f, -0.21140284836292267f, -0.9456971883773804f, 0.5989315509796143f, -0.49030712246894836f},
+    {0.028042925521731377f, 0.10476323217153549f, 0.5667848587036133f, 0.21817103028297424f, -0.23228341341018677f, -0.9399513602256775f, 0.6006999611854553f, -0.4711568057537079f},
+    {0.014880609698593616f, 0.08624425530433655f, 0.5543892979621887f, 0.2211804836988449f, -0.24111777544021606f, -0.937218189239502f, 0.6014564037322998f, -0.4730527997016907f},
+    {0.010428432375192642f, 0.08291205763816833f, 0.5462290048599243f, 0.22005392611026764f, -0.2538317143917084f, -0.9282418489456177f, 0.5990939140319824f, -0.45575809478759766f},
+    {0.042856503278017044f, 0.10055296123027802f, 0.5641523003578186f, 0.25765490531921387f, -0.31168192625045776f, -0.8998361825942993f, 0.5980950593948364f, -0.3885616064071655f},
+    {0.04041143134236336f, 0.08966805040836334f, 0.5552526116371155f, 0.26071199774742126f, -0.33124348521232605f, -0.8930754065513611f, 0.5955374836921692f, -0.37460994720458984f},
+    {0.04434964805841446f, 0.08022910356521606f, 0.5533249378204346f, 0.27561163902282715f, -0.35217931866645813f, -0.8793542385101318f, 0.5957991480827332f, -0.3523251414299011f},
+    {0.044707443565130234f, 0.06805077940225601f, 0.5515307188034058f, 0.28194767236709595f, -0.3698097765445709f, -0.8685003519058228f, 0.5924001336097717f, -0.33821526169776917f},
+    {0.036722566932439804f, 0.057987961918115616f, 0.5407935976982117f, 0.2807810604572296f, -0.382928729057312f, -0.8564674258232117f, 0.5926907062530518f, -0.33603835105895996f},
+    {0.027427200227975845f, 0.048721589148044586f, 0.5380265116691589f, 0.27735456824302673f, -0.4026159346103668f, -0.8415071964263916f, 0.5931063294410706f, -0.326237291097641f},
+    {0.01909499242901802f, 0.03395175188779831f, 0.5261624455451965f, 0.272611528635025f, -0.41794681549072266f, -0.8330808281898499f, 0.5929145812988281f, -0.3185236155986786f},
+    {0.014125309884548187f, 0.028823494911193848f, 0.5193806886672974f, 0.26829513907432556f, -0.43260839581489563f, -0.8177209496498108f, 0.5921365022659302f, -0.3042115271091461f},
+    {0.017185410484671593f, 0.023689134046435356f, 0.5145817995071411f, 0.26983773708343506f, -0.449812650680542f, -0.8026412129402161f, 0.5877706408500671f, -0.2803974449634552f},
+    {0.011183077469468117f, 0.013562276028096676f, 0.5061905980110168f, 0.2622673809528351f, -0.4610694944858551f, -0.7915850877761841f, 0.581248939037323f, -0.26602903008461f},
+    {0.004667448811233044f, -0.010095542296767235f, 0.4933837354183197f, 0.24669131636619568f, -0.4735868573188782f, -0.7890502214431763f, 0.5693802833557129f, -0.25470706820487976f},
+    {-0.004351179115474224f, -0.02038882113993168f, 0.46726706624031067f, 0.2411026954650879f, -0.48610445857048035f, -0.774847686290741f, 0.5644927620887756f, -0.2511409521102905f},
+    {-0.011272785253822803f, -0.0267590694129467f, 0.45246583223342896f, 0.23801380395889282f, -0.4871261417865753f, -0.7604690790176392f, 0.5617908835411072f, -0.2495439648628235f},
+    {-0.01332986168563366f, -0.031649403274059296f, 0.4450775682926178f, 0.23123399913311005f, -0.495455801486969f, -0.7448096871376038f, 0.5561172962188721f, -0.23381400108337402f},
+    {-0.013175779022276402f, -0.038277383893728256f, 0.43585243821144104f, 0.22325493395328522f, -0.5018652081489563f, -0.7275998592376709f, 0.546646237373352f, -0.21996954083442688f},
+    {-0.014819442294538021f, -0.04789266362786293f, 0.42524924874305725f, 0.21025203168392181f, -0.5012121200561523f, -0.7082867622375488f, 0.5333067774772644f, -0.20935270190238953f},
+    {-0.01954452320933342f, -0.06215507164597511f, 0.41077888011932373f, 0.19539125263690948f, -0.5070689916610718f, -0.6982007026672363f, 0.5240445733070374f, -0.19750528037548065f},
+    {-0.022603793069720268f, -0.06990864127874374f, 0.39959144592285156f, 0.18111662566661835f, -0.5061112642288208f, -0.6877766251564026f, 0.5195491909980774f, -0.18985474109649658f},
+    {-0.01944376714527607f, -0.07690541446208954f, 0.39038950204849243f, 0.17278459668159485f, -0.5014129877090454f, -0.6707661747932434f, 0.510200560092926f, -0.16857169568538666f},
+    {-0.01843150146305561f, -0.08059190213680267f, 0.3877844214439392f, 0.16419091820716858f, -0.5012810230255127f, -0.6476186513900757f, 0.4991653561592102f, -0.14363324642181396f},
+    {-0.015245153568685055f, -0.08178030699491501f, 0.3821831941604614f, 0.15771633386611938f, -0.4962502419948578f, -0.6313029527664185f, 0.48652729392051697f, -0.12201936542987823f},
+    {-0.015558989718556404f, -0.08627153933048248f, 0.37467193603515625f, 0.14451615512371063f, -0.4902644455432892f, -0.6132514476776123f, 0.47466450929641724f, -0.10455963760614395f},
+    {-0.01985461264848709f, -0.09596472978591919f, 0.3633580803871155f, 0.13115675747394562f, -0.4807906150817871f, -0.59769207239151f, 0.4646207392215729f, -0.09670327603816986f},
+    {-0.019343961030244827f, -0.10137099772691727f, 0.35330578684806824f, 0.11944396793842316f, -0.4728644788265228f, -0.5796381235122681f, 0.45196211338043213f, -0.07853477448225021f},
+    {-0.01887323707342148f, -0.10580355674028397f, 0.34133490920066833f, 0.10789861530065536f, -0.4558303952217102f, -0.5622191429138184f, 0.4380066990852356f, -0.06894441694021225f},
+    {-0.011334951967000961f, -0.10756225138902664f, 0.3341935873031616f, 0.09753216058015823f, -0.4424635171890259f, -0.5421926975250244f, 0.4235035479068756f, -0.04441307112574577f},
+    {-0.005464496091008186f, -0.11158841848373413f, 0.32226791977882385f, 0.093708336353302f, -0.4241843521595001f, -0.5201458930969238f, 0.4017670452594757f, -0.02747655287384987f},
+    {-0.00012251490261405706f, -0.11186889559030533f, 0.31238824129104614f, 0.08603089302778244f, -0.4069210886955261f, -0.49738943576812744f, 0.3849506676197052f, -0.0105529660359025f},
+    {0.0016529967542737722f, -0.11241040378808975f, 0.299845814704895f, 0.08303552120923996f, -0.38568034768104553f, -0.4780454635620117f, 0.36586734652519226f, 0.0010523933451622725f},
+    {0.0086258165538311f, -0.11029409617185593f, 0.28591281175613403f, 0.0760853961110115f, -0.36126574873924255f, -0.4512700140476227f, 0.34449177980422974f, 0.012543394230306149f},
+    {0.01042149681597948f, -0.11167758703231812f, 0.2809070348739624f, 0.07174576073884964f, -0.3370724320411682f, -0.42536067962646484f, 0.3194545805454254f, 0.02021511271595955f},
+    {0.018189687281847f, -0.10677535086870193f, 0.26155567169189453f, 0.05941024422645569f, -0.3082767426967621f, -0.38624921441078186f, 0.28613799810409546f, 0.028415722772479057f},
+    {0.03491980955004692f, -0.09228593111038208f, 0.2250501960515976f, 0.043492332100868225f, -0.2277519553899765f, -0.3236808776855469f, 0.22693635523319244f, 0.04642796143889427f},
+    {0.024263212457299232f, -0.054741259664297104f, 0.1306653767824173f, 0.03853192552924156f, -0.15763503313064575f, -0.1714523732662201f, 0.11252526938915253f, 0.029635939747095108f}
+}};
+static constexpr std::array<float, 600> biases = {
+    0.10315033793449402f,
+    0.16453203558921814f,
+    0.20419315993785858f,
+    0.2372640073299408f,
+    0.2634998559951782f,
+    0.28764814138412476f,
+    0.3092195689678192f,
+    0.3297305703163147f,
+    0.34882065653800964f,
+    0.3678368926048279f,
+    0.38528546690940857f,
+    0.40057238936424255f,
+    0.4180772304534912f,
+    0.4328465461730957f,
+    0.4472884237766266f,
+    0.45908135175704956f,
+    0.473237007856369f,
+    0.4838467836380005f,
+    0.4962819218635559f,
+    0.5067028999328613f,
+    0.5177538990974426f,
+    0.5265982747077942f,
+    0.5346825122833252f,
+    0.544042706489563f,
+    0.5527054071426392f,
+    0.5613375902175903f,
+    0.5690299272537231f,
+    0.5751580595970154f,
+    0.578043520450592f,
+    0.582988440990448f,
+    0.587859570980072f,
+    0.5885695815086365f,
+    0.5916042327880859f,
+    0.5938692092895508f,
+    0.595223605632782f,
+    0.5956096649169922f,
+    0.5942227840423584f,
+    0.5967566967010498f,
+    0.597881019115448f,
+    0.5962600708007812f,
+    0.5962561368942261f,
+    0.5954697728157043f,
+    0.5951933860778809f,
+    0.5917807221412659f,
+    0.5908125042915344f,
+    0.5882386565208435f,
+    0.586729109287262f,
+    0.5861556529998779f,
+    0.5850293636322021f,
+    0.5838743448257446f,
+    0.5809717178344727f,
+    0.5808951258659363f,
+    0.5798918604850769f,
+    0.5795924067497253f,
+    0.5781405568122864f,
+    0.5758519768714905f,
+    0.5740320086479187f,
+    0.56983882188797f,
+    0.5668953061103821f,
+    0.5617659091949463f,
+    0.5568665862083435f,
+    0.5524049997329712f,
+    0.5482416749000549f,
+    0.5405260920524597f,
+    0.5335583090782166f,
+    0.5292434692382812f,
+    0.5252640843391418f,
+    0.5205775499343872f,
+    0.5176025032997131f,
+    0.5146294832229614f,
+    0.5123547315597534f,
+    0.5091605186462402f,
+    0.5054313540458679f,
+    0.5006427764892578f,
+    0.4966813325881958f,
+    0.49178045988082886f,
+    0.48928892612457275f,
+    0.48520374298095703f,
+    0.48194006085395813f,
+    0.47838515043258667f,
+    0.47350046038627625f,
+    0.46909964084625244f,
+    0.46413934230804443f,
+    0.45888668298721313f,
+    0.45467033982276917f,
+    0.44866177439689636f,
+    0.44608598947525024f,
+    0.4406302273273468f,
+    0.4355485737323761f,
+    0.4294077455997467f,
+    0.42375898361206055f,
+    0.4169231355190277f,
+    0.41200143098831177f,
+    0.40573009848594666f,
+    0.39899155497550964f,
+    0.39155149459838867f,
+    0.38636744022369385f,
+    0.3811301589012146f,
+    0.37472033500671387f,
+    0.3665448725223541f,
+    0.36332255601882935f,
+    0.3592175841331482f,
+    0.35467422008514404f,
+    0.3503144085407257f,
+    0.3457101881504059f,
+    0.34376591444015503f,
+    0.3398957848548889f,
+    0.3371642827987671f,
+    0.33219990134239197f,
+    0.3296102285385132f,
+    0.3232007324695587f,
+    0.31961676478385925f,
+    0.31663596630096436f,
+    0.31367844343185425f,
+    0.31072574853897095f,
+    0.3090851306915283f,
+    0.30425825715065f,
+    0.3017904758453369f,
+    0.2977007329463959f,
+    0.29441404342651367f,
+    0.2888835370540619f,
+    0.28657329082489014f,
+    0.28000620007514954f,
+    0.2763863205909729f,
+    0.2714214622974396f,
+    0.2684504985809326f,
+    0.26600587368011475f,
+    0.26461875438690186f,
+    0.260891854763031f,
+    0.2607971727848053f,
+    0.2569907605648041f,
+    0.2557205557823181f,
+    0.25273001194000244f,
+    0.2510710656642914f,
+    0.2469453662633896f,
+    0.2455260157585144f,
+    0.24202457070350647f,
+    0.23965542018413544f,
+    0.23807966709136963f,
+    0.23486630618572235f,
+    0.2315305471420288f,
+    0.23054955899715424f,
+    0.2282336950302124f,
+    0.227050319314003f,
+    0.22409947216510773f,
+    0.2241053283214569f,
+    0.22262324392795563f,
+    0.22279874980449677f,
+    0.21990913152694702f,
+    0.22062984108924866f,
+    0.2157617211341858f,
+    0.21599484980106354f,
+    0.21675856411457062f,
+    0.21911820769309998f,
+    0.21673189103603363f,
+    0.21778668463230133f,
+    0.2172991931438446f,
+    0.21597331762313843f,
+    0.21332338452339172f,
+    0.21209755539894104f,
+    0.20925049483776093f,
+    0.2054566740989685f,
+    0.20381183922290802f,
+    0.2019760012626648f,
+    0.1985267549753189f,
+    0.19530507922172546f,
+    0.19467075169086456f,
+    0.19398804008960724f,
+    0.1932464838027954f,
+    0.19335748255252838f,
+    0.19223466515541077f,
+    0.19084219634532928f,
+    0.18862783908843994f,
+    0.18187399208545685f,
+    0.17326274514198303f,
+    0.16990084946155548f,
+    0.16796612739562988f,
+    0.16615603864192963f,
+    0.16596229374408722f,
+    0.16452287137508392f,
+    0.162812277674675f,
+    0.16240185499191284f,
+    0.1610657125711441f,
+    0.15735863149166107f,
+    0.15447336435317993f,
+    0.1517878770828247f,
+    0.14963336288928986f,
+    0.14603129029273987f,
+    0.14495499432086945f,
+    0.14356128871440887f,
+    0.13923218846321106f,
+    0.13408604264259338f,
+    0.13170595467090607f,
+    0.12683291733264923f,
+    0.12403042614459991f,
+    0.1188523918390274f,
+    0.11216839402914047f,
+    0.1097722202539444f,
+    0.1068606749176979f,
+    0.10565025359392166f,
+    0.10530440509319305f,
+    0.10342453420162201f,
+    0.10128657519817352f,
+    0.09900666028261185f,
+    0.09761794656515121f,
+    0.09534431993961334f,
+    0.09359626471996307f,
+    0.09150685369968414f,
+    0.08887087553739548f,
+    0.08681689947843552f,
+    0.08568837493658066f,
+    0.0840100646018982f,
+    0.08164699375629425f,
+    0.08000224083662033f,
+    0.07949668914079666f,
+    0.07800690084695816f,
+    0.0792773887515068f,
+    0.07770319283008575f,
+    0.07811349630355835f,
+    0.07667985558509827f,
+    0.07717593759298325f,
+    0.07506128400564194f,
+    0.07543253898620605f,
+    0.0731888860464096f,
+    0.07108046859502792f,
+    0.07125764340162277f,
+    0.07291127741336823f,
+    0.07126069813966751f,
+    0.070250503718853f,
+    0.06968135386705399f,
+    0.0700816810131073f,
+    0.07019796222448349f,
+    0.06845568120479584f,
+    0.06923162192106247f,
+    0.06742941588163376f,
+    0.064407579600811f,
+    0.06626564264297485f,
+    0.06331544369459152f,
+    0.062114253640174866f,
+    0.06212928891181946f,
+    0.06306231021881104f,
+    0.05978141725063324f,
+    0.057807791978120804f,
+    0.054846156388521194f,
+    0.0547652505338192f,
+    0.053017765283584595f,
+    0.05336243286728859f,
+    0.051792632788419724f,
+    0.05093446746468544f,
+    0.05071652680635452f,
+    0.05116776376962662f,
+    0.05127938836812973f,
+    0.05017809197306633f,
+    0.04970690608024597f,
+    0.05101187527179718f,
+    0.052737314254045486f,
+    0.05105341970920563f,
+    0.05253693461418152f,
+    0.050557803362607956f,
+    0.050721120089292526f,
+    0.04765872657299042f,
+    0.048921987414360046f,
+    0.04847247898578644f,
+    0.05160786956548691f,
+    0.054599665105342865f,
+    0.05464477837085724f,
+    0.05314135551452637f,
+    0.05454675480723381f,
+    0.05312219262123108f,
+    0.053747568279504776f,
+    0.05066803842782974f,
+    0.0502573698759079f,
+    0.04841392859816551f,
+    0.04758184403181076f,
+    0.04654405266046524f,
+    0.047045912593603134f,
+    0.04538242518901825f,
+    0.04744299128651619f,
+    0.04639662057161331f,
+    0.047509316354990005f,
+    0.04071184992790222f,
+    0.03748808801174164f,
+    0.03509562835097313f,
+    0.0388881117105484f,
+    0.03373569995164871f,
+    0.03414716571569443f,
+    0.03473328799009323f,
+    0.037104640156030655f,
+    0.036035533994436264f,
+    0.03850396350026131f,
+    0.03570910543203354f,
+    0.03812435641884804f,
+    0.03760601580142975f,
+    0.03837875649333f,
+    0.035709358751773834f,
+    0.037167858332395554f,
+    0.03573453798890114f,
+    0.036561090499162674f,
+    0.039045680314302444f,
+    0.03966081142425537f,
+    0.024445706978440285f,
+    0.02339063584804535f,
+    0.026771416887640953f,
+    0.029577938839793205f,
+    0.028287097811698914f,
+    0.031631503254175186f,
+    0.03428972139954567f,
+    0.03706004470586777f,
+    0.03612874448299408f,
+    0.037824731320142746f,
+    0.033974792808294296f,
+    0.02936423011124134f,
+    0.02350676618516445f,
+    0.022068647667765617f,
+    0.019889289513230324f,
+    0.019040456041693687f,
+    0.01886763982474804f,
+    0.019824014976620674f,
+    0.014908285811543465f,
+    0.011736137792468071f,
+    0.007460397202521563f,
+    0.006493294145911932f,
+    0.003309021471068263f,
+    0.0029235135298222303f,
+    -0.0010659077670425177f,
+    -0.0021547838114202023f,
+    -0.004894424695521593f,
+    -0.006060494109988213f,
+    -0.007541902828961611f,
+    -0.006175077520310879f,
+    -0.00933678075671196f,
+    -0.010531771928071976f,
+    -0.01289078313857317f,
+    -0.013533363118767738f,
+    -0.016066530719399452f,
+    -0.017013657838106155f,
+    -0.023150818422436714f,
+    -0.021724559366703033f,
+    -0.024937624111771584f,
+    -0.02715337835252285f,
+    -0.02855108678340912f,
+    -0.03273766115307808f,
+    -0.035186801105737686f,
+    -0.03595253452658653f,
+    -0.03846672177314758f,
+    -0.04088730365037918f,
+    -0.045291051268577576f,
+    -0.04614473506808281f,
+    -0.048889826983213425f,
+    -0.05184276029467583f,
+    -0.05575527995824814f,
+    -0.05711369588971138f,
+    -0.05965699627995491f,
+    -0.06153222918510437f,
+    -0.06576729565858841f,
+    -0.07125797122716904f,
+    -0.07744801044464111f,
+    -0.08033640682697296f,
+    -0.08378538489341736f,
+    -0.08583671599626541f,
+    -0.08856574445962906f,
+    -0.09132998436689377f,
+    -0.09399761259555817f,
+    -0.09659551829099655f,
+    -0.09926711022853851f,
+    -0.10251093655824661f,
+    -0.10498989373445511f,
+    -0.10594294220209122f,
+    -0.1066499575972557f,
+    -0.10731834173202515f,
+    -0.10695776343345642f,
+    -0.1081109270453453f,
+    -0.10783383250236511f,
+    -0.10945866256952286f,
+    -0.11103134602308273f,
+    -0.11124593019485474f,
+    -0.11147525161504745f,
+    -0.111996129155159f,
+    -0.11257762461900711f,
+    -0.11389879882335663f,
+    -0.11417870223522186f,
+    -0.1156567707657814f,
+    -0.11560790985822678f,
+    -0.11816742271184921f,
+    -0.11986666172742844f,
+    -0.12295263260602951f,
+    -0.1257096230983734f,
+    -0.12784487009048462f,
+    -0.12864381074905396f,
+    -0.1298271119594574f,
+    -0.1303713023662567f,
+    -0.12958602607250214f,
+    -0.13028578460216522f,
+    -0.1316699981689453f,
+    -0.13092762231826782f,
+    -0.1323726922273636f,
+    -0.1317058652639389f,
+    -0.13374383747577667f,
+    -0.1341692954301834f,
+    -0.13330279290676117f,
+    -0.13344919681549072f,
+    -0.13183070719242096f,
+    -0.1318976879119873f,
+    -0.13185657560825348f,
+    -0.13323162496089935f,
+    -0.13290217518806458f,
+    -0.1344314068555832f,
+    -0.13561521470546722f,
+    -0.1378755420446396f,
+    -0.1392914205789566f,
+    -0.14302822947502136f,
+    -0.1398121863603592f,
+    -0.14089637994766235f,
+    -0.13959747552871704f,
+    -0.14306840300559998f,
+    -0.14501163363456726f,
+    -0.1471039354801178f,
+    -0.1459886133670807f,
+    -0.14806507527828217f,
+    -0.14767277240753174f,
+    -0.1502665877342224f,
+    -0.149766743183136f,
+    -0.1486237496137619f,
+    -0.14691920578479767f,
+    -0.14738322794437408f,
+    -0.1463288515806198f,
+    -0.14895951747894287f,
+    -0.14783185720443726f,
+    -0.1502005159854889f,
+    -0.14901131391525269f,
+    -0.1513940840959549f,
+    -0.15099436044692993f,
+    -0.15559795498847961f,
+    -0.15627792477607727f,
+    -0.15887196362018585f,
+    -0.1578451544046402f,
+    -0.1592550128698349f,
+    -0.157365620136261f,
+    -0.1579235941171646f,
+    -0.1581801176071167f,
+    -0.16108813881874084f,
+    -0.1589304357767105f,
+    -0.15832316875457764f,
+    -0.15411964058876038f,
+    -0.155080184340477f,
+    -0.15124376118183136f,
+    -0.15220335125923157f,
+    -0.15223215520381927f,
+    -0.15185852348804474f,
+    -0.15290381014347076f,
+    -0.1518433839082718f,
+    -0.14844559133052826f,
+    -0.147793248295784f,
+    -0.14306817948818207f,
+    -0.14455416798591614f,
+    -0.14240793883800507f,
+    -0.14495038986206055f,
+    -0.14415660500526428f,
+    -0.1452837884426117f,
+    -0.1447739601135254f,
+    -0.14580823481082916f,
+    -0.144361674785614f,
+    -0.14727267622947693f,
+    -0.1478012055158615f,
+    -0.15066982805728912f,
+    -0.14719825983047485f,
+    -0.14888520538806915f,
+    -0.14927400648593903f,
+    -0.15241728723049164f,
+    -0.15206290781497955f,
+    -0.15510563552379608f,
+    -0.15381209552288055f,
+    -0.15849918127059937f,
+    -0.15908882021903992f,
+    -0.1672419309616089f,
+    -0.1667497456073761f,
+    -0.16955870389938354f,
+    -0.17330555617809296f,
+    -0.17527282238006592f,
+    -0.1749834567308426f,
+    -0.1811438351869583f,
+    -0.18339763581752777f,
+    -0.18627391755580902f,
+    -0.19058048725128174f,
+    -0.19565770030021667f,
+    -0.19630540907382965f,
+    -0.19770881533622742f,
+    -0.19638951122760773f,
+    -0.20105044543743134f,
+    -0.20112714171409607f,
+    -0.20866866409778595f,
+    -0.21044409275054932f,
+    -0.21414388716220856f,
+    -0.21489842236042023f,
+    -0.2199772447347641f,
+    -0.2225860357284546f,
+    -0.22602145373821259f,
+    -0.22557222843170166f,
+    -0.22893096506595612f,
+    -0.23086069524288177f,
+    -0.23506203293800354f,
+    -0.2357613891363144f,
+    -0.23946110904216766f,
+    -0.2412387877702713f,
+    -0.24565714597702026f,
+    -0.24781343340873718f,
+    -0.25236231088638306f,
+    -0.25270307064056396f,
+    -0.2568438947200775f,
+    -0.25915220379829407f,
+    -0.2630951702594757f,
+    -0.2667573094367981f,
+    -0.2712041139602661f,
+    -0.27543601393699646f,
+    -0.2806479334831238f,
+    -0.28259679675102234f,
+    -0.28830575942993164f,
+    -0.29038166999816895f,
+    -0.2955043315887451f,
+    -0.2981780767440796f,
+    -0.30203112959861755f,
+    -0.30314087867736816f,
+    -0.30915743112564087f,
+    -0.31397855281829834f,
+    -0.31947606801986694f,
+    -0.32343795895576477f,
+    -0.32450008392333984f,
+    -0.330777645111084f,
+    -0.33438166975975037f,
+    -0.338162899017334f,
+    -0.3418269455432892f,
+    -0.34451496601104736f,
+    -0.34707215428352356f,
+    -0.35268354415893555f,
+    -0.35500210523605347f,
+    -0.3573606014251709f,
+    -0.35788848996162415f,
+    -0.36085158586502075f,
+    -0.364170640707016f,
+    -0.3685257136821747f,
+    -0.36950913071632385f,
+    -0.37342727184295654f,
+    -0.37576422095298767f,
+    -0.38124316930770874f,
+    -0.38525888323783875f,
+    -0.3888086974620819f,
+    -0.39026525616645813f,
+    -0.3936375677585602f,
+    -0.39492613077163696f,
+    -0.3975064158439636f,
+    -0.3963993489742279f,
+    -0.397246390581131f,
+    -0.39707404375076294f,
+    -0.40187129378318787f,
+    -0.40297064185142517f,
+    -0.40415963530540466f,
+    -0.4048372209072113f,
+    -0.40870434045791626f,
+    -0.4089066982269287f,
+    -0.413055956363678f,
+    -0.4154028594493866f,
+    -0.4188339114189148f,
+    -0.420019268989563f,
+    -0.422979474067688f,
+    -0.4220368564128876f,
+    -0.4250940978527069f,
+    -0.4320174753665924f,
+    -0.4331418573856354f,
+    -0.43258902430534363f,
+    -0.43233224749565125f,
+    -0.4312022030353546f,
+    -0.4324096143245697f,
+    -0.43120166659355164f,
+    -0.4329655170440674f,
+    -0.43143969774246216f,
+    -0.4315469563007355f,
+    -0.4307435154914856f,
+    -0.43314188718795776f,
+    -0.42688748240470886f,
+    -0.42423224449157715f,
+    -0.4196944832801819f,
+    -0.4140858054161072f,
+    -0.40591543912887573f,
+    -0.3983636796474457f,
+    -0.38861048221588135f,
+    -0.380551278591156f,
+    -0.36975666880607605f,
+    -0.36045053601264954f,
+    -0.348029226064682f,
+    -0.33798909187316895f,
+    -0.3224082887172699f,
+    -0.3083302974700928f,
+    -0.28899961709976196f,
+    -0.271828293800354f,
+    -0.25173163414001465f,
+    -0.23061813414096832f,
+    -0.20581161975860596f,
+    -0.18092690408229828f,
+    -0.1386886090040207f,
+    -0.08220451325178146f
+   };
+
+static constexpr std::array<std::array<float, 600>, 8> columns = transpose_weights(weights);
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+struct latent_keyframe
+{
+    TSample time = (TSample)0.0;
+    std::array<TSample, 8> latent_space{(TSample)0.0};
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+struct latent_target
+{
+    std::array<TSample, 8> latent_space{(TSample)0.0};
+    bool windowed = false;
+    bool cached = false;
+    TSample transition_time = (TSample)0.0;
+};
+
+// Process wide LRU cache of prepared wavetables, one per sample type, shared
+// by all the NeuralWave instances that enable it. Latent vectors are
+// quantized to a grid of the given resolution, and the tables are decoded at
+// the grid points, so that a hit returns exactly what a miss would build.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class NeuralCache
+{
+public:
+    static NeuralCache &shared();
+
+    std::shared_ptr<const Wavetable<TSample>> find(const std::array<TSample, 8> &latent_space, const bool &windowed);
+    void insert(const std::array<TSample, 8> &latent_space, const bool &windowed, const std::shared_ptr<const Wavetable<TSample>> &wavetable);
+    std::array<TSample, 8> quantize(const std::array<TSample, 8> &latent_space);
+
+    void set_budget(const std::size_t &bytes);
+    void set_resolution(const TSample &resolution);
+    void clear();
+
+    std::size_t get_budget();
+    TSample get_resolution();
+    std::size_t get_memory();
+    std::size_t get_entries();
+    std::size_t get_hits();
+    std::size_t get_misses();
+
+private:
+    typedef std::array<long long, 9> key_type;
+
+    struct key_hash
+    {
+        std::size_t operator()(const key_type &key) const
+        {
+            std::size_t hash = 0;
+            for (const auto &value : key)
+            {
+                hash ^= std::hash<long long>()(value) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+            }
+            return hash;
+        }
+    };
+
+    struct entry
+    {
+        std::shared_ptr<const Wavetable<TSample>> wavetable;
+        std::size_t memory = 0;
+        typename std::list<key_type>::iterator position;
+    };
+
+    std::mutex mutex_;
+    std::list<key_type> order_;
+    std::unordered_map<key_type, entry, key_hash> entries_;
+
+    std::size_t budget_ = 16777216;
+    TSample resolution_ = (TSample)(1.0 / 1024.0);
+    std::size_t memory_ = 0;
+    std::size_t hits_ = 0;
+    std::size_t misses_ = 0;
+
+    inline long long grid_(const TSample &value);
+    inline key_type key_(const std::array<TSample, 8> &latent_space, const bool &windowed);
+    inline void evict_();
+};
+
+// Carries latent targets from one thread, possibly the audio one, to a
+// decoding thread without locks or allocations. It is a triple buffer: the
+// writer never waits and the reader always gets the newest target, skipping
+// the ones it had no time to decode. A copy starts empty and stopped.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class LatentWorker
+{
+public:
+    LatentWorker() {}
+    LatentWorker(const LatentWorker &) {}
+    LatentWorker &operator=(const LatentWorker &);
+    ~LatentWorker();
+
+    template <typename TTask>
+    void start(TTask task);
+    void stop();
+    bool running();
+
+    inline void push(const latent_target<TSample> &target);
+    inline bool pop(latent_target<TSample> &target);
+
+private:
+    std::array<latent_target<TSample>, 3> slots_;
+    unsigned int write_slot_ = 0;
+    unsigned int read_slot_ = 1;
+    std::atomic<unsigned int> middle_slot_{2};
+
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+
+    static constexpr unsigned int fresh_ = 4;
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class NeuralWave
+{
+public:
+    NeuralWave(const TSample &sample_rate = (TSample)44100.0,
+               const TSample &frequency = (TSample)0.0,
+               const std::array<TSample, 8> &latent_space = {(TSample)0.0},
+               const bool &use_window = false);
+
+    void set_sample_rate(const TSample &sample_rate);
+    void set_frequency(const TSample &frequency);
+    void set_latent_space(const std::array<TSample, 8> &latent_space);
+    void set_latent_parameter(const int &index, const TSample &value);
+    void set_windowed(const bool &use_window);
+    void set_transition_time(const TSample &transition_time);
+    void set_asynchronous(const bool &asynchronous);
+    void set_cache(const bool &use_cache);
+    void reset();
+
+    TSample get_sample_rate();
+    TSample get_frequency();
+    std::array<TSample, 8> get_latent_space();
+    std::vector<TSample> get_wavetable(const unsigned int &size = 600);
+    bool get_windowed();
+    TSample get_transition_time();
+    bool get_asynchronous();
+    bool get_cache();
+
+    inline TSample run();
+    inline void run(TSample &output);
+    void render(const std::vector<latent_keyframe<TSample>> &trajectory, TSample *output, const std::size_t &length);
+    void render(const std::vector<latent_keyframe<TSample>> &trajectory, std::vector<TSample> &output);
+    inline TSample get_last_sample();
+
+    inline std::vector<TSample> autoencode(const std::vector<TSample> &input);
+    inline std::array<TSample, 8> encode(const std::vector<TSample> &input);
+    inline std::vector<std::array<TSample, 8>> encode(const std::vector<std::vector<TSample>> &inputs);
+    inline std::vector<TSample> decode(const std::array<TSample, 8> &latent_space, const unsigned int &size = 600);
+    inline void decode(const std::array<TSample, 8> &latent_space, std::vector<TSample> &output);
+    inline std::vector<std::vector<TSample>> decode(const std::vector<std::array<TSample, 8>> &latent_spaces, const unsigned int &size = 600);
+
+private:
+    std::array<TSample, 8> latent_space_;
+    std::array<TSample, 600> pre_activation_;
+    unsigned int rank_updates_ = 0;
+    std::vector<TSample> wavetable_;
+
+    soutel::WTOsc<TSample> oscillator_;
+    WTScanOsc<TSample> renderer_;
+
+    TSample crossfade_ = (TSample)0.05;
+    bool windowed_ = false;
+    bool cache_ = false;
+    TSample transition_time_ = (TSample)0.0;
+
+    static constexpr unsigned int rank_updates_limit_ = 64;
+    static constexpr unsigned int encoder_iterations_ = 3;
+
+    // Declared last, so that the decoding thread is joined before anything
+    // it uses is destroyed.
+    LatentWorker<TSample> worker_;
+
+    inline void set_wavetable_()
+    {
+        if (cache_)
+        {
+            wavetable_.resize(600);
+            oscillator_.queue_wavetable(cached_wavetable_(latent_space_, windowed_, wavetable_), transition_time_);
+            return;
+        }
+
+        oscillator_.queue_wavetable(prepare_wavetable_(wavetable_, windowed_), transition_time_);
+    }
+
+    // The table, with its mipmaps, is built only once, after the crossfade
+    // and the normalization.
+    inline std::shared_ptr<const Wavetable<TSample>> prepare_wavetable_(const std::vector<TSample> &samples, const bool &windowed)
+    {
+        auto wavetable = std::make_shared<Wavetable<TSample>>();
+        wavetable->set_samples(samples, false);
+        wavetable->set_windowed(windowed, false);
+        wavetable->crossfade(crossfade_, false);
+        wavetable->normalize((TSample)0.95, false);
+        wavetable->update();
+        return wavetable;
+    }
+
+    inline std::shared_ptr<const Wavetable<TSample>> cached_wavetable_(const std::array<TSample, 8> &latent_space, const bool &windowed, std::vector<TSample> &buffer);
+
+    inline void post_target_();
+    inline void decode_target_(std::vector<TSample> &wavetable);
+
+    static const std::array<std::array<TSample, 600>, 8> &encoder_rows_();
+    inline void encode_(const TSample *input, std::array<TSample, 8> &latent_space);
+    template <std::size_t TColumns>
+    static inline bool solve_(std::array<std::array<double, TColumns>, 8> &system);
+    static inline void resample_(const TSample *input, const std::size_t &input_size, TSample *output, const std::size_t &output_size);
+    inline void decode_(const std::array<TSample, 8> &latent_space, TSample *output);
+    inline void preactivate_(const std::array<TSample, 8> &latent_space, TSample *output);
+    inline void activate_(const TSample *pre_activation, TSample *output);
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+NeuralWave<TSample>::NeuralWave(const TSample &sample_rate, const TSample &frequency, const std::array<TSample, 8> &latent_space, const bool &use_window)
+{
+    oscillator_.set_sample_rate(sample_rate);
+    oscillator_.set_frequency(frequency);
+    windowed_ = use_window;
+    set_latent_space(latent_space);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::set_sample_rate(const TSample &sample_rate)
+{
+    oscillator_.set_sample_rate(sample_rate);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::set_frequency(const TSample &frequency)
+{
+    oscillator_.set_frequency(frequency);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::reset()
+{
+    oscillator_.reset();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample NeuralWave<TSample>::get_sample_rate()
+{
+    return oscillator_.get_sample_rate();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample NeuralWave<TSample>::get_frequency()
+{
+    return oscillator_.get_frequency();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample NeuralWave<TSample>::run()
+{
+    return oscillator_.run();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void NeuralWave<TSample>::run(TSample &output)
+{
+    output = oscillator_.run();
+}
+
+// Renders a latent trajectory, whose keyframes are given in ms from the start
+// of the output and in increasing time order. All the keyframes are decoded
+// and prepared first, as the frames of a scanning oscillator, then the output
+// is streamed moving the scan position along the trajectory at every sample,
+// holding the first and the last keyframe outside of it. The latent vector
+// and the phase of run() are left untouched.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::render(const std::vector<latent_keyframe<TSample>> &trajectory, TSample *output, const std::size_t &length)
+{
+    if (trajectory.empty())
+    {
+        for (std::size_t i = 0; i < length; i++)
+        {
+            output[i] = (TSample)0.0;
+        }
+        return;
+    }
+
+    std::vector<TSample> frames(trajectory.size() * 600);
+    std::vector<TSample> wavetable(600);
+
+    for (std::size_t k = 0; k < trajectory.size(); k++)
+    {
+        decode_(trajectory[k].latent_space, wavetable.data());
+        std::shared_ptr<const Wavetable<TSample>> prepared = prepare_wavetable_(wavetable, windowed_);
+        const std::vector<TSample> &samples = prepared->get_samples();
+        const std::vector<TSample> &window = prepared->get_window();
+
+        for (auto i = 0; i < 600; i++)
+        {
+            frames[k * 600 + i] = windowed_ ? samples[i] * window[i] : samples[i];
+        }
+    }
+
+    renderer_.set_sample_rate(oscillator_.get_sample_rate());
+    renderer_.set_frequency(oscillator_.get_frequency());
+    renderer_.set_interpolation(oscillator_.get_interpolation());
+    renderer_.set_frames(frames, 600);
+
+    const TSample last_frame = (TSample)(trajectory.size() - 1);
+    const TSample ms_per_sample = (TSample)1000.0 / oscillator_.get_sample_rate();
+    std::size_t k = 0;
+
+    for (std::size_t i = 0; i < length; i++)
+    {
+        const TSample time = (TSample)i * ms_per_sample;
+
+        while (k + 1 < trajectory.size() && time >= trajectory[k + 1].time)
+        {
+            k++;
+        }
+
+        TSample position = (TSample)k;
+
+        if (k + 1 < trajectory.size() && time > trajectory[k].time)
+        {
+            position += (time - trajectory[k].time) / (trajectory[k + 1].time - trajectory[k].time);
+        }
+
+        output[i] = renderer_.run(last_frame > (TSample)0.0 ? position / last_frame : (TSample)0.0);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::render(const std::vector<latent_keyframe<TSample>> &trajectory, std::vector<TSample> &output)
+{
+    render(trajectory, output.data(), output.size());
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample NeuralWave<TSample>::get_last_sample()
+{
+    return oscillator_.get_last_sample();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::set_latent_space(const std::array<TSample, 8> &latent_space)
+{
+    latent_space_ = latent_space;
+
+    if (worker_.running())
+    {
+        post_target_();
+        return;
+    }
+
+    if (cache_)
+    {
+        set_wavetable_();
+        return;
+    }
+
+    preactivate_(latent_space_, pre_activation_.data());
+    rank_updates_ = 0;
+
+    wavetable_.resize(600);
+    activate_(pre_activation_.data(), wavetable_.data());
+    set_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::set_latent_parameter(const int &index, const TSample &value)
+{
+    if (index >= 0 && index < 8)
+    {
+        if (worker_.running() || cache_)
+        {
+            std::array<TSample, 8> latent_space = latent_space_;
+            latent_space[index] = value;
+            set_latent_space(latent_space);
+            return;
+        }
+
+        if (++rank_updates_ >= rank_updates_limit_)
+        {
+            std::array<TSample, 8> latent_space = latent_space_;
+            latent_space[index] = value;
+            set_latent_space(latent_space);
+            return;
+        }
+
+        const TSample delta = value - latent_space_[index];
+        const float *column = NeuralWeights::columns[index].data();
+        latent_space_[index] = value;
+
+        for (auto s = 0; s < 600; s++)
+        {
+            pre_activation_[s] += delta * (TSample)column[s];
+        }
+
+        activate_(pre_activation_.data(), wavetable_.data());
+        set_wavetable_();
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::set_windowed(const bool &use_window)
+{
+    windowed_ = use_window;
+
+    if (worker_.running())
+    {
+        post_target_();
+        return;
+    }
+
+    set_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::set_transition_time(const TSample &transition_time)
+{
+    transition_time_ = std::max((TSample)0.0, transition_time);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::set_asynchronous(const bool &asynchronous)
+{
+    if (asynchronous == worker_.running())
+    {
+        return;
+    }
+
+    if (asynchronous)
+    {
+        worker_.start([this, wavetable = std::vector<TSample>(600)]() mutable
+        {
+            decode_target_(wavetable);
+        });
+    }
+    else
+    {
+        worker_.stop();
+        oscillator_.collect_wavetables();
+        set_latent_space(latent_space_);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::set_cache(const bool &use_cache)
+{
+    if (use_cache != cache_)
+    {
+        cache_ = use_cache;
+        set_latent_space(latent_space_);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::array<TSample, 8> NeuralWave<TSample>::get_latent_space()
+{
+    return latent_space_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> NeuralWave<TSample>::get_wavetable(const unsigned int &size)
+{
+    if (worker_.running() || cache_)
+    {
+        return decode(cache_ ? NeuralCache<TSample>::shared().quantize(latent_space_) : latent_space_, size);
+    }
+
+    if (size == wavetable_.size())
+    {
+        return wavetable_;
+    }
+    else
+    {
+        return resize_chunk(wavetable_, size);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool NeuralWave<TSample>::get_windowed()
+{
+    return windowed_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample NeuralWave<TSample>::get_transition_time()
+{
+    return transition_time_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool NeuralWave<TSample>::get_asynchronous()
+{
+    return worker_.running();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool NeuralWave<TSample>::get_cache()
+{
+    return cache_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> NeuralWave<TSample>::autoencode(const std::vector<TSample> &input)
+{
+    return decode(encode(input));
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::array<TSample, 8> NeuralWave<TSample>::encode(const std::vector<TSample> &input)
+{
+    std::array<TSample, 8> latent_space{(TSample)0.0};
+
+    if (input.empty())
+    {
+        return latent_space;
+    }
+
+    if (input.size() == 600)
+    {
+        encode_(input.data(), latent_space);
+    }
+    else
+    {
+        std::array<TSample, 600> input600;
+        resample_(input.data(), input.size(), input600.data(), 600);
+        encode_(input600.data(), latent_space);
+    }
+
+    return latent_space;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<std::array<TSample, 8>> NeuralWave<TSample>::encode(const std::vector<std::vector<TSample>> &inputs)
+{
+    std::vector<std::array<TSample, 8>> latent_spaces(inputs.size());
+
+    for (std::size_t i = 0; i < inputs.size(); i++)
+    {
+        latent_spaces[i] = encode(inputs[i]);
+    }
+
+    return latent_spaces;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> NeuralWave<TSample>::decode(const std::array<TSample, 8> &latent_space, const unsigned int &size)
+{
+    std::vector<TSample> output(size);
+
+    decode(latent_space, output);
+
+    return output;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralWave<TSample>::decode(const std::array<TSample, 8> &latent_space, std::vector<TSample> &output)
+{
+    if (output.size() == 600)
+    {
+        decode_(latent_space, output.data());
+        return;
+    }
+
+    std::array<TSample, 600> wavetable;
+    decode_(latent_space, wavetable.data());
+    resample_(wavetable.data(), 600, output.data(), output.size());
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<std::vector<TSample>> NeuralWave<TSample>::decode(const std::vector<std::array<TSample, 8>> &latent_spaces, const unsigned int &size)
+{
+    std::vector<std::vector<TSample>> output(latent_spaces.size(), std::vector<TSample>(size));
+
+    for (std::size_t i = 0; i < latent_spaces.size(); i++)
+    {
+        decode(latent_spaces[i], output[i]);
+    }
+
+    return output;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void NeuralWave<TSample>::decode_(const std::array<TSample, 8> &latent_space, TSample *output)
+{
+    preactivate_(latent_space, output);
+    activate_(output, output);
+}
+
+// Encoding starts by inverting the activation and projecting the result onto
+// the span of the decoder weights: the rows of (W^T W)^-1 W^T, computed once
+// per sample type, give the latent vector whose pre-activation is the
+// closest in the least squares sense.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+const std::array<std::array<TSample, 600>, 8> &NeuralWave<TSample>::encoder_rows_()
+{
+    static const std::array<std::array<TSample, 600>, 8> rows = []()
+    {
+        const std::array<std::array<float, 600>, 8> &columns = NeuralWeights::columns;
+        std::array<std::array<double, 16>, 8> system{};
+
+        for (auto i = 0; i < 8; i++)
+        {
+            for (auto j = 0; j < 8; j++)
+            {
+                for (auto s = 0; s < 600; s++)
+                {
+                    system[i][j] += (double)columns[i][s] * (double)columns[j][s];
+                }
+            }
+            system[i][8 + i] = 1.0;
+        }
+
+        solve_(system);
+
+        std::array<std::array<TSample, 600>, 8> projection;
+        for (auto l = 0; l < 8; l++)
+        {
+            for (auto s = 0; s < 600; s++)
+            {
+                double value = 0.0;
+                for (auto k = 0; k < 8; k++)
+                {
+                    value += system[l][8 + k] * (double)columns[k][s];
+                }
+                projection[l][s] = (TSample)value;
+            }
+        }
+
+        return projection;
+    }();
+
+    return rows;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void NeuralWave<TSample>::encode_(const TSample *input, std::array<TSample, 8> &latent_space)
+{
+    const std::array<std::array<TSample, 600>, 8> &rows = encoder_rows_();
+    std::array<TSample, 600> buffer;
+
+    for (auto s = 0; s < 600; s++)
+    {
+        buffer[s] = std::atanh(std::clamp(input[s], (TSample)-0.999, (TSample)0.999)) - (TSample)NeuralWeights::biases[s];
+    }
+
+    for (auto l = 0; l < 8; l++)
+    {
+        const TSample *row = rows[l].data();
+        TSample value = (TSample)0.0;
+
+        for (auto s = 0; s < 600; s++)
+        {
+            value += row[s] * buffer[s];
+        }
+
+        latent_space[l] = value;
+    }
+
+    // Near saturation atanh amplifies every error, so the projection is
+    // refined with a few Gauss-Newton steps on the actual decoder output.
+    std::array<TSample, 600> slope;
+
+    for (unsigned int iteration = 0; iteration < encoder_iterations_; iteration++)
+    {
+        preactivate_(latent_space, buffer.data());
+
+        for (auto s = 0; s < 600; s++)
+        {
+            const TSample output = fast_tanh(buffer[s]);
+            slope[s] = (TSample)1.0 - output * output;
+            buffer[s] = std::clamp(input[s], (TSample)-1.0, (TSample)1.0) - output;
+        }
+
+        std::array<std::array<double, 9>, 8> system{};
+
+        for (auto i = 0; i < 8; i++)
+        {
+            const float *column_i = NeuralWeights::columns[i].data();
+
+            for (auto j = i; j < 8; j++)
+            {
+                const float *column_j = NeuralWeights::columns[j].data();
+                TSample value = (TSample)0.0;
+
+                for (auto s = 0; s < 600; s++)
+                {
+                    value += slope[s] * slope[s] * (TSample)column_i[s] * (TSample)column_j[s];
+                }
+
+                system[i][j] = (double)value;
+                system[j][i] = (double)value;
+            }
+
+            TSample gradient = (TSample)0.0;
+
+            for (auto s = 0; s < 600; s++)
+            {
+                gradient += slope[s] * (TSample)column_i[s] * buffer[s];
+            }
+
+            system[i][8] = (double)gradient;
+        }
+
+        if (!solve_(system))
+        {
+            break;
+        }
+
+        for (auto l = 0; l < 8; l++)
+        {
+            latent_space[l] += (TSample)system[l][8];
+        }
+    }
+}
+
+// Gauss-Jordan elimination with partial pivoting on an 8x8 system, whose
+// right hand sides fill the remaining columns and are replaced by the
+// solutions.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+template <std::size_t TColumns>
+inline bool NeuralWave<TSample>::solve_(std::array<std::array<double, TColumns>, 8> &system)
+{
+    for (auto i = 0; i < 8; i++)
+    {
+        auto pivot = i;
+        for (auto r = i + 1; r < 8; r++)
+        {
+            if (std::abs(system[r][i]) > std::abs(system[pivot][i]))
+            {
+                pivot = r;
+            }
+        }
+
+        if (std::abs(system[pivot][i]) < 1e-12)
+        {
+            return false;
+        }
+        std::swap(system[i], system[pivot]);
+
+        const double scale = 1.0 / system[i][i];
+        for (std::size_t c = 0; c < TColumns; c++)
+        {
+            system[i][c] *= scale;
+        }
+
+        for (auto r = 0; r < 8; r++)
+        {
+            if (r != i)
+            {
+                const double factor = system[r][i];
+                for (std::size_t c = 0; c < TColumns; c++)
+                {
+                    system[r][c] -= factor * system[i][c];
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void NeuralWave<TSample>::resample_(const TSample *input, const std::size_t &input_size, TSample *output, const std::size_t &output_size)
+{
+    TSample ratio = (TSample)(input_size - 1) / (TSample)output_size;
+
+    for (std::size_t i = 0; i < output_size; i++)
+    {
+        TSample in_pos = (TSample)i * ratio;
+        std::size_t in_a = (std::size_t)in_pos;
+        std::size_t in_b = std::min(in_a + 1, input_size - 1);
+        output[i] = cosip(input[in_a], input[in_b], in_pos - (TSample)in_a);
+    }
+}
+
+// The pre-activation is accumulated as a sum of scaled columns, so that every
+// loop runs over 600 contiguous values and can be vectorized. Being linear in
+// the latent space, it can also be updated one coordinate at a time.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void NeuralWave<TSample>::preactivate_(const std::array<TSample, 8> &latent_space, TSample *output)
+{
+    for (auto s = 0; s < 600; s++)
+    {
+        output[s] = (TSample)NeuralWeights::biases[s];
+    }
+
+    for (auto l = 0; l < 8; l++)
+    {
+        const TSample value = latent_space[l];
+        const float *column = NeuralWeights::columns[l].data();
+
+        for (auto s = 0; s < 600; s++)
+        {
+            output[s] += value * (TSample)column[s];
+        }
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void NeuralWave<TSample>::activate_(const TSample *pre_activation, TSample *output)
+{
+    for (auto s = 0; s < 600; s++)
+    {
+        output[s] = fast_tanh(pre_activation[s]);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void NeuralWave<TSample>::post_target_()
+{
+    latent_target<TSample> target;
+    target.latent_space = latent_space_;
+    target.windowed = windowed_;
+    target.cached = cache_;
+    target.transition_time = transition_time_;
+
+    worker_.push(target);
+}
+
+// The decoding thread only reads the targets it receives and the constant
+// weights, and hands its tables to the oscillator through queue_wavetable(),
+// which also frees the ones the audio thread has retired.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void NeuralWave<TSample>::decode_target_(std::vector<TSample> &wavetable)
+{
+    latent_target<TSample> target;
+
+    if (worker_.pop(target))
+    {
+        if (target.cached)
+        {
+            oscillator_.queue_wavetable(cached_wavetable_(target.latent_space, target.windowed, wavetable), target.transition_time);
+        }
+        else
+        {
+            decode_(target.latent_space, wavetable.data());
+            oscillator_.queue_wavetable(prepare_wavetable_(wavetable, target.windowed), target.transition_time);
+        }
+    }
+    else
+    {
+        oscillator_.collect_wavetables();
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline std::shared_ptr<const Wavetable<TSample>> NeuralWave<TSample>::cached_wavetable_(const std::array<TSample, 8> &latent_space, const bool &windowed, std::vector<TSample> &buffer)
+{
+    NeuralCache<TSample> &cache = NeuralCache<TSample>::shared();
+    std::shared_ptr<const Wavetable<TSample>> wavetable = cache.find(latent_space, windowed);
+
+    if (!wavetable)
+    {
+        decode_(cache.quantize(latent_space), buffer.data());
+        wavetable = prepare_wavetable_(buffer, windowed);
+        cache.insert(latent_space, windowed, wavetable);
+    }
+
+    return wavetable;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+NeuralCache<TSample> &NeuralCache<TSample>::shared()
+{
+    static NeuralCache cache;
+
+    return cache;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::shared_ptr<const Wavetable<TSample>> NeuralCache<TSample>::find(const std::array<TSample, 8> &latent_space, const bool &windowed)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto found = entries_.find(key_(latent_space, windowed));
+    if (found == entries_.end())
+    {
+        misses_++;
+        return nullptr;
+    }
+
+    hits_++;
+    order_.splice(order_.begin(), order_, found->second.position);
+
+    return found->second.wavetable;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralCache<TSample>::insert(const std::array<TSample, 8> &latent_space, const bool &windowed, const std::shared_ptr<const Wavetable<TSample>> &wavetable)
+{
+    if (!wavetable)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const key_type key = key_(latent_space, windowed);
+    if (entries_.find(key) != entries_.end())
+    {
+        return;
+    }
+
+    order_.push_front(key);
+
+    entry &new_entry = entries_[key];
+    new_entry.wavetable = wavetable;
+    new_entry.memory = wavetable->get_memory();
+    new_entry.position = order_.begin();
+    memory_ += new_entry.memory;
+
+    evict_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::array<TSample, 8> NeuralCache<TSample>::quantize(const std::array<TSample, 8> &latent_space)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::array<TSample, 8> quantized;
+    for (auto l = 0; l < 8; l++)
+    {
+        quantized[l] = (TSample)grid_(latent_space[l]) * resolution_;
+    }
+
+    return quantized;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralCache<TSample>::set_budget(const std::size_t &bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    budget_ = bytes;
+    evict_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralCache<TSample>::set_resolution(const TSample &resolution)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    resolution_ = std::max(resolution, std::numeric_limits<TSample>::epsilon());
+    order_.clear();
+    entries_.clear();
+    memory_ = 0;
+    hits_ = 0;
+    misses_ = 0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void NeuralCache<TSample>::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    order_.clear();
+    entries_.clear();
+    memory_ = 0;
+    hits_ = 0;
+    misses_ = 0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::size_t NeuralCache<TSample>::get_budget()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return budget_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample NeuralCache<TSample>::get_resolution()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return resolution_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::size_t NeuralCache<TSample>::get_memory()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return memory_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::size_t NeuralCache<TSample>::get_entries()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return entries_.size();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::size_t NeuralCache<TSample>::get_hits()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return hits_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::size_t NeuralCache<TSample>::get_misses()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return misses_;
+}
+
+// Index of the grid point nearest to a latent value. The quotient is clamped
+// to +/-2^62 before rounding, as llround is undefined past the range of long
+// long, and NaN goes to the origin.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline long long NeuralCache<TSample>::grid_(const TSample &value)
+{
+    const TSample limit = (TSample)4611686018427387904.0;
+    const TSample steps = value / resolution_;
+
+    if (std::isnan(steps))
+    {
+        return 0;
+    }
+
+    return std::llround(std::clamp(steps, -limit, limit));
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline typename NeuralCache<TSample>::key_type NeuralCache<TSample>::key_(const std::array<TSample, 8> &latent_space, const bool &windowed)
+{
+    key_type key;
+    for (auto l = 0; l < 8; l++)
+    {
+        key[l] = grid_(latent_space[l]);
+    }
+    key[8] = windowed ? 1 : 0;
+
+    return key;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void NeuralCache<TSample>::evict_()
+{
+    while (memory_ > budget_ && !order_.empty())
+    {
+        auto oldest = entries_.find(order_.back());
+        memory_ -= oldest->second.memory;
+        entries_.erase(oldest);
+        order_.pop_back();
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+LatentWorker<TSample> &LatentWorker<TSample>::operator=(const LatentWorker &)
+{
+    stop();
+
+    return *this;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+LatentWorker<TSample>::~LatentWorker()
+{
+    stop();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+template <typename TTask>
+void LatentWorker<TSample>::start(TTask task)
+{
+    stop();
+
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread([this, task]() mutable
+    {
+        while (running_.load(std::memory_order_acquire))
+        {
+            task();
+        }
+    });
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void LatentWorker<TSample>::stop()
+{
+    running_.store(false, std::memory_order_release);
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool LatentWorker<TSample>::running()
+{
+    return thread_.joinable();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void LatentWorker<TSample>::push(const latent_target<TSample> &target)
+{
+    slots_[write_slot_] = target;
+    write_slot_ = middle_slot_.exchange(write_slot_ | fresh_, std::memory_order_acq_rel) & (fresh_ - 1);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline bool LatentWorker<TSample>::pop(latent_target<TSample> &target)
+{
+    if (!(middle_slot_.load(std::memory_order_relaxed) & fresh_))
+    {
+        return false;
+    }
+
+    read_slot_ = middle_slot_.exchange(read_slot_, std::memory_order_acq_rel) & (fresh_ - 1);
+    target = slots_[read_slot_];
+
+    return true;
+}
+
+}
+
+#endif // NEURALWAVE_H_
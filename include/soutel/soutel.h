@@ -34,6 +34,7 @@ SOFTWARE.
 #include "descriptors.h"
 #include "distortions.h"
 #include "ecaosc.h"
+#include "fft.h"
 #include "interp.h"
 #include "lorenz.h"
 #include "neuralwave.h"
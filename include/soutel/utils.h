@@ -1,125 +1,377 @@
-/******************************************************************************
-Copyright (c) 2023-2026 Valerio Orlandini
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-******************************************************************************/
-
-#ifndef UTILS_H_
-#define UTILS_H_
-
-#include <algorithm>
-#include <cmath>
-#include <vector>
-
-#if __cplusplus >= 202002L
-#include<concepts>
-#endif
-
-namespace soutel
-{
-
-template <typename TSample>
-inline TSample ftom(const TSample &freq, const TSample &a = (TSample)440.0)
-{
-    return (TSample)69.0 + (TSample)(12.0 * log2(abs((double)freq) / abs((double)a)));
-}
-
-template <typename TSample>
-inline TSample mtof(const TSample &midi_note, const TSample &a = (TSample)440.0)
-{
-    return a * (TSample)pow(2.0, ((double)midi_note - 69.0) / 12.0);
-}
-
-template <typename TSample>
-inline TSample scale(const TSample &in, const TSample &in_min, const TSample &in_max, const TSample &out_min, const TSample &out_max)
-{
-    if (in_min == in_max)
-    {
-        return (TSample)0.0;
-    }
-    
-    return out_min + ((in - in_min) * (out_max - out_min) / (in_max - in_min));
-}
-
-template <typename TSample>
-inline std::vector<TSample> zeropad(const std::vector<TSample> &input, const int &size, const bool &center = true)
-{
-    std::vector<TSample> output = input;
-    zeropad_inplace(output, size, center);
-
-    return output;
-}
-
-template <typename TSample>
-inline void zeropad_inplace(std::vector<TSample> &input, const int &size, const bool &center = true)
-{
-    if (size > input.size())
-    {
-        if (center)
-        {
-            int zeros = size - input.size();
-
-            if (zeros % 2)
-            {
-                zeros += 1;
-            }
-
-            input.insert(input.begin(), zeros / 2, (TSample)0.0);
-        }
-
-        input.resize(size, (TSample)0.0);
-    }
-}
-
-template <typename TSample>
-inline std::vector<TSample> zerophase(const std::vector<TSample> &input)
-{
-    std::vector<TSample> output = input;
-
-    zerophase_inplace(output);
-
-    return output;
-}
-
-template <typename TSample>
-inline void zerophase_inplace(std::vector<TSample> &input)
-{
-    auto middle = input.begin() + input.size() / 2;
-
-    std::rotate(input.begin(), middle, input.end());
-}
-
-template <typename TSample>
-inline std::vector<TSample> zeropadphase(const std::vector<TSample> &input, const int &size)
-{
-    std::vector<TSample> output = zeropad(input, size);
-    zerophase_inplace(output);
-
-    return output;
-}
-
-template <typename TSample>
-inline void zeropadphase_inplace(std::vector<TSample> &input, const int &size)
-{
-    zeropad_inplace(input, size);
-    zerophase_inplace(input);
-}
-}
-
-#endif // UTILS_H_
+/******************************************************************************
+Copyright (c) 2023-2026 Valerio Orlandini
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef UTILS_H_
+#define UTILS_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#if __cplusplus >= 202002L
+#include<concepts>
+#endif
+
+namespace soutel
+{
+
+enum class ODEIntegrators
+{
+    euler,
+    heun,
+    rk4,
+    rk45
+};
+
+template <typename TSample>
+inline TSample ftom(const TSample &freq, const TSample &a = (TSample)440.0)
+{
+    return (TSample)69.0 + (TSample)(12.0 * log2(abs((double)freq) / abs((double)a)));
+}
+
+template <typename TSample>
+inline TSample mtof(const TSample &midi_note, const TSample &a = (TSample)440.0)
+{
+    return a * (TSample)pow(2.0, ((double)midi_note - 69.0) / 12.0);
+}
+
+template <typename TSample>
+inline TSample scale(const TSample &in, const TSample &in_min, const TSample &in_max, const TSample &out_min, const TSample &out_max)
+{
+    if (in_min == in_max)
+    {
+        return (TSample)0.0;
+    }
+    
+    return out_min + ((in - in_min) * (out_max - out_min) / (in_max - in_min));
+}
+
+// Rational approximation of tanh (error below 1e-4, |output| <= 1) with no
+// branches or library calls, so that loops over it can be vectorized.
+template <typename TSample>
+inline TSample fast_tanh(const TSample &in)
+{
+    const TSample x = std::clamp(in, (TSample)-4.97, (TSample)4.97);
+    const TSample x2 = x * x;
+
+    return x * ((TSample)135135.0 + x2 * ((TSample)17325.0 + x2 * ((TSample)378.0 + x2))) /
+           ((TSample)135135.0 + x2 * ((TSample)62370.0 + x2 * ((TSample)3150.0 + x2 * (TSample)28.0)));
+}
+
+// Advances the three dimensional system d(state)/dt = derivatives(state) by
+// one step of size t. rk45 needs error control across steps, see
+// ode_adaptive_step, and here it is integrated as rk4.
+template <typename TSample, typename TDerivatives>
+inline void ode_step(const ODEIntegrators &integrator, const TDerivatives &derivatives, std::array<TSample, 3> &state, const TSample &t)
+{
+    const std::array<TSample, 3> k1 = derivatives(state);
+
+    switch (integrator)
+    {
+    case ODEIntegrators::euler:
+        for (int i = 0; i < 3; i++)
+        {
+            state[i] += t * k1[i];
+        }
+        break;
+    case ODEIntegrators::heun:
+    {
+        std::array<TSample, 3> predictor;
+        for (int i = 0; i < 3; i++)
+        {
+            predictor[i] = state[i] + t * k1[i];
+        }
+        const std::array<TSample, 3> k2 = derivatives(predictor);
+        for (int i = 0; i < 3; i++)
+        {
+            state[i] += t * (TSample)0.5 * (k1[i] + k2[i]);
+        }
+        break;
+    }
+    case ODEIntegrators::rk4:
+    case ODEIntegrators::rk45:
+    {
+        const TSample half_t = t * (TSample)0.5;
+        std::array<TSample, 3> stage;
+        for (int i = 0; i < 3; i++)
+        {
+            stage[i] = state[i] + half_t * k1[i];
+        }
+        const std::array<TSample, 3> k2 = derivatives(stage);
+        for (int i = 0; i < 3; i++)
+        {
+            stage[i] = state[i] + half_t * k2[i];
+        }
+        const std::array<TSample, 3> k3 = derivatives(stage);
+        for (int i = 0; i < 3; i++)
+        {
+            stage[i] = state[i] + t * k3[i];
+        }
+        const std::array<TSample, 3> k4 = derivatives(stage);
+        for (int i = 0; i < 3; i++)
+        {
+            state[i] += t * (k1[i] + (TSample)2.0 * (k2[i] + k3[i]) + k4[i]) / (TSample)6.0;
+        }
+        break;
+    }
+    }
+}
+
+// Lane by lane version of ode_step for banks of systems stored as structure
+// of arrays, state[d][l] being coordinate d of system l. derivatives(state,
+// out) fills out for all the lanes at once, so that every stage is a plain
+// loop over the lanes which the compiler can vectorize. rk45 is integrated
+// as rk4.
+template <typename TSample, std::size_t Lanes, typename TDerivatives>
+inline void ode_step_lanes(const ODEIntegrators &integrator, const TDerivatives &derivatives,
+                           std::array<std::array<TSample, Lanes>, 3> &state, const TSample &t)
+{
+    std::array<std::array<TSample, Lanes>, 3> k1;
+    derivatives(state, k1);
+
+    switch (integrator)
+    {
+    case ODEIntegrators::euler:
+        for (int d = 0; d < 3; d++)
+        {
+            for (std::size_t l = 0; l < Lanes; l++)
+            {
+                state[d][l] += t * k1[d][l];
+            }
+        }
+        break;
+    case ODEIntegrators::heun:
+    {
+        std::array<std::array<TSample, Lanes>, 3> predictor;
+        std::array<std::array<TSample, Lanes>, 3> k2;
+        for (int d = 0; d < 3; d++)
+        {
+            for (std::size_t l = 0; l < Lanes; l++)
+            {
+                predictor[d][l] = state[d][l] + t * k1[d][l];
+            }
+        }
+        derivatives(predictor, k2);
+        for (int d = 0; d < 3; d++)
+        {
+            for (std::size_t l = 0; l < Lanes; l++)
+            {
+                state[d][l] += t * (TSample)0.5 * (k1[d][l] + k2[d][l]);
+            }
+        }
+        break;
+    }
+    case ODEIntegrators::rk4:
+    case ODEIntegrators::rk45:
+    {
+        const TSample half_t = t * (TSample)0.5;
+        std::array<std::array<TSample, Lanes>, 3> stage;
+        std::array<std::array<TSample, Lanes>, 3> k2;
+        std::array<std::array<TSample, Lanes>, 3> k3;
+        std::array<std::array<TSample, Lanes>, 3> k4;
+        for (int d = 0; d < 3; d++)
+        {
+            for (std::size_t l = 0; l < Lanes; l++)
+            {
+                stage[d][l] = state[d][l] + half_t * k1[d][l];
+            }
+        }
+        derivatives(stage, k2);
+        for (int d = 0; d < 3; d++)
+        {
+            for (std::size_t l = 0; l < Lanes; l++)
+            {
+                stage[d][l] = state[d][l] + half_t * k2[d][l];
+            }
+        }
+        derivatives(stage, k3);
+        for (int d = 0; d < 3; d++)
+        {
+            for (std::size_t l = 0; l < Lanes; l++)
+            {
+                stage[d][l] = state[d][l] + t * k3[d][l];
+            }
+        }
+        derivatives(stage, k4);
+        for (int d = 0; d < 3; d++)
+        {
+            for (std::size_t l = 0; l < Lanes; l++)
+            {
+                state[d][l] += t * (k1[d][l] + (TSample)2.0 * (k2[d][l] + k3[d][l]) + k4[d][l]) / (TSample)6.0;
+            }
+        }
+        break;
+    }
+    }
+}
+
+// Advances the system by span with the Dormand-Prince 5(4) pair, adapting
+// the step size h, which is kept between calls, so that the estimated local
+// error stays below tolerance (relative to the state, absolute below 1).
+template <typename TSample, typename TDerivatives>
+inline void ode_adaptive_step(const TDerivatives &derivatives, std::array<TSample, 3> &state, const TSample &span, TSample &h, const TSample &tolerance)
+{
+    const TSample min_h = span * (TSample)1e-6;
+    TSample elapsed = (TSample)0.0;
+
+    h = std::clamp(h, min_h, span);
+
+    while (elapsed < span)
+    {
+        const TSample t = std::min(h, span - elapsed);
+        std::array<TSample, 3> stage;
+        std::array<TSample, 3> solution;
+
+        const std::array<TSample, 3> k1 = derivatives(state);
+        for (int i = 0; i < 3; i++)
+        {
+            stage[i] = state[i] + t * k1[i] * (TSample)(1.0 / 5.0);
+        }
+        const std::array<TSample, 3> k2 = derivatives(stage);
+        for (int i = 0; i < 3; i++)
+        {
+            stage[i] = state[i] + t * (k1[i] * (TSample)(3.0 / 40.0) + k2[i] * (TSample)(9.0 / 40.0));
+        }
+        const std::array<TSample, 3> k3 = derivatives(stage);
+        for (int i = 0; i < 3; i++)
+        {
+            stage[i] = state[i] + t * (k1[i] * (TSample)(44.0 / 45.0) - k2[i] * (TSample)(56.0 / 15.0) + k3[i] * (TSample)(32.0 / 9.0));
+        }
+        const std::array<TSample, 3> k4 = derivatives(stage);
+        for (int i = 0; i < 3; i++)
+        {
+            stage[i] = state[i] + t * (k1[i] * (TSample)(19372.0 / 6561.0) - k2[i] * (TSample)(25360.0 / 2187.0) +
+                                       k3[i] * (TSample)(64448.0 / 6561.0) - k4[i] * (TSample)(212.0 / 729.0));
+        }
+        const std::array<TSample, 3> k5 = derivatives(stage);
+        for (int i = 0; i < 3; i++)
+        {
+            stage[i] = state[i] + t * (k1[i] * (TSample)(9017.0 / 3168.0) - k2[i] * (TSample)(355.0 / 33.0) +
+                                       k3[i] * (TSample)(46732.0 / 5247.0) + k4[i] * (TSample)(49.0 / 176.0) -
+                                       k5[i] * (TSample)(5103.0 / 18656.0));
+        }
+        const std::array<TSample, 3> k6 = derivatives(stage);
+        for (int i = 0; i < 3; i++)
+        {
+            solution[i] = state[i] + t * (k1[i] * (TSample)(35.0 / 384.0) + k3[i] * (TSample)(500.0 / 1113.0) +
+                                          k4[i] * (TSample)(125.0 / 192.0) - k5[i] * (TSample)(2187.0 / 6784.0) +
+                                          k6[i] * (TSample)(11.0 / 84.0));
+        }
+        const std::array<TSample, 3> k7 = derivatives(solution);
+
+        TSample error = (TSample)0.0;
+        for (int i = 0; i < 3; i++)
+        {
+            const TSample difference = t * (k1[i] * (TSample)(71.0 / 57600.0) - k3[i] * (TSample)(71.0 / 16695.0) +
+                                            k4[i] * (TSample)(71.0 / 1920.0) - k5[i] * (TSample)(17253.0 / 339200.0) +
+                                            k6[i] * (TSample)(22.0 / 525.0) - k7[i] * (TSample)(1.0 / 40.0));
+            error = std::max(error, std::abs(difference) / (tolerance * std::max((TSample)1.0, std::abs(state[i]))));
+        }
+
+        if (error <= (TSample)1.0 || t <= min_h)
+        {
+            state = solution;
+            elapsed += t;
+        }
+
+        TSample factor = (TSample)5.0;
+        if (!std::isfinite(error))
+        {
+            factor = (TSample)0.2;
+        }
+        else if (error > (TSample)0.0)
+        {
+            factor = std::clamp((TSample)0.9 * std::pow(error, (TSample)-0.2), (TSample)0.2, (TSample)5.0);
+        }
+
+        const TSample next_h = t * factor;
+        h = std::clamp(t < h && error <= (TSample)1.0 ? std::max(h, next_h) : next_h, min_h, span);
+    }
+}
+
+template <typename TSample>
+inline std::vector<TSample> zeropad(const std::vector<TSample> &input, const int &size, const bool &center = true)
+{
+    std::vector<TSample> output = input;
+    zeropad_inplace(output, size, center);
+
+    return output;
+}
+
+template <typename TSample>
+inline void zeropad_inplace(std::vector<TSample> &input, const int &size, const bool &center = true)
+{
+    if (size > input.size())
+    {
+        if (center)
+        {
+            int zeros = size - input.size();
+
+            if (zeros % 2)
+            {
+                zeros += 1;
+            }
+
+            input.insert(input.begin(), zeros / 2, (TSample)0.0);
+        }
+
+        input.resize(size, (TSample)0.0);
+    }
+}
+
+template <typename TSample>
+inline std::vector<TSample> zerophase(const std::vector<TSample> &input)
+{
+    std::vector<TSample> output = input;
+
+    zerophase_inplace(output);
+
+    return output;
+}
+
+template <typename TSample>
+inline void zerophase_inplace(std::vector<TSample> &input)
+{
+    auto middle = input.begin() + input.size() / 2;
+
+    std::rotate(input.begin(), middle, input.end());
+}
+
+template <typename TSample>
+inline std::vector<TSample> zeropadphase(const std::vector<TSample> &input, const int &size)
+{
+    std::vector<TSample> output = zeropad(input, size);
+    zerophase_inplace(output);
+
+    return output;
+}
+
+template <typename TSample>
+inline void zeropadphase_inplace(std::vector<TSample> &input, const int &size)
+{
+    zeropad_inplace(input, size);
+    zerophase_inplace(input);
+}
+}
+
+#endif // UTILS_H_
@@ -23,6 +23,12 @@ SOFTWARE.
 #ifndef WTOSC_H_
 #define WTOSC_H_
 
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <memory>
+
+#include "fft.h"
 #include "interp.h"
 #include "window_functions.h"
 
@@ -33,6 +39,150 @@ SOFTWARE.
 namespace soutel
 {
 
+enum class WTInterpolation
+{
+    cosine,
+    linear,
+    cubic
+};
+
+// A wavetable together with everything derived from it (window, guarded
+// copy, mipmaps). Once prepared it can be shared as
+// std::shared_ptr<const Wavetable> by any number of oscillators, which then
+// only keep their own phase.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class Wavetable
+{
+public:
+    Wavetable(const std::vector<TSample> &samples = {},
+              const bool &windowed = false,
+              const bool &antialiasing = true);
+
+    void set_samples(const std::vector<TSample> &samples, const bool &update_now = true);
+    void set_sample(const TSample &sample, const int &index, const bool &update_now = true);
+    void set_windowed(const bool &apply_window, const bool &update_now = true);
+    void set_windowed(const std::vector<TSample> &window);
+    void set_antialiasing(const bool &antialiasing);
+    void resize(const int &new_size);
+    void normalize(const TSample &amplitude = (TSample)1.0, const bool &update_now = true);
+    void crossfade(const TSample &fade = (TSample)0.05, const bool &update_now = true);
+    void update();
+
+    std::size_t size() const;
+    std::size_t get_memory() const;
+    const std::vector<TSample> &get_samples() const;
+    const std::vector<TSample> &get_window() const;
+    bool get_windowed() const;
+    bool get_antialiasing() const;
+    bool get_power_of_two() const;
+    unsigned int get_levels() const;
+    unsigned int get_index_shift() const;
+    uint32_t get_fraction_mask() const;
+    TSample get_fraction_scale() const;
+    std::size_t get_table_size() const;
+    inline const TSample *get_level(const unsigned int &level) const;
+
+    static std::vector<TSample> default_window(const std::size_t &size);
+
+private:
+    std::vector<TSample> samples_;
+    std::vector<TSample> original_samples_;
+    std::vector<TSample> window_;
+    bool windowed_ = false;
+    TSample fade_ = (TSample)0.0;
+
+    bool antialiasing_ = true;
+    std::vector<TSample> table_;
+    bool power_of_two_ = false;
+    std::size_t table_size_ = 0;
+    unsigned int levels_ = 0;
+    unsigned int index_shift_ = 32;
+    uint32_t fraction_mask_ = 0;
+    TSample fraction_scale_ = (TSample)0.0;
+
+    std::vector<TSample> window_scratch_;
+    std::vector<TSample> source_scratch_;
+    std::vector<std::complex<double>> spectrum_;
+    std::vector<std::complex<double>> level_spectrum_;
+
+    inline void generate_window_()
+    {
+        window_ = default_window(samples_.size());
+    }
+
+    // Levels before l take 2 * get_table_size() - 2 * (get_table_size() >> l)
+    // samples, plus three guards each.
+    inline std::size_t level_offset_(const unsigned int &level) const
+    {
+        return 2 * table_size_ - 2 * (table_size_ >> level) + 3 * level;
+    }
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+struct wavetable_reader
+{
+    const Wavetable<TSample> *wavetable = nullptr;
+    bool fixed = false;
+    unsigned int index_shift = 32;
+    uint32_t fraction_mask = 0;
+    TSample fraction_scale = (TSample)0.0;
+    unsigned int upper_index_shift = 32;
+    uint32_t upper_fraction_mask = 0;
+    TSample upper_fraction_scale = (TSample)0.0;
+    const TSample *lower_level = nullptr;
+    const TSample *upper_level = nullptr;
+    TSample level_fraction = (TSample)0.0;
+};
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+struct wavetable_swap
+{
+    std::shared_ptr<const Wavetable<TSample>> wavetable;
+    std::shared_ptr<Wavetable<TSample>> owned_wavetable;
+    TSample fade_time = (TSample)0.0;
+    wavetable_swap *next = nullptr;
+};
+
+// Hands wavetables over to the audio thread without locks or allocations on
+// its side. A non real-time thread pushes a new table, the audio thread pops
+// it and later retires the swap, now holding the table it replaced, onto a
+// list that only the non real-time thread frees. A copy starts empty.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+class WavetableExchange
+{
+public:
+    WavetableExchange() {}
+    WavetableExchange(const WavetableExchange &) {}
+    WavetableExchange &operator=(const WavetableExchange &);
+    ~WavetableExchange();
+
+    void push(wavetable_swap<TSample> *swap);
+    void collect();
+
+    inline wavetable_swap<TSample> *pop();
+    inline void retire(wavetable_swap<TSample> *swap);
+    inline void start_fade(wavetable_swap<TSample> *swap);
+    inline void end_fade();
+    inline bool fading();
+
+private:
+    std::atomic<wavetable_swap<TSample> *> pending_{nullptr};
+    std::atomic<wavetable_swap<TSample> *> retired_{nullptr};
+    wavetable_swap<TSample> *fading_ = nullptr;
+};
+
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
@@ -42,14 +192,25 @@ class WTOsc
 public:
     WTOsc(const TSample &sample_rate = (TSample)44100.0,
           const TSample &frequency = (TSample)0.0,
-          const std::vector<TSample> &wavetable = {});
+          const std::vector<TSample> &wavetable = {},
+          const WTInterpolation &interpolation = WTInterpolation::cosine);
+    WTOsc(const TSample &sample_rate,
+          const TSample &frequency,
+          const std::shared_ptr<const Wavetable<TSample>> &wavetable,
+          const WTInterpolation &interpolation = WTInterpolation::cosine);
 
     void set_sample_rate(const TSample &sample_rate);
     void set_frequency(const TSample &frequency);
     void set_wavetable(const std::vector<TSample> &wavetable);
-    void set_sample(const TSample &sample, const int &index);
+    void set_wavetable(const std::shared_ptr<const Wavetable<TSample>> &wavetable);
+    void queue_wavetable(const std::shared_ptr<const Wavetable<TSample>> &wavetable, const TSample &fade_time = (TSample)0.0);
+    void collect_wavetables();
+    void set_sample(const TSample &sample, const int &index, const bool &update_now = true);
+    void update_wavetable(const TSample &fade_time = (TSample)0.0);
     void set_windowed(const bool &apply_window);
     void set_windowed(const std::vector<TSample> &window);
+    void set_interpolation(const WTInterpolation &interpolation);
+    void set_antialiasing(const bool &antialiasing);
     void reset();
     void resize_wavetable(const int &new_size);
     void normalize(const TSample &amplitude = (TSample)1.0);
@@ -58,8 +219,11 @@ public:
     TSample get_sample_rate();
     TSample get_frequency();
     std::vector<TSample> get_wavetable();
+    std::shared_ptr<const Wavetable<TSample>> get_shared_wavetable();
     bool get_windowed();
     std::vector<TSample> get_window();
+    WTInterpolation get_interpolation();
+    bool get_antialiasing();
     TSample get_sample(const int &index);
 
     inline TSample run();
@@ -73,113 +237,182 @@ private:
     TSample frequency_;
 
     TSample step_;
-    TSample read_pos_;
     TSample output_;
 
-    std::vector<TSample> wavetable_;
-    std::vector<TSample> original_wavetable_;
-    std::vector<TSample> window_;
-    bool windowed_ = false;
-    TSample fade_ = (TSample)0.0;
+    std::shared_ptr<const Wavetable<TSample>> wavetable_;
+    std::shared_ptr<Wavetable<TSample>> owned_wavetable_;
+    std::shared_ptr<Wavetable<TSample>> staged_wavetable_;
+    std::shared_ptr<const Wavetable<TSample>> next_wavetable_;
 
-    inline void generate_window_()
-    {
-        if (!wavetable_.empty())
-        {
-            window_.resize(wavetable_.size());
-            for (auto i = 0; i < wavetable_.size(); i++)
-            {
-                window_[i] = hann((TSample)i / (TSample)(wavetable_.size() - 1));
-            }
-        }
-        else
-        {
-            window_.resize(512);
-            for (auto i = 0; i < 512; i++)
-            {
-                window_[i] = hann((TSample)i / (TSample)511.0);
-            }
-        }
-    }
+    WTInterpolation interpolation_ = WTInterpolation::cosine;
+    uint32_t phase_ = 0;
+    uint32_t phase_step_ = 0;
+    wavetable_reader<TSample> reader_;
+
+    WavetableExchange<TSample> exchange_;
+    wavetable_reader<TSample> fade_reader_;
+    TSample fade_position_ = (TSample)0.0;
+    TSample fade_step_ = (TSample)0.0;
+
+    static constexpr double phase_range_ = 4294967296.0;
+
+    inline Wavetable<TSample> &edit_wavetable_();
+    inline const Wavetable<TSample> &latest_wavetable_();
+    inline void bind_wavetable_();
+    inline void swap_wavetable_(wavetable_swap<TSample> *swap);
+    inline void update_levels_(wavetable_reader<TSample> &reader);
+    inline TSample read_(const wavetable_reader<TSample> &reader);
+    inline TSample read_points_(const TSample *points, const TSample &fraction);
 };
 
+// Scans a set of single cycle frames of the same size, stored one after the
+// other with guard samples around each of them. The position goes from the
+// first (0) to the last frame (1), crossfading the two nearest ones, and can
+// be modulated at every sample through run(position) without allocations.
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-WTOsc<TSample>::WTOsc(const TSample &sample_rate, const TSample &frequency, const std::vector<TSample> &wavetable)
+class WTScanOsc
 {
-    frequency_ = frequency;
+public:
+    WTScanOsc(const TSample &sample_rate = (TSample)44100.0,
+              const TSample &frequency = (TSample)0.0,
+              const std::vector<std::vector<TSample>> &frames = {},
+              const WTInterpolation &interpolation = WTInterpolation::linear);
 
-    set_sample_rate(sample_rate);
+    void set_sample_rate(const TSample &sample_rate);
+    void set_frequency(const TSample &frequency);
+    void set_frames(const std::vector<std::vector<TSample>> &frames);
+    void set_frames(const std::vector<TSample> &samples, const int &frame_size);
+    void set_position(const TSample &position);
+    void set_interpolation(const WTInterpolation &interpolation);
+    void reset();
 
-    set_wavetable(wavetable);
+    TSample get_sample_rate();
+    TSample get_frequency();
+    unsigned int get_frames();
+    unsigned int get_frame_size();
+    std::vector<TSample> get_frame(const int &frame);
+    TSample get_position();
+    WTInterpolation get_interpolation();
+
+    inline TSample run();
+    inline TSample run(const TSample &position);
 
-    generate_window_();
+    inline TSample get_last_sample();
 
-    reset();
-}
+private:
+    TSample sample_rate_;
+    TSample inv_sample_rate_;
+
+    TSample frequency_;
+
+    TSample step_;
+    TSample output_ = (TSample)0.0;
+
+    std::vector<TSample> table_;
+    unsigned int frames_ = 0;
+    unsigned int frame_size_ = 0;
+
+    WTInterpolation interpolation_ = WTInterpolation::linear;
+    uint32_t phase_ = 0;
+    uint32_t phase_step_ = 0;
+
+    TSample position_ = (TSample)0.0;
+    std::size_t lower_frame_ = 0;
+    std::size_t upper_frame_ = 0;
+    TSample frame_fraction_ = (TSample)0.0;
+
+    static constexpr double phase_range_ = 4294967296.0;
+
+    inline void write_frame_(const TSample *samples, const unsigned int &frame);
+    inline TSample read_(const TSample *points, const TSample &fraction);
+};
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::set_sample_rate(const TSample &sample_rate)
+Wavetable<TSample>::Wavetable(const std::vector<TSample> &samples, const bool &windowed, const bool &antialiasing)
 {
-    sample_rate_ = std::max((TSample)1.0, sample_rate);
-    inv_sample_rate_ = (TSample)1.0 / sample_rate_;
+    windowed_ = windowed;
+    antialiasing_ = antialiasing;
 
-    set_frequency(frequency_);
-
-    reset();
+    set_samples(samples);
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::set_frequency(const TSample &frequency)
+void Wavetable<TSample>::set_samples(const std::vector<TSample> &samples, const bool &update_now)
 {
-    frequency_ = frequency;
+    samples_ = samples;
+    original_samples_ = samples_;
+    window_.clear();
+    if (windowed_)
+    {
+        generate_window_();
+    }
 
-    step_ = frequency_ * inv_sample_rate_;
+    if (update_now)
+    {
+        update();
+    }
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::set_wavetable(const std::vector<TSample> &wavetable)
+void Wavetable<TSample>::set_sample(const TSample &sample, const int &index, const bool &update_now)
 {
-    wavetable_ = wavetable;
-    original_wavetable_ = wavetable_;
-    generate_window_();
+    if (index >= 0 && index < (int)samples_.size())
+    {
+        samples_[index] = sample;
+
+        if (update_now)
+        {
+            update();
+        }
+    }
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::set_windowed(const bool &apply_window)
+void Wavetable<TSample>::set_windowed(const bool &apply_window, const bool &update_now)
 {
     windowed_ = apply_window;
+    if (windowed_ && window_.empty())
+    {
+        generate_window_();
+    }
+
+    if (update_now)
+    {
+        update();
+    }
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::set_windowed(const std::vector<TSample> &window)
+void Wavetable<TSample>::set_windowed(const std::vector<TSample> &window)
 {
     if (window.empty())
     {
         windowed_ = false;
+        update();
         return;
     }
 
-    if (window.size() != wavetable_.size())
+    if (window.size() != samples_.size())
     {
-        window_ = resize_chunk(window, wavetable_.size());
+        window_ = resize_chunk(window, samples_.size());
     }
     else
     {
@@ -187,14 +420,66 @@ void WTOsc<TSample>::set_windowed(const std::vector<TSample> &window)
     }
 
     windowed_ = true;
+    update();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void Wavetable<TSample>::set_antialiasing(const bool &antialiasing)
+{
+    antialiasing_ = antialiasing;
+    update();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void Wavetable<TSample>::resize(const int &new_size)
+{
+    samples_ = resize_chunk(samples_, (unsigned int)std::abs(new_size));
+    update();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void Wavetable<TSample>::normalize(const TSample &amplitude, const bool &update_now)
+{
+    TSample max_value = 0.0;
+
+    for (const auto& sample : samples_)
+    {
+        if (std::abs(sample) > max_value)
+        {
+            max_value = std::abs(sample);
+        }
+    }
+
+    TSample gain = max_value != (TSample)0.0 ? amplitude / max_value : (TSample)0.0;
+    for (auto& sample : samples_)
+    {
+        if (std::abs(sample) > max_value)
+        {
+            sample *= gain;
+        }
+    }
+
+    if (update_now)
+    {
+        update();
+    }
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::crossfade(const TSample &fade) {
-    unsigned int s = wavetable_.size();
+void Wavetable<TSample>::crossfade(const TSample &fade, const bool &update_now) {
+    unsigned int s = samples_.size();
     fade_ = fade;
     unsigned int fade_length = static_cast<size_t>(s * fade_);
     
@@ -203,41 +488,161 @@ void WTOsc<TSample>::crossfade(const TSample &fade) {
         return;
     }
 
-    wavetable_ = original_wavetable_;
+    samples_ = original_samples_;
     
-    for (auto i = 0; i < fade_length; ++i)
+    for (unsigned int i = 0; i < fade_length; ++i)
     {
         const TSample t = static_cast<TSample>(i) / static_cast<TSample>(fade_length);
         const unsigned int end_index = s - fade_length + i;
         
         const TSample crossfaded_value_start = linip(
-            wavetable_[end_index],
-            wavetable_[i],          
+            samples_[end_index],
+            samples_[i],          
             t
         );
         
-        wavetable_[i] = crossfaded_value_start;
+        samples_[i] = crossfaded_value_start;
 
         const TSample crossfaded_value_end = linip(
-            wavetable_[i],
-            wavetable_[end_index],
+            samples_[i],
+            samples_[end_index],
             t
         );
 
-        wavetable_[end_index] = crossfaded_value_end;
+        samples_[end_index] = crossfaded_value_end;
     }
 
+    if (update_now)
+    {
+        update();
+    }
 }
 
+// Every table of at least two samples is also kept in table_, with the
+// window already applied and guard samples around it (the last one before,
+// the first two after), so that an oscillator can read the four cubic
+// points straight from the integer part of a 32 bit phase, with no
+// wrapping. On this path the table is read as a single periodic cycle, and
+// a table whose size is not a power of two is first resampled, with cubic
+// interpolation, to the next one (get_table_size()).
+// With antialiasing enabled, table_ holds one level per octave after the
+// first: level l keeps only the harmonics up to get_table_size() / 2^(l + 1),
+// cut in the frequency domain, and is therefore stored with
+// get_table_size() / 2^l samples, about twice the first level in total. The
+// FFT buffers are kept between calls, so that rebuilding a table whose size
+// did not change does not allocate.
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::set_sample(const TSample &sample, const int &index)
+void Wavetable<TSample>::update()
 {
-    if (index >= 0 && index < wavetable_.size())
+    auto size = samples_.size();
+    power_of_two_ = size >= 2 && (size & (size - 1)) == 0;
+
+    if (size < 2)
+    {
+        table_.clear();
+        table_size_ = 0;
+        levels_ = 0;
+        return;
+    }
+
+    index_shift_ = 32;
+    table_size_ = 1;
+    while (table_size_ < size)
+    {
+        table_size_ <<= 1;
+        index_shift_--;
+    }
+    fraction_mask_ = ((uint32_t)1 << index_shift_) - 1;
+    fraction_scale_ = (TSample)(1.0 / (double)((uint64_t)1 << index_shift_));
+
+    const TSample *window = window_.data();
+    if (windowed_ && window_.size() != size)
+    {
+        window_scratch_ = resize_chunk(window_, size);
+        window = window_scratch_.data();
+    }
+
+    levels_ = antialiasing_ ? 32 - index_shift_ : 1;
+    table_.resize(level_offset_(levels_));
+
+    TSample *points = table_.data();
+
+    if (power_of_two_)
+    {
+        for (std::size_t i = 0; i < size; i++)
+        {
+            points[i + 1] = windowed_ ? samples_[i] * window[i] : samples_[i];
+        }
+    }
+    else
+    {
+        // The source gets the same guards as the table, so that the cubic
+        // points never wrap.
+        source_scratch_.resize(size + 3);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            source_scratch_[i + 1] = windowed_ ? samples_[i] * window[i] : samples_[i];
+        }
+        source_scratch_[0] = source_scratch_[size];
+        source_scratch_[size + 1] = source_scratch_[1];
+        source_scratch_[size + 2] = source_scratch_[2];
+
+        const double ratio = (double)size / (double)table_size_;
+        for (std::size_t i = 0; i < table_size_; i++)
+        {
+            const double position = (double)i * ratio;
+            const std::size_t index = (std::size_t)position;
+            const TSample *source = source_scratch_.data() + index;
+            points[i + 1] = cubip(source[0], source[1], source[2], source[3], (TSample)(position - (double)index));
+        }
+    }
+    points[0] = points[table_size_];
+    points[table_size_ + 1] = points[1];
+    points[table_size_ + 2] = points[2];
+
+    if (levels_ > 1)
     {
-        wavetable_[index] = sample;
+        const std::size_t half_size = table_size_ >> 1;
+
+        spectrum_.resize(half_size);
+        for (std::size_t i = 0; i < half_size; i++)
+        {
+            spectrum_[i] = std::complex<double>((double)points[2 * i + 1], (double)points[2 * i + 2]);
+        }
+        real_fft(spectrum_);
+
+        // Level l is the inverse transform of the bins it keeps, folded into
+        // a spectrum of its own size. The bin at its Nyquist frequency sums
+        // the positive and negative one, and the gain makes up for the
+        // shorter transform. The table is real, so only the positive half of
+        // each spectrum is handled, packed as real_fft() gives it.
+        for (unsigned int l = 1; l < levels_; l++)
+        {
+            const std::size_t level_size = table_size_ >> l;
+            const std::size_t cutoff = level_size >> 1;
+            const double gain = 1.0 / (double)((std::size_t)1 << l);
+
+            level_spectrum_.resize(cutoff);
+            level_spectrum_[0] = std::complex<double>(spectrum_[0].real(), 2.0 * spectrum_[cutoff].real()) * gain;
+            for (std::size_t k = 1; k < cutoff; k++)
+            {
+                level_spectrum_[k] = spectrum_[k] * gain;
+            }
+            real_ifft(level_spectrum_);
+
+            points = table_.data() + level_offset_(l);
+            for (std::size_t i = 0; i < cutoff; i++)
+            {
+                points[2 * i + 1] = (TSample)level_spectrum_[i].real();
+                points[2 * i + 2] = (TSample)level_spectrum_[i].imag();
+            }
+            points[0] = points[level_size];
+            points[level_size + 1] = points[1];
+            points[level_size + 2] = points[2];
+        }
     }
 }
 
@@ -245,136 +650,1060 @@ template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-TSample WTOsc<TSample>::get_sample_rate()
+std::size_t Wavetable<TSample>::size() const
 {
-    return sample_rate_;
+    return samples_.size();
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-TSample WTOsc<TSample>::get_frequency()
+std::size_t Wavetable<TSample>::get_memory() const
 {
-    return frequency_;
+    return sizeof(Wavetable) + (samples_.capacity() + original_samples_.capacity() + window_.capacity() + table_.capacity() +
+                                window_scratch_.capacity() + source_scratch_.capacity()) * sizeof(TSample) +
+           (spectrum_.capacity() + level_spectrum_.capacity()) * sizeof(std::complex<double>);
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-std::vector<TSample> WTOsc<TSample>::get_wavetable()
+const std::vector<TSample> &Wavetable<TSample>::get_samples() const
 {
-    return wavetable_;
+    return samples_;
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-bool WTOsc<TSample>::get_windowed()
+const std::vector<TSample> &Wavetable<TSample>::get_window() const
 {
-    return windowed_;
+    return window_;
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-std::vector<TSample> WTOsc<TSample>::get_window()
+bool Wavetable<TSample>::get_windowed() const
 {
-    return window_;
+    return windowed_;
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-TSample WTOsc<TSample>::get_sample(const int &index)
+bool Wavetable<TSample>::get_antialiasing() const
 {
-    if (index >= 0 && index < wavetable_.size())
-    {
-        return wavetable_.at(index);
-    }
-
-    return (TSample)0.0;
+    return antialiasing_;
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::reset()
+bool Wavetable<TSample>::get_power_of_two() const
 {
-    read_pos_ = (TSample)0.0;
+    return power_of_two_;
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::resize_wavetable(const int &new_size)
+unsigned int Wavetable<TSample>::get_levels() const
 {
-    wavetable_ = resize_chunk(wavetable_, (unsigned int)std::abs(new_size));
+    return levels_;
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-void WTOsc<TSample>::normalize(const TSample &amplitude)
+unsigned int Wavetable<TSample>::get_index_shift() const
 {
-    TSample max_value = 0.0;
+    return index_shift_;
+}
 
-    for (const auto& sample : wavetable_)
-    {
-        if (std::abs(sample) > max_value)
-        {
-            max_value = std::abs(sample);
-        }
-    }
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+uint32_t Wavetable<TSample>::get_fraction_mask() const
+{
+    return fraction_mask_;
+}
 
-    TSample gain = max_value != (TSample)0.0 ? amplitude / max_value : (TSample)0.0;
-    for (auto& sample : wavetable_)
-    {
-        if (std::abs(sample) > max_value)
-        {
-            sample *= gain;
-        }
-    }
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample Wavetable<TSample>::get_fraction_scale() const
+{
+    return fraction_scale_;
 }
 
 template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-inline TSample WTOsc<TSample>::run()
+inline const TSample *Wavetable<TSample>::get_level(const unsigned int &level) const
 {
-    if (wavetable_.empty())
+    if (level >= levels_)
     {
-        return (TSample)0.0;
+        return nullptr;
     }
-    
-    read_pos_ += step_;
-    while (read_pos_ > (TSample)1.0)
+
+    return table_.data() + level_offset_(level);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::size_t Wavetable<TSample>::get_table_size() const
+{
+    return table_size_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> Wavetable<TSample>::default_window(const std::size_t &size)
+{
+    const std::size_t window_size = size > 0 ? size : 512;
+    std::vector<TSample> window(window_size);
+
+    for (std::size_t i = 0; i < window_size; i++)
+    {
+        window[i] = hann((TSample)i / (TSample)(window_size - 1));
+    }
+
+    return window;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+WavetableExchange<TSample> &WavetableExchange<TSample>::operator=(const WavetableExchange &)
+{
+    delete fading_;
+    fading_ = nullptr;
+
+    return *this;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+WavetableExchange<TSample>::~WavetableExchange()
+{
+    delete pending_.exchange(nullptr);
+    delete fading_;
+    collect();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WavetableExchange<TSample>::push(wavetable_swap<TSample> *swap)
+{
+    collect();
+
+    delete pending_.exchange(swap, std::memory_order_acq_rel);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WavetableExchange<TSample>::collect()
+{
+    wavetable_swap<TSample> *swap = retired_.exchange(nullptr, std::memory_order_acquire);
+
+    while (swap)
+    {
+        wavetable_swap<TSample> *next = swap->next;
+        delete swap;
+        swap = next;
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline wavetable_swap<TSample> *WavetableExchange<TSample>::pop()
+{
+    if (pending_.load(std::memory_order_relaxed) == nullptr)
+    {
+        return nullptr;
+    }
+
+    return pending_.exchange(nullptr, std::memory_order_acquire);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void WavetableExchange<TSample>::retire(wavetable_swap<TSample> *swap)
+{
+    swap->next = retired_.load(std::memory_order_relaxed);
+
+    while (!retired_.compare_exchange_weak(swap->next, swap, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void WavetableExchange<TSample>::start_fade(wavetable_swap<TSample> *swap)
+{
+    end_fade();
+    fading_ = swap;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void WavetableExchange<TSample>::end_fade()
+{
+    if (fading_)
+    {
+        retire(fading_);
+        fading_ = nullptr;
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline bool WavetableExchange<TSample>::fading()
+{
+    return fading_ != nullptr;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+WTOsc<TSample>::WTOsc(const TSample &sample_rate, const TSample &frequency, const std::vector<TSample> &wavetable,
+                      const WTInterpolation &interpolation)
+{
+    frequency_ = frequency;
+    interpolation_ = interpolation;
+
+    set_sample_rate(sample_rate);
+
+    set_wavetable(wavetable);
+
+    reset();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+WTOsc<TSample>::WTOsc(const TSample &sample_rate, const TSample &frequency, const std::shared_ptr<const Wavetable<TSample>> &wavetable,
+                      const WTInterpolation &interpolation)
+{
+    frequency_ = frequency;
+    interpolation_ = interpolation;
+
+    set_sample_rate(sample_rate);
+
+    set_wavetable(wavetable);
+
+    reset();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::set_sample_rate(const TSample &sample_rate)
+{
+    sample_rate_ = std::max((TSample)1.0, sample_rate);
+    inv_sample_rate_ = (TSample)1.0 / sample_rate_;
+
+    set_frequency(frequency_);
+
+    reset();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::set_frequency(const TSample &frequency)
+{
+    frequency_ = frequency;
+
+    step_ = frequency_ * inv_sample_rate_;
+
+    double wrapped_step = (double)step_ - std::floor((double)step_);
+    phase_step_ = (uint32_t)(uint64_t)(wrapped_step * phase_range_ + 0.5);
+
+    update_levels_(reader_);
+
+    if (exchange_.fading())
+    {
+        update_levels_(fade_reader_);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::set_wavetable(const std::vector<TSample> &wavetable)
+{
+    staged_wavetable_.reset();
+    next_wavetable_.reset();
+
+    if (wavetable_ && owned_wavetable_ == wavetable_ && owned_wavetable_.use_count() == 2)
+    {
+        owned_wavetable_->set_samples(wavetable);
+    }
+    else
+    {
+        bool windowed = wavetable_ ? wavetable_->get_windowed() : false;
+        bool antialiasing = wavetable_ ? wavetable_->get_antialiasing() : true;
+        owned_wavetable_ = std::make_shared<Wavetable<TSample>>(wavetable, windowed, antialiasing);
+        wavetable_ = owned_wavetable_;
+    }
+
+    bind_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::set_wavetable(const std::shared_ptr<const Wavetable<TSample>> &wavetable)
+{
+    if (!wavetable)
+    {
+        set_wavetable(std::vector<TSample>());
+        return;
+    }
+
+    staged_wavetable_.reset();
+    next_wavetable_.reset();
+
+    wavetable_ = wavetable;
+    owned_wavetable_.reset();
+
+    bind_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::queue_wavetable(const std::shared_ptr<const Wavetable<TSample>> &wavetable, const TSample &fade_time)
+{
+    if (wavetable)
+    {
+        wavetable_swap<TSample> *swap = new wavetable_swap<TSample>;
+        swap->wavetable = wavetable;
+        swap->fade_time = std::max((TSample)0.0, fade_time);
+
+        next_wavetable_ = wavetable;
+        exchange_.push(swap);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::collect_wavetables()
+{
+    exchange_.collect();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::set_windowed(const bool &apply_window)
+{
+    edit_wavetable_().set_windowed(apply_window);
+    bind_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::set_windowed(const std::vector<TSample> &window)
+{
+    edit_wavetable_().set_windowed(window);
+    bind_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::set_interpolation(const WTInterpolation &interpolation)
+{
+    interpolation_ = interpolation;
+
+    bind_wavetable_();
+
+    if (exchange_.fading())
+    {
+        fade_reader_.fixed = fade_reader_.wavetable->get_levels() > 0;
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::set_antialiasing(const bool &antialiasing)
+{
+    edit_wavetable_().set_antialiasing(antialiasing);
+    bind_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::crossfade(const TSample &fade)
+{
+    edit_wavetable_().crossfade(fade);
+    bind_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::set_sample(const TSample &sample, const int &index, const bool &update_now)
+{
+    if (index >= 0 && index < (int)latest_wavetable_().size())
+    {
+        if (!staged_wavetable_)
+        {
+            staged_wavetable_ = std::make_shared<Wavetable<TSample>>(latest_wavetable_());
+        }
+
+        staged_wavetable_->set_sample(sample, index, false);
+
+        if (update_now)
+        {
+            update_wavetable();
+        }
+    }
+}
+
+// Single samples are written to a private copy of the table, which the audio
+// thread never sees. Here the copy is rebuilt, on the calling thread, and
+// handed to run() through the exchange like a queued table, so that a batch
+// of set_sample(..., false) calls costs a single rebuild and run() never
+// allocates.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::update_wavetable(const TSample &fade_time)
+{
+    if (staged_wavetable_)
+    {
+        staged_wavetable_->update();
+
+        wavetable_swap<TSample> *swap = new wavetable_swap<TSample>;
+        swap->wavetable = staged_wavetable_;
+        swap->owned_wavetable = staged_wavetable_;
+        swap->fade_time = std::max((TSample)0.0, fade_time);
+
+        next_wavetable_ = staged_wavetable_;
+        staged_wavetable_.reset();
+        exchange_.push(swap);
+    }
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample WTOsc<TSample>::get_sample_rate()
+{
+    return sample_rate_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample WTOsc<TSample>::get_frequency()
+{
+    return frequency_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> WTOsc<TSample>::get_wavetable()
+{
+    return latest_wavetable_().get_samples();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::shared_ptr<const Wavetable<TSample>> WTOsc<TSample>::get_shared_wavetable()
+{
+    return wavetable_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool WTOsc<TSample>::get_windowed()
+{
+    return wavetable_->get_windowed();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> WTOsc<TSample>::get_window()
+{
+    if (wavetable_->get_window().empty())
+    {
+        return Wavetable<TSample>::default_window(wavetable_->size());
+    }
+
+    return wavetable_->get_window();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+WTInterpolation WTOsc<TSample>::get_interpolation()
+{
+    return interpolation_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+bool WTOsc<TSample>::get_antialiasing()
+{
+    return wavetable_->get_antialiasing();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample WTOsc<TSample>::get_sample(const int &index)
+{
+    const Wavetable<TSample> &wavetable = latest_wavetable_();
+
+    if (index >= 0 && index < (int)wavetable.size())
+    {
+        return wavetable.get_samples().at(index);
+    }
+
+    return (TSample)0.0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::reset()
+{
+    phase_ = 0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::resize_wavetable(const int &new_size)
+{
+    edit_wavetable_().resize(new_size);
+    bind_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTOsc<TSample>::normalize(const TSample &amplitude)
+{
+    edit_wavetable_().normalize(amplitude);
+    bind_wavetable_();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample WTOsc<TSample>::run()
+{
+    wavetable_swap<TSample> *swap = exchange_.pop();
+    if (swap)
+    {
+        swap_wavetable_(swap);
+    }
+
+    phase_ += phase_step_;
+
+    output_ = read_(reader_);
+
+    if (exchange_.fading())
+    {
+        output_ = linip(read_(fade_reader_), output_, fade_position_);
+
+        fade_position_ += fade_step_;
+        if (fade_position_ >= (TSample)1.0)
+        {
+            exchange_.end_fade();
+        }
+    }
+
+    return output_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample WTOsc<TSample>::get_last_sample()
+{
+    return output_;
+}
+
+// Edits never touch a table that other oscillators may be reading: unless
+// this oscillator is the only owner of the table it created, it gets its
+// own copy first. Samples still waiting in the staged copy are applied at
+// once, like the edit itself.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline Wavetable<TSample> &WTOsc<TSample>::edit_wavetable_()
+{
+    if (staged_wavetable_)
+    {
+        staged_wavetable_->update();
+        owned_wavetable_ = staged_wavetable_;
+        wavetable_ = owned_wavetable_;
+        staged_wavetable_.reset();
+        next_wavetable_.reset();
+    }
+
+    if (!owned_wavetable_ || owned_wavetable_ != wavetable_ || owned_wavetable_.use_count() > 2)
+    {
+        owned_wavetable_ = std::make_shared<Wavetable<TSample>>(*wavetable_);
+        wavetable_ = owned_wavetable_;
+    }
+
+    return *owned_wavetable_;
+}
+
+// The table the oscillator will be playing once pending edits and swaps
+// have gone through.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline const Wavetable<TSample> &WTOsc<TSample>::latest_wavetable_()
+{
+    if (staged_wavetable_)
     {
-        read_pos_ -= (TSample)1.0;
+        return *staged_wavetable_;
     }
-    while (read_pos_ < (TSample)0.0)
+
+    return next_wavetable_ ? *next_wavetable_ : *wavetable_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void WTOsc<TSample>::bind_wavetable_()
+{
+    reader_.wavetable = wavetable_.get();
+    reader_.fixed = wavetable_->get_levels() > 0;
+
+    update_levels_(reader_);
+}
+
+// The swap arrives holding the new table and leaves holding the old one, so
+// that no reference count drops to zero here. During a fade the old table is
+// still read through fade_reader_, and the swap is retired when it ends.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void WTOsc<TSample>::swap_wavetable_(wavetable_swap<TSample> *swap)
+{
+    fade_reader_ = reader_;
+
+    std::swap(wavetable_, swap->wavetable);
+    std::swap(owned_wavetable_, swap->owned_wavetable);
+    bind_wavetable_();
+
+    TSample fade_samples = swap->fade_time * (TSample)0.001 * sample_rate_;
+
+    if (fade_samples >= (TSample)1.0)
+    {
+        exchange_.start_fade(swap);
+        fade_position_ = (TSample)0.0;
+        fade_step_ = (TSample)1.0 / fade_samples;
+    }
+    else
     {
-        read_pos_ += (TSample)1.0;
+        exchange_.end_fade();
+        exchange_.retire(swap);
     }
+}
 
-    TSample wt_point = read_pos_ * (TSample)(wavetable_.size() - 1);
-    int pos1 = (int)std::floor(wt_point) % wavetable_.size();
-    int pos2 = (int)std::ceil(wt_point) % wavetable_.size();
+// The level is chosen so that even the brighter of the two crossfaded ones
+// has no harmonic above Nyquist: at position
+// p = log2(get_table_size() * |step|) + 1 level floor(p) stops at
+// 2^(p - floor(p) - 1) times Nyquist. Level l has 2^l times fewer samples
+// than the first, so its index takes l more bits of the phase.
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void WTOsc<TSample>::update_levels_(wavetable_reader<TSample> &reader)
+{
+    reader.level_fraction = (TSample)0.0;
 
-    output_ = cosip(wavetable_.at(pos1), wavetable_.at(pos2), wt_point - std::floor(wt_point));
+    if (!reader.wavetable || reader.wavetable->get_levels() == 0)
+    {
+        reader.lower_level = nullptr;
+        reader.upper_level = nullptr;
+        return;
+    }
 
-    if (windowed_)
+    const unsigned int levels = reader.wavetable->get_levels();
+    unsigned int lower = 0;
+    unsigned int upper = 0;
+
+    if (levels > 1)
+    {
+        double position = std::log2((double)reader.wavetable->get_table_size() * std::abs((double)step_)) + 1.0;
+        position = std::clamp(position, 0.0, (double)(levels - 1));
+
+        lower = (unsigned int)std::floor(position);
+        upper = std::min(lower + 1, levels - 1);
+        reader.level_fraction = upper != lower ? (TSample)(position - (double)lower) : (TSample)0.0;
+    }
+
+    reader.lower_level = reader.wavetable->get_level(lower);
+    reader.index_shift = reader.wavetable->get_index_shift() + lower;
+    reader.fraction_mask = ((uint32_t)1 << reader.index_shift) - 1;
+    reader.fraction_scale = (TSample)(1.0 / (double)((uint64_t)1 << reader.index_shift));
+
+    reader.upper_level = reader.wavetable->get_level(upper);
+    reader.upper_index_shift = reader.wavetable->get_index_shift() + upper;
+    reader.upper_fraction_mask = ((uint32_t)1 << reader.upper_index_shift) - 1;
+    reader.upper_fraction_scale = (TSample)(1.0 / (double)((uint64_t)1 << reader.upper_index_shift));
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample WTOsc<TSample>::read_(const wavetable_reader<TSample> &reader)
+{
+    if (reader.fixed)
+    {
+        TSample output = read_points_(reader.lower_level + (phase_ >> reader.index_shift),
+                                      (TSample)(phase_ & reader.fraction_mask) * reader.fraction_scale);
+
+        if (reader.level_fraction != (TSample)0.0)
+        {
+            TSample upper_output = read_points_(reader.upper_level + (phase_ >> reader.upper_index_shift),
+                                                (TSample)(phase_ & reader.upper_fraction_mask) * reader.upper_fraction_scale);
+
+            output = linip(output, upper_output, reader.level_fraction);
+        }
+
+        return output;
+    }
+
+    // Only tables shorter than two samples have no levels: they are silent
+    // or hold their one sample.
+    const std::vector<TSample> &wavetable = reader.wavetable->get_samples();
+
+    return wavetable.empty() ? (TSample)0.0 : wavetable[0];
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample WTOsc<TSample>::read_points_(const TSample *points, const TSample &fraction)
+{
+    if (interpolation_ == WTInterpolation::linear)
+    {
+        return linip(points[1], points[2], fraction);
+    }
+    else if (interpolation_ == WTInterpolation::cubic)
+    {
+        return cubip(points[0], points[1], points[2], points[3], fraction);
+    }
+
+    return cosip(points[1], points[2], fraction);
+}
+
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+WTScanOsc<TSample>::WTScanOsc(const TSample &sample_rate, const TSample &frequency, const std::vector<std::vector<TSample>> &frames,
+                              const WTInterpolation &interpolation)
+{
+    frequency_ = frequency;
+    interpolation_ = interpolation;
+
+    set_sample_rate(sample_rate);
+
+    set_frames(frames);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTScanOsc<TSample>::set_sample_rate(const TSample &sample_rate)
+{
+    sample_rate_ = std::max((TSample)1.0, sample_rate);
+    inv_sample_rate_ = (TSample)1.0 / sample_rate_;
+
+    set_frequency(frequency_);
+
+    reset();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTScanOsc<TSample>::set_frequency(const TSample &frequency)
+{
+    frequency_ = frequency;
+
+    step_ = frequency_ * inv_sample_rate_;
+
+    double wrapped_step = (double)step_ - std::floor((double)step_);
+    phase_step_ = (uint32_t)(uint64_t)(wrapped_step * phase_range_ + 0.5);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTScanOsc<TSample>::set_frames(const std::vector<std::vector<TSample>> &frames)
+{
+    frame_size_ = frames.empty() ? 0 : frames.front().size();
+    frames_ = frame_size_ > 0 ? frames.size() : 0;
+    table_.resize(frames_ * (frame_size_ + 3));
+
+    for (unsigned int f = 0; f < frames_; f++)
+    {
+        if (frames.at(f).size() == frame_size_)
+        {
+            write_frame_(frames.at(f).data(), f);
+        }
+        else
+        {
+            write_frame_(resize_chunk(frames.at(f), frame_size_).data(), f);
+        }
+    }
+
+    set_position(position_);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTScanOsc<TSample>::set_frames(const std::vector<TSample> &samples, const int &frame_size)
+{
+    frame_size_ = std::max(frame_size, 0);
+    frames_ = frame_size_ > 0 ? samples.size() / frame_size_ : 0;
+    if (frames_ == 0)
+    {
+        frame_size_ = 0;
+    }
+    table_.resize(frames_ * (frame_size_ + 3));
+
+    for (unsigned int f = 0; f < frames_; f++)
     {
-        TSample window_sample = cosip(window_.at(pos1), window_.at(pos2), wt_point - std::floor(wt_point));
-        output_ *= window_sample;
+        write_frame_(samples.data() + f * frame_size_, f);
+    }
+
+    set_position(position_);
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTScanOsc<TSample>::set_position(const TSample &position)
+{
+    position_ = std::clamp(position, (TSample)0.0, (TSample)1.0);
+
+    if (frames_ < 2)
+    {
+        lower_frame_ = 0;
+        upper_frame_ = 0;
+        frame_fraction_ = (TSample)0.0;
+        return;
+    }
+
+    const TSample frame_position = position_ * (TSample)(frames_ - 1);
+    const unsigned int frame = std::min((unsigned int)frame_position, frames_ - 2);
+
+    lower_frame_ = frame * (frame_size_ + 3);
+    upper_frame_ = lower_frame_ + frame_size_ + 3;
+    frame_fraction_ = frame_position - (TSample)frame;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTScanOsc<TSample>::set_interpolation(const WTInterpolation &interpolation)
+{
+    interpolation_ = interpolation;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+void WTScanOsc<TSample>::reset()
+{
+    phase_ = 0;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample WTScanOsc<TSample>::get_sample_rate()
+{
+    return sample_rate_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample WTScanOsc<TSample>::get_frequency()
+{
+    return frequency_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+unsigned int WTScanOsc<TSample>::get_frames()
+{
+    return frames_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+unsigned int WTScanOsc<TSample>::get_frame_size()
+{
+    return frame_size_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+std::vector<TSample> WTScanOsc<TSample>::get_frame(const int &frame)
+{
+    if (frame >= 0 && frame < (int)frames_)
+    {
+        const TSample *points = table_.data() + frame * (frame_size_ + 3) + 1;
+        return std::vector<TSample>(points, points + frame_size_);
+    }
+
+    return std::vector<TSample>();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+TSample WTScanOsc<TSample>::get_position()
+{
+    return position_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+WTInterpolation WTScanOsc<TSample>::get_interpolation()
+{
+    return interpolation_;
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample WTScanOsc<TSample>::run()
+{
+    if (frames_ == 0)
+    {
+        output_ = (TSample)0.0;
+        return output_;
+    }
+
+    phase_ += phase_step_;
+
+    const uint64_t scaled_phase = (uint64_t)phase_ * frame_size_;
+    const std::size_t index = scaled_phase >> 32;
+    const TSample fraction = (TSample)((double)(uint32_t)scaled_phase / phase_range_);
+
+    output_ = read_(table_.data() + lower_frame_ + index, fraction);
+
+    if (frame_fraction_ != (TSample)0.0)
+    {
+        output_ = linip(output_, read_(table_.data() + upper_frame_ + index, fraction), frame_fraction_);
     }
 
     return output_;
@@ -384,11 +1713,57 @@ template <typename TSample>
 #if __cplusplus >= 202002L
 requires std::floating_point<TSample>
 #endif
-inline TSample WTOsc<TSample>::get_last_sample()
+inline TSample WTScanOsc<TSample>::run(const TSample &position)
+{
+    set_position(position);
+
+    return run();
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample WTScanOsc<TSample>::get_last_sample()
 {
     return output_;
 }
 
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline void WTScanOsc<TSample>::write_frame_(const TSample *samples, const unsigned int &frame)
+{
+    TSample *points = table_.data() + frame * (frame_size_ + 3);
+
+    for (unsigned int i = 0; i < frame_size_; i++)
+    {
+        points[i + 1] = samples[i];
+    }
+    points[0] = points[frame_size_];
+    points[frame_size_ + 1] = points[1];
+    points[frame_size_ + 2] = points[std::min(2u, frame_size_)];
+}
+
+template <typename TSample>
+#if __cplusplus >= 202002L
+requires std::floating_point<TSample>
+#endif
+inline TSample WTScanOsc<TSample>::read_(const TSample *points, const TSample &fraction)
+{
+    if (interpolation_ == WTInterpolation::linear)
+    {
+        return linip(points[1], points[2], fraction);
+    }
+    else if (interpolation_ == WTInterpolation::cubic)
+    {
+        return cubip(points[0], points[1], points[2], points[3], fraction);
+    }
+
+    return cosip(points[1], points[2], fraction);
+}
+
 }
 
 #endif // WTOSC_H_